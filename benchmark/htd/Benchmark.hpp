@@ -0,0 +1,47 @@
+/*
+ * File:   Benchmark.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_BENCHMARK_BENCHMARK_HPP
+#define HTD_BENCHMARK_BENCHMARK_HPP
+
+#include <chrono>
+
+/**
+ *  Measure the time required by a function call.
+ *
+ *  @param[in] function The function which shall be called.
+ *
+ *  @return The time required by the function call in milliseconds.
+ */
+template < typename Function >
+double measure(const Function & function)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    function();
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif /* HTD_BENCHMARK_BENCHMARK_HPP */
@@ -0,0 +1,86 @@
+/*
+ * File:   GraphPreprocessorBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include "Benchmark.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+    htd::seedRandomNumberGenerator(1);
+
+    /* A sparse graph consisting of a random tree with additional local edges and a small core of random edges. */
+    for (htd::vertex_t vertex = 2; vertex <= vertexCount; ++vertex)
+    {
+        graph.addEdge(vertex, htd::selectRandomIndex(vertex - 1) + 1);
+
+        if (vertex % 3 == 0 && vertex > 50)
+        {
+            graph.addEdge(vertex, vertex - htd::selectRandomIndex(50) - 1);
+        }
+    }
+
+    std::size_t coreSize = vertexCount / 100 + 1;
+
+    for (std::size_t index = 0; index < 4 * coreSize; ++index)
+    {
+        graph.addEdge(htd::selectRandomIndex(coreSize) + 1, htd::selectRandomIndex(coreSize) + 1);
+    }
+
+    std::cout << "VERTICES: " << graph.vertexCount() << ", EDGES: " << graph.edgeCount() << std::endl;
+
+    std::vector<std::string> strategies { "none", "simple", "advanced", "full" };
+
+    for (std::size_t level = 0; level < strategies.size(); ++level)
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(level);
+
+        htd::IPreprocessedGraph * preprocessedGraph = nullptr;
+
+        double duration = measure([&]()
+        {
+            preprocessedGraph = preprocessor.prepare(graph);
+        });
+
+        std::cout << strategies[level] << ": " << duration << "ms (ELIMINATED: " << preprocessedGraph->eliminationSequence().size() << ", REMAINING: " << preprocessedGraph->remainingVertices().size() << ", MIN TREEWIDTH: " << preprocessedGraph->minTreeWidth() << ")" << std::endl;
+
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+
+    return 0;
+}
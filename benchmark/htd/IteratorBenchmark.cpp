@@ -0,0 +1,118 @@
+/*
+ * File:   IteratorBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include "Benchmark.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ *  Iterate repeatedly over the given collection and sum up its elements.
+ *
+ *  @param[in] collection   The collection which shall be traversed.
+ *  @param[in] repetitions  The number of traversals.
+ *
+ *  @return The sum of the elements over all traversals.
+ */
+template < typename CollectionType >
+std::size_t traverse(const CollectionType & collection, std::size_t repetitions)
+{
+    std::size_t ret = 0;
+
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        for (htd::vertex_t vertex : collection)
+        {
+            ret += vertex;
+        }
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 100000;
+
+    std::size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 200;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+    htd::seedRandomNumberGenerator(1);
+
+    for (std::size_t index = 0; index < 4 * vertexCount; ++index)
+    {
+        graph.addEdge(htd::selectRandomIndex(vertexCount) + 1, htd::selectRandomIndex(vertexCount) + 1);
+    }
+
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    htd::VectorAdapter<htd::vertex_t> adapter(vertices);
+
+    std::size_t checksum1 = 0;
+    std::size_t checksum2 = 0;
+    std::size_t checksum3 = 0;
+    std::size_t checksum4 = 0;
+
+    double duration1 = measure([&]()
+    {
+        checksum1 = traverse(vertices, repetitions);
+    });
+
+    double duration2 = measure([&]()
+    {
+        checksum2 = traverse(graph.vertices(), repetitions);
+    });
+
+    double duration3 = measure([&]()
+    {
+        checksum3 = traverse(htd::ConstCollection<htd::vertex_t>::getInstance(adapter), repetitions);
+    });
+
+    double duration4 = measure([&]()
+    {
+        for (std::size_t repetition = 0; repetition < repetitions / 10; ++repetition)
+        {
+            for (htd::vertex_t vertex : graph.vertices())
+            {
+                checksum4 += traverse(graph.neighbors(vertex), 1);
+            }
+        }
+    });
+
+    std::cout << "VERTICES: " << vertexCount << ", REPETITIONS: " << repetitions << std::endl;
+    std::cout << "std::vector:                     " << duration1 << "ms (CHECKSUM: " << checksum1 << ")" << std::endl;
+    std::cout << "ConstCollection (std::vector):   " << duration2 << "ms (CHECKSUM: " << checksum2 << ")" << std::endl;
+    std::cout << "ConstCollection (VectorAdapter): " << duration3 << "ms (CHECKSUM: " << checksum3 << ")" << std::endl;
+    std::cout << "Neighborhoods:                   " << duration4 << "ms (CHECKSUM: " << checksum4 << ")" << std::endl;
+
+    delete libraryInstance;
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * File:   PriorityQueueBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include "Benchmark.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ *  Simulate the access pattern of the elimination heuristics: Repeatedly select a random element of top priority,
+ *  erase it and update the priorities of some other elements.
+ *
+ *  @param[in] priorityQueue    The empty priority queue which shall be used.
+ *  @param[in] elementCount     The number of elements which shall be inserted into the priority queue.
+ *  @param[in] updateCount      The number of priority updates per removed element.
+ *
+ *  @return The checksum of the elements in the order in which they were removed.
+ */
+template < typename PriorityQueueType >
+std::size_t simulateElimination(PriorityQueueType & priorityQueue, std::size_t elementCount, std::size_t updateCount)
+{
+    std::size_t ret = 0;
+
+    std::vector<std::size_t> priorities(elementCount);
+
+    std::vector<bool> removed(elementCount, false);
+
+    htd::seedRandomNumberGenerator(1);
+
+    for (htd::vertex_t vertex = 0; vertex < elementCount; ++vertex)
+    {
+        priorities[vertex] = htd::selectRandomIndex(64);
+
+        priorityQueue.push(vertex, priorities[vertex]);
+    }
+
+    while (!priorityQueue.empty())
+    {
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+
+        priorityQueue.eraseFromTopCollection(selectedVertex);
+
+        removed[selectedVertex] = true;
+
+        ret = ret * 31 + selectedVertex;
+
+        for (std::size_t index = 0; index < updateCount; ++index)
+        {
+            htd::vertex_t vertex = htd::selectRandomIndex(elementCount);
+
+            if (!removed[vertex])
+            {
+                std::size_t newPriority = priorities[vertex] + htd::selectRandomIndex(5);
+
+                newPriority = newPriority > 2 ? newPriority - 2 : 0;
+
+                priorityQueue.updatePriority(vertex, priorities[vertex], newPriority);
+
+                priorities[vertex] = newPriority;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Create a random graph with the given number of vertices and edges.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] vertexCount      The number of vertices of the new graph.
+ *  @param[in] edgeCount        The number of edges of the new graph.
+ *
+ *  @return The new graph.
+ */
+htd::IMutableMultiHypergraph * createRandomGraph(const htd::LibraryInstance * libraryInstance, std::size_t vertexCount, std::size_t edgeCount)
+{
+    htd::IMutableMultiHypergraph * ret = libraryInstance->multiHypergraphFactory().createInstance(vertexCount);
+
+    htd::seedRandomNumberGenerator(2);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t vertex1 = htd::selectRandomIndex(vertexCount) + 1;
+        htd::vertex_t vertex2 = htd::selectRandomIndex(vertexCount) + 1;
+
+        if (vertex1 != vertex2)
+        {
+            ret->addEdge(vertex1, vertex2);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compare the running time of an ordering algorithm with and without the bucket priority queue.
+ *
+ *  @param[in] name     The name of the ordering algorithm.
+ *  @param[in] graph    The input graph.
+ */
+template < typename OrderingAlgorithmType >
+void benchmarkOrderingAlgorithm(const std::string & name, const htd::IMultiHypergraph & graph)
+{
+    OrderingAlgorithmType algorithm(graph.managementInstance());
+
+    for (bool bucketPriorityQueueEnabled : { false, true })
+    {
+        algorithm.setBucketPriorityQueueEnabled(bucketPriorityQueueEnabled);
+
+        std::size_t maximumBagSize = 0;
+
+        htd::seedRandomNumberGenerator(3);
+
+        double duration = measure([&]()
+        {
+            htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+            maximumBagSize = ordering->maximumBagSize();
+
+            delete ordering;
+        });
+
+        std::cout << name << (bucketPriorityQueueEnabled ? " (BucketPriorityQueue): " : " (PriorityQueue):       ") << duration << "ms (WIDTH: " << (maximumBagSize - 1) << ")" << std::endl;
+    }
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t elementCount = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    std::size_t vertexCount = argc > 2 ? std::stoul(argv[2]) : 5000;
+
+    std::size_t updateCount = 4;
+
+    std::size_t checksum1 = 0;
+    std::size_t checksum2 = 0;
+
+    double duration1 = measure([&]()
+    {
+        htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+        checksum1 = simulateElimination(priorityQueue, elementCount, updateCount);
+    });
+
+    double duration2 = measure([&]()
+    {
+        htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(elementCount);
+
+        checksum2 = simulateElimination(priorityQueue, elementCount, updateCount);
+    });
+
+    std::cout << "ELEMENTS: " << elementCount << ", UPDATES PER REMOVAL: " << updateCount << std::endl;
+    std::cout << "PriorityQueue:       " << duration1 << "ms (CHECKSUM: " << checksum1 << ")" << std::endl;
+    std::cout << "BucketPriorityQueue: " << duration2 << "ms (CHECKSUM: " << checksum2 << ")" << std::endl;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = createRandomGraph(libraryInstance, vertexCount, 3 * vertexCount / 2);
+
+    std::cout << std::endl << "RANDOM GRAPH: " << graph->vertexCount() << " VERTICES, " << graph->edgeCount() << " EDGES" << std::endl;
+
+    benchmarkOrderingAlgorithm<htd::MinDegreeOrderingAlgorithm>("MinDegreeOrderingAlgorithm", *graph);
+    benchmarkOrderingAlgorithm<htd::MinFillOrderingAlgorithm>("MinFillOrderingAlgorithm", *graph);
+
+    delete graph;
+
+    delete libraryInstance;
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * File:   SetCoverBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ *  Create a random hypergraph with the given number of vertices and hyperedges.
+ *
+ *  @param[in] libraryInstance      The management instance to which the new hypergraph shall belong.
+ *  @param[in] vertexCount          The number of vertices of the new hypergraph.
+ *  @param[in] edgeCount            The number of hyperedges of the new hypergraph.
+ *  @param[in] maximumEdgeSize      The maximum number of vertices of a hyperedge.
+ *  @param[in] locality             The maximum distance between the vertex identifiers of a hyperedge.
+ *
+ *  @return The new hypergraph.
+ */
+htd::IMutableMultiHypergraph * createRandomHypergraph(const htd::LibraryInstance * libraryInstance, std::size_t vertexCount, std::size_t edgeCount, std::size_t maximumEdgeSize, std::size_t locality)
+{
+    htd::IMutableMultiHypergraph * ret = libraryInstance->multiHypergraphFactory().createInstance(vertexCount);
+
+    htd::seedRandomNumberGenerator(2);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        htd::vertex_t origin = htd::selectRandomIndex(vertexCount);
+
+        std::size_t edgeSize = 2 + htd::selectRandomIndex(maximumEdgeSize - 1);
+
+        for (std::size_t position = 0; position < edgeSize; ++position)
+        {
+            elements.push_back((origin + htd::selectRandomIndex(locality)) % vertexCount + 1);
+        }
+
+        std::sort(elements.begin(), elements.end());
+
+        elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+
+        if (elements.size() > 1)
+        {
+            ret->addEdge(elements);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compare the width and the running time of hypertree decompositions computed with different set-cover algorithms.
+ *
+ *  @param[in] libraryInstance  The management instance to which the graph belongs.
+ *  @param[in] graph            The input graph.
+ */
+void benchmarkSetCoverAlgorithms(htd::LibraryInstance * libraryInstance, const htd::IMultiHypergraph & graph)
+{
+    std::vector<std::pair<std::string, htd::ISetCoverAlgorithm *>> algorithms;
+
+    algorithms.emplace_back("GreedySetCoverAlgorithm:         ", new htd::GreedySetCoverAlgorithm(libraryInstance));
+    algorithms.emplace_back("IndexedGreedySetCoverAlgorithm:  ", new htd::IndexedGreedySetCoverAlgorithm(libraryInstance));
+    algorithms.emplace_back("BranchAndBoundSetCoverAlgorithm: ", new htd::BranchAndBoundSetCoverAlgorithm(libraryInstance));
+
+    for (const std::pair<std::string, htd::ISetCoverAlgorithm *> & algorithm : algorithms)
+    {
+        libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(algorithm.second);
+
+        htd::HypertreeDecompositionAlgorithm decompositionAlgorithm(libraryInstance);
+
+        std::size_t width = 0;
+
+        std::size_t totalCoverSize = 0;
+
+        htd::seedRandomNumberGenerator(3);
+
+        double duration = measure([&]()
+        {
+            htd::IHypertreeDecomposition * decomposition = decompositionAlgorithm.computeDecomposition(graph);
+
+            width = decomposition->maximumCoveringEdgeAmount();
+
+            for (htd::vertex_t vertex : decomposition->vertices())
+            {
+                totalCoverSize += decomposition->coveringEdges(vertex).size();
+            }
+
+            delete decomposition;
+        });
+
+        std::cout << algorithm.first << duration << "ms (WIDTH: " << width << ", TOTAL COVER SIZE: " << totalCoverSize << ")" << std::endl;
+    }
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 2000;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    for (std::size_t maximumEdgeSize : { 3, 5, 8 })
+    {
+        htd::IMutableMultiHypergraph * graph = createRandomHypergraph(libraryInstance, vertexCount, vertexCount, maximumEdgeSize, 4 * maximumEdgeSize);
+
+        std::cout << "RANDOM HYPERGRAPH: " << graph->vertexCount() << " VERTICES, " << graph->edgeCount() << " HYPEREDGES, MAXIMUM EDGE SIZE: " << maximumEdgeSize << std::endl;
+
+        benchmarkSetCoverAlgorithms(libraryInstance, *graph);
+
+        std::cout << std::endl;
+
+        delete graph;
+    }
+
+    delete libraryInstance;
+
+    return 0;
+}
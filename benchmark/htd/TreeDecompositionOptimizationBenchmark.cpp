@@ -0,0 +1,233 @@
+/*
+ * File:   TreeDecompositionOptimizationBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+/**
+ *  Fitness function preferring decompositions of low height and, as second criterion, low total depth of the nodes.
+ */
+class HeightFitnessFunction : public htd::IIncrementalTreeDecompositionFitnessFunction
+{
+    public:
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const HTD_OVERRIDE
+        {
+            HTD_UNUSED(graph)
+
+            double depthSum = 0;
+
+            for (htd::vertex_t vertex : decomposition.vertices())
+            {
+                depthSum += decomposition.depth(vertex);
+            }
+
+            return new htd::FitnessEvaluation(2, -(double)(decomposition.height()), -depthSum);
+        }
+
+        void initializeSummary(std::vector<double> & summary) const HTD_OVERRIDE
+        {
+            summary.assign({ -1, 0, 0 });
+        }
+
+        void combineSummaries(std::vector<double> & summary, const std::vector<double> & otherSummary) const HTD_OVERRIDE
+        {
+            summary[0] = std::max(summary[0], otherSummary[0]);
+            summary[1] += otherSummary[1];
+            summary[2] += otherSummary[2];
+        }
+
+        void computeSummary(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t node, const std::vector<double> & childSummary, std::vector<double> & summary) const HTD_OVERRIDE
+        {
+            HTD_UNUSED(graph)
+            HTD_UNUSED(decomposition)
+            HTD_UNUSED(node)
+
+            summary.assign({ childSummary[0] + 1, childSummary[1] + 1, childSummary[2] + childSummary[1] });
+        }
+
+        htd::FitnessEvaluation * evaluateSummary(const std::vector<double> & summary) const HTD_OVERRIDE
+        {
+            return new htd::FitnessEvaluation(2, -summary[0], -summary[2]);
+        }
+
+        HeightFitnessFunction * clone(void) const HTD_OVERRIDE
+        {
+            return new HeightFitnessFunction();
+        }
+};
+
+/**
+ *  Fitness function hiding the incremental evaluation of HeightFitnessFunction.
+ */
+class GenericHeightFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const HTD_OVERRIDE
+        {
+            return fitnessFunction_.fitness(graph, decomposition);
+        }
+
+        GenericHeightFitnessFunction * clone(void) const HTD_OVERRIDE
+        {
+            return new GenericHeightFitnessFunction();
+        }
+
+    private:
+        HeightFitnessFunction fitnessFunction_;
+};
+
+/**
+ *  Create a sparse graph consisting of a random tree with additional local edges.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] vertexCount      The number of vertices of the new graph.
+ *
+ *  @return The new graph.
+ */
+htd::IMultiHypergraph * createGraph(const htd::LibraryInstance * const libraryInstance, std::size_t vertexCount)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, vertexCount);
+
+    for (htd::vertex_t vertex = 2; vertex <= vertexCount; ++vertex)
+    {
+        ret->addEdge(vertex, htd::selectRandomIndex(vertex - 1) + 1);
+
+        if (vertex > 5)
+        {
+            ret->addEdge(vertex, vertex - htd::selectRandomIndex(5) - 1);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute a tree decomposition of the given graph.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new decomposition shall belong.
+ *  @param[in] graph            The graph which shall be decomposed.
+ *
+ *  @return A tree decomposition of the given graph.
+ */
+htd::IMutableTreeDecomposition * computeDecomposition(const htd::LibraryInstance * const libraryInstance, const htd::IMultiHypergraph & graph)
+{
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    return dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph));
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 2000;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::seedRandomNumberGenerator(1);
+
+    htd::IMultiHypergraph * graph = createGraph(libraryInstance, vertexCount);
+
+    htd::IMutableTreeDecomposition * decomposition = computeDecomposition(libraryInstance, *graph);
+
+    htd::NormalizationOperation normalizationOperation(libraryInstance);
+
+    normalizationOperation.apply(*graph, *decomposition);
+
+    std::cout << "VERTICES: " << graph->vertexCount() << ", EDGES: " << graph->edgeCount() << ", DECOMPOSITION NODES: " << decomposition->vertexCount() << std::endl;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    htd::IMutableTreeDecomposition * genericDecomposition = decomposition->clone();
+    htd::IMutableTreeDecomposition * incrementalDecomposition = decomposition->clone();
+#else
+    htd::IMutableTreeDecomposition * genericDecomposition = decomposition->cloneMutableTreeDecomposition();
+    htd::IMutableTreeDecomposition * incrementalDecomposition = decomposition->cloneMutableTreeDecomposition();
+#endif
+
+    htd::TreeDecompositionOptimizationOperation genericOperation(libraryInstance, new GenericHeightFitnessFunction());
+
+    htd::TreeDecompositionOptimizationOperation incrementalOperation(libraryInstance, new HeightFitnessFunction());
+
+    double genericDuration = measure([&]()
+    {
+        genericOperation.apply(*graph, *genericDecomposition);
+    });
+
+    double incrementalDuration = measure([&]()
+    {
+        incrementalOperation.apply(*graph, *incrementalDecomposition);
+    });
+
+    std::cout << "generic: " << genericDuration << "ms (HEIGHT: " << genericDecomposition->height() << "), "
+              << "incremental: " << incrementalDuration << "ms (HEIGHT: " << incrementalDecomposition->height() << ")" << std::endl;
+
+    delete genericDecomposition;
+    delete incrementalDecomposition;
+    delete decomposition;
+    delete graph;
+
+    /* Candidate roots are evaluated with manipulation operations on a smaller graph, because each candidate is processed separately. */
+    graph = createGraph(libraryInstance, vertexCount / 10);
+
+    decomposition = computeDecomposition(libraryInstance, *graph);
+
+    std::cout << "VERTICES: " << graph->vertexCount() << ", DECOMPOSITION NODES: " << decomposition->vertexCount() << std::endl;
+
+    for (bool enforceNaiveOptimization : { true, false })
+    {
+        for (std::size_t threadCount : { 1, 4 })
+        {
+            htd::TreeDecompositionOptimizationOperation operation(libraryInstance, new GenericHeightFitnessFunction(), enforceNaiveOptimization);
+
+            operation.addManipulationOperation(new htd::NormalizationOperation(libraryInstance));
+
+            operation.setThreadCount(threadCount);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            htd::IMutableTreeDecomposition * currentDecomposition = decomposition->clone();
+#else
+            htd::IMutableTreeDecomposition * currentDecomposition = decomposition->cloneMutableTreeDecomposition();
+#endif
+
+            double duration = measure([&]()
+            {
+                operation.apply(*graph, *currentDecomposition);
+            });
+
+            std::cout << (enforceNaiveOptimization ? "naive" : "intelligent") << " (THREADS: " << threadCount << "): "
+                      << duration << "ms (HEIGHT: " << currentDecomposition->height() << ", NODES: " << currentDecomposition->vertexCount() << ")" << std::endl;
+
+            delete currentDecomposition;
+        }
+    }
+
+    delete decomposition;
+    delete graph;
+    delete libraryInstance;
+
+    return 0;
+}
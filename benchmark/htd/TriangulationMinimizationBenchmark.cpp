@@ -0,0 +1,157 @@
+/*
+ * File:   TriangulationMinimizationBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ *  Compute the maximum bag size of the tree decomposition induced by the given vertex elimination ordering.
+ *
+ *  @param[in] graph        The graph.
+ *  @param[in] ordering     The vertex elimination ordering.
+ *
+ *  @return The maximum bag size of the tree decomposition induced by the given vertex elimination ordering.
+ */
+std::size_t maximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(graph.vertexCount() + 1);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        graph.copyNeighborsTo(vertex, neighborhood[vertex]);
+
+        neighborhood[vertex].erase(std::remove(neighborhood[vertex].begin(), neighborhood[vertex].end(), vertex), neighborhood[vertex].end());
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        ret = std::max(ret, currentNeighborhood.size() + 1);
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+            std::vector<htd::vertex_t> newNeighborhood;
+
+            std::set_union(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end(), std::back_inserter(newNeighborhood));
+
+            newNeighborhood.erase(std::remove_if(newNeighborhood.begin(), newNeighborhood.end(), [&](htd::vertex_t other) { return other == neighbor || other == vertex; }), newNeighborhood.end());
+
+            otherNeighborhood.swap(newNeighborhood);
+        }
+
+        std::vector<htd::vertex_t>().swap(currentNeighborhood);
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 2000;
+
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+    htd::seedRandomNumberGenerator(1);
+
+    /* A sparse graph consisting of a random tree with additional local and random edges. */
+    for (htd::vertex_t vertex = 2; vertex <= vertexCount; ++vertex)
+    {
+        graph.addEdge(vertex, htd::selectRandomIndex(vertex - 1) + 1);
+
+        if (vertex > 20)
+        {
+            graph.addEdge(vertex, vertex - htd::selectRandomIndex(20) - 1);
+        }
+    }
+
+    for (std::size_t index = 0; index < vertexCount / 2; ++index)
+    {
+        graph.addEdge(htd::selectRandomIndex(vertexCount) + 1, htd::selectRandomIndex(vertexCount) + 1);
+    }
+
+    std::cout << "VERTICES: " << graph.vertexCount() << ", EDGES: " << graph.edgeCount() << std::endl;
+
+    std::vector<std::string> names { "min-fill", "min-degree" };
+
+    for (std::size_t index = 0; index < names.size(); ++index)
+    {
+        htd::IOrderingAlgorithm * baseAlgorithm = nullptr;
+
+        if (index == 0)
+        {
+            baseAlgorithm = new htd::MinFillOrderingAlgorithm(libraryInstance);
+        }
+        else
+        {
+            baseAlgorithm = new htd::MinDegreeOrderingAlgorithm(libraryInstance);
+        }
+
+        htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+        algorithm.setOrderingAlgorithm(baseAlgorithm->clone());
+
+        htd::IVertexOrdering * baseOrdering = nullptr;
+
+        htd::IVertexOrdering * minimizedOrdering = nullptr;
+
+        htd::seedRandomNumberGenerator(1);
+
+        double baseDuration = measure([&]()
+        {
+            baseOrdering = baseAlgorithm->computeOrdering(graph);
+        });
+
+        htd::seedRandomNumberGenerator(1);
+
+        double minimizedDuration = measure([&]()
+        {
+            minimizedOrdering = algorithm.computeOrdering(graph);
+        });
+
+        std::cout << names[index] << ": " << baseDuration << "ms (MAX BAG SIZE: " << maximumBagSize(graph, baseOrdering->sequence()) << "), "
+                  << "minimized: " << minimizedDuration << "ms (MAX BAG SIZE: " << maximumBagSize(graph, minimizedOrdering->sequence()) << ")" << std::endl;
+
+        delete baseOrdering;
+        delete minimizedOrdering;
+        delete baseAlgorithm;
+    }
+
+    delete libraryInstance;
+
+    return 0;
+}
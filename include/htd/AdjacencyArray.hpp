@@ -0,0 +1,200 @@
+/*
+ * File:   AdjacencyArray.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ADJACENCYARRAY_HPP
+#define HTD_HTD_ADJACENCYARRAY_HPP
+
+#include <htd/Globals.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable adjacency structure in compressed sparse row format.
+     *
+     *  The neighborhoods of all vertices are stored back to back in a single target array. The neighborhood
+     *  of vertex i occupies the range [offsets()[i], offsets()[i + 1]) of the target array. Compared to a
+     *  vector of vectors, the structure requires only two heap allocations, independent of the number of
+     *  vertices, and each neighborhood is a contiguous, sorted range of memory.
+     *
+     *  @note The vertices stored in this data structure use 0-based vertex names.
+     */
+    class AdjacencyArray
+    {
+        public:
+            /**
+             *  Constructor for a new, empty adjacency array.
+             */
+            AdjacencyArray(void) : offsets_(1, 0), targets_()
+            {
+
+            }
+
+            /**
+             *  Constructor for a new adjacency array.
+             *
+             *  @param[in] neighborhood A vector containing the sorted neighborhood of each of the vertices.
+             */
+            AdjacencyArray(const std::vector<std::vector<htd::vertex_t>> & neighborhood) : offsets_(), targets_()
+            {
+                offsets_.reserve(neighborhood.size() + 1);
+
+                offsets_.push_back(0);
+
+                std::size_t targetCount = 0;
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    targetCount += currentNeighborhood.size();
+
+                    offsets_.push_back(targetCount);
+                }
+
+                targets_.reserve(targetCount);
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    targets_.insert(targets_.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+                }
+            }
+
+            /**
+             *  Destructor of an adjacency array.
+             */
+            ~AdjacencyArray(void)
+            {
+
+            }
+
+            /**
+             *  Getter for the number of vertices covered by the adjacency array.
+             *
+             *  @return The number of vertices covered by the adjacency array.
+             */
+            std::size_t vertexCount(void) const
+            {
+                return offsets_.size() - 1;
+            }
+
+            /**
+             *  Getter for the total size of all neighborhoods, i.e., twice the number of undirected edges.
+             *
+             *  @return The total size of all neighborhoods.
+             */
+            std::size_t targetCount(void) const
+            {
+                return targets_.size();
+            }
+
+            /**
+             *  Getter for the number of neighbors of a vertex.
+             *
+             *  @param[in] vertex   The vertex whose number of neighbors shall be returned.
+             *
+             *  @return The number of neighbors of the given vertex.
+             */
+            std::size_t neighborCount(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return offsets_[vertex + 1] - offsets_[vertex];
+            }
+
+            /**
+             *  Getter for the beginning of the sorted neighborhood of a vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
+             *
+             *  @return A pointer to the first neighbor of the given vertex.
+             */
+            const htd::vertex_t * begin(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return targets_.data() + offsets_[vertex];
+            }
+
+            /**
+             *  Getter for the end of the sorted neighborhood of a vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
+             *
+             *  @return A pointer past the last neighbor of the given vertex.
+             */
+            const htd::vertex_t * end(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount())
+
+                return targets_.data() + offsets_[vertex + 1];
+            }
+
+            /**
+             *  Check whether two vertices are neighbors.
+             *
+             *  @param[in] vertex   The first vertex.
+             *  @param[in] neighbor The second vertex.
+             *
+             *  @return True if the second vertex is contained in the neighborhood of the first vertex, false otherwise.
+             */
+            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+            {
+                return std::binary_search(begin(vertex), end(vertex), neighbor);
+            }
+
+            /**
+             *  Getter for the offset array.
+             *
+             *  @return The offset array, containing vertexCount() + 1 entries.
+             */
+            const std::vector<std::size_t> & offsets(void) const
+            {
+                return offsets_;
+            }
+
+            /**
+             *  Getter for the target array.
+             *
+             *  @return The target array containing the neighborhoods of all vertices back to back.
+             */
+            const std::vector<htd::vertex_t> & targets(void) const
+            {
+                return targets_;
+            }
+
+        private:
+            /**
+             *  The position of the first neighbor of each vertex within the target array, followed by the size of the target array.
+             */
+            std::vector<std::size_t> offsets_;
+
+            /**
+             *  The neighborhoods of all vertices, stored back to back.
+             */
+            std::vector<htd::vertex_t> targets_;
+    };
+}
+
+#endif /* HTD_HTD_ADJACENCYARRAY_HPP */
@@ -0,0 +1,121 @@
+/* 
+ * File:   BranchAndBoundSetCoverAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BRANCHANDBOUNDSETCOVERALGORITHM_HPP
+#define HTD_HTD_BRANCHANDBOUNDSETCOVERALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ISetCoverAlgorithm.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ISetCoverAlgorithm interface based on depth-first branch and bound.
+     *
+     *  The search starts from a greedy solution and branches on the uncovered element covered by the fewest
+     *  containers. A branch is cut off as soon as the number of selected containers plus a lower bound for the
+     *  remaining elements reaches the size of the best solution found so far. The lower bound is the larger one of
+     *  the number of pairwise disjoint uncovered elements (i.e., uncovered elements no two of which share a container)
+     *  and the number of uncovered elements divided by the size of the largest container. Containers which cover
+     *  only a subset of the uncovered elements covered by another candidate are not considered as branches.
+     *
+     *  The search is limited by a node budget per call, so its result does not depend on the speed of the machine. An
+     *  additional time budget can be set via setTimeLimit(). When a budget runs out, the best solution found so far is
+     *  returned, which is never larger than the greedy solution.
+     */
+    class BranchAndBoundSetCoverAlgorithm : public htd::ISetCoverAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new set-cover algorithm of type BranchAndBoundSetCoverAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API BranchAndBoundSetCoverAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a set-cover algorithm of type BranchAndBoundSetCoverAlgorithm.
+             *
+             *  @param[in] original  The original set-cover algorithm.
+             */
+            HTD_API BranchAndBoundSetCoverAlgorithm(const htd::BranchAndBoundSetCoverAlgorithm & original);
+
+            HTD_API virtual ~BranchAndBoundSetCoverAlgorithm();
+
+            HTD_API void computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE;
+
+            HTD_API void computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE;
+
+            /**
+             *  Getter for the maximum number of search nodes which are explored per call of computeSetCover().
+             *
+             *  @return The maximum number of search nodes which are explored per call of computeSetCover().
+             */
+            HTD_API std::size_t nodeLimit(void) const;
+
+            /**
+             *  Set the maximum number of search nodes which are explored per call of computeSetCover().
+             *
+             *  @param[in] nodeLimit    The maximum number of search nodes which are explored per call of computeSetCover(). The value (std::size_t)-1 disables the limit.
+             */
+            HTD_API void setNodeLimit(std::size_t nodeLimit);
+
+            /**
+             *  Getter for the maximum time in milliseconds which is spent on the search per call of computeSetCover().
+             *
+             *  @return The maximum time in milliseconds which is spent on the search per call of computeSetCover().
+             */
+            HTD_API std::size_t timeLimit(void) const;
+
+            /**
+             *  Set the maximum time in milliseconds which is spent on the search per call of computeSetCover().
+             *
+             *  @param[in] timeLimit    The maximum time in milliseconds which is spent on the search per call of computeSetCover(). The value (std::size_t)-1 disables the limit. (Default: (std::size_t)-1)
+             */
+            HTD_API void setTimeLimit(std::size_t timeLimit);
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API BranchAndBoundSetCoverAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a set cover algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            HTD_API BranchAndBoundSetCoverAlgorithm & operator=(const BranchAndBoundSetCoverAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_BRANCHANDBOUNDSETCOVERALGORITHM_HPP */
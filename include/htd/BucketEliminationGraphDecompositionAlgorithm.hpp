@@ -32,6 +32,7 @@
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPreprocessedGraph.hpp>
 
+#include <functional>
 #include <utility>
 
 namespace htd
@@ -176,6 +177,30 @@ namespace htd
              */
             HTD_API std::pair<htd::IGraphDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  The bound is re-evaluated while the vertex ordering is computed if the ordering algorithm is width-limitable, hence it may be tightened concurrently.
+             *
+             *  @param[in] graph                    The input graph to decompose.
+             *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+             *  @param[in] maxBagSize               A function returning the current upper bound for the maximum bag size of the decomposition.
+             *  @param[in] maxIterationCount        The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @note The bag size which is compared to maxBagSize is the maximum bag size of the decomposition BEFORE the manipulation operations are applied.
+             *  Therefore, the result of this function may have a maximum bag size exceeding maxBagSize if the requested manipulations create larger bags.
+             *
+             *  @return A pair consisting of the new IGraphDecomposition object representing the decomposition of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
+             */
+            HTD_API std::pair<htd::IGraphDecomposition *, std::size_t> computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const;
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
@@ -217,6 +242,20 @@ namespace htd
              */
             HTD_API void setCompressionEnabled(bool compressionEnabled);
 
+            /**
+             *  Getter for the number of worker threads which shall be used to distribute the hyperedges to the bags containing them.
+             *
+             *  @return The number of worker threads which shall be used to distribute the hyperedges to the bags containing them.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to distribute the hyperedges to the bags containing them (1=sequential, 0=number of hardware threads).
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to distribute the hyperedges to the bags containing them.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API BucketEliminationGraphDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
 
         protected:
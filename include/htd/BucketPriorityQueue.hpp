@@ -0,0 +1,356 @@
+/*
+ * File:   BucketPriorityQueue.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+#define HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <type_traits>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Priority queue for small, non-negative integer elements and integer priorities where the element with the lowest priority is on top.
+     *
+     *  The elements are stored in one bucket per priority and the position of each element within its bucket is
+     *  remembered, so that inserting, erasing and updating an element takes constant time. The elements of the top
+     *  bucket are stored contiguously which allows to select a random element with top priority in constant time.
+     *
+     *  @note The memory consumption is linear in the largest element and in the largest priority ever inserted.
+     *  After the top bucket became empty, the next non-empty bucket is found by a linear scan over the priorities.
+     */
+    template < typename ValueType >
+    class BucketPriorityQueue
+    {
+        static_assert(std::is_integral<ValueType>::value, "The elements of a bucket priority queue must be of integral type.");
+
+        public:
+            /**
+             *  Constructor of a new priority queue.
+             */
+            BucketPriorityQueue(void) : buckets_(), priorities_(), positions_(), topPriority_(0), size_(0)
+            {
+
+            }
+
+            /**
+             *  Constructor of a new priority queue.
+             *
+             *  @param[in] capacity The number of elements for which memory shall be reserved. The elements 0, ..., capacity - 1 can be inserted without further allocations of the lookup tables.
+             */
+            BucketPriorityQueue(std::size_t capacity) : buckets_(), priorities_(capacity, 0), positions_(capacity, INVALID_POSITION), topPriority_(0), size_(0)
+            {
+
+            }
+
+            /**
+             *  Destructor of a priority queue.
+             */
+            ~BucketPriorityQueue(void)
+            {
+
+            }
+
+            /**
+             *  Check whether the priority queue is emtpy.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements in the priority queue.
+             *
+             *  @return The number of elements in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the priority queue contains a specific element.
+             *
+             *  @param[in] value    The element which shall be checked.
+             *
+             *  @return True if the priority queue contains the given element, false otherwise.
+             */
+            bool contains(const ValueType & value) const
+            {
+                return static_cast<std::size_t>(value) < positions_.size() && positions_[value] != INVALID_POSITION;
+            }
+
+            /**
+             *  Access the top element.
+             *
+             *  @return The top element.
+             */
+            const ValueType & top(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return topCollection()[0];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            const std::size_t & topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return topPriority_;
+            }
+
+            /**
+             *  Access the collection of elements with top priority.
+             *
+             *  @return The collection of elements with top priority.
+             */
+            const std::vector<ValueType> & topCollection(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[topPriority_];
+            }
+
+            /**
+             *  Insert a new element with the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted. The element must not be contained in the priority queue.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void push(const ValueType & value, std::size_t priority)
+            {
+                HTD_ASSERT(!contains(value))
+
+                if (static_cast<std::size_t>(value) >= positions_.size())
+                {
+                    priorities_.resize(static_cast<std::size_t>(value) + 1, 0);
+
+                    positions_.resize(static_cast<std::size_t>(value) + 1, INVALID_POSITION);
+                }
+
+                if (size_ == 0 || priority < topPriority_)
+                {
+                    topPriority_ = priority;
+                }
+
+                insert(value, priority);
+
+                ++size_;
+            }
+
+            /**
+             *  Remove the top element.
+             */
+            void pop(void)
+            {
+                HTD_ASSERT(size_ > 0)
+
+                remove(top());
+
+                --size_;
+
+                updateTopPriority();
+            }
+
+            /**
+             *  Erase the specific element.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased, false otherwise.
+             */
+            bool erase(const ValueType & value)
+            {
+                bool ret = contains(value);
+
+                if (ret)
+                {
+                    remove(value);
+
+                    --size_;
+
+                    updateTopPriority();
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the collection of elements with the given priority.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *  @param[in] priority The priority of the element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the collection of elements with the given priority, false otherwise.
+             */
+            bool erase(const ValueType & value, std::size_t priority)
+            {
+                return contains(value) && priorities_[value] == priority && erase(value);
+            }
+
+            /**
+             *  Erase the specific element from the top collection.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the top collection, false otherwise.
+             */
+            bool eraseFromTopCollection(const ValueType & value)
+            {
+                return size_ > 0 && erase(value, topPriority_);
+            }
+
+            /**
+             *  Update the priority of a specific, existing element.
+             *
+             *  @param[in] value        The element which shall be updated.
+             *  @param[in] oldPriority  The old priority of the element which shall be updated.
+             *  @param[in] newPriority  The new priority of the element which shall be updated.
+             */
+            void updatePriority(const ValueType & value, std::size_t oldPriority, std::size_t newPriority)
+            {
+                HTD_ASSERT(contains(value) && priorities_[value] == oldPriority)
+
+                if (oldPriority != newPriority)
+                {
+                    remove(value);
+
+                    insert(value, newPriority);
+
+                    if (newPriority < topPriority_)
+                    {
+                        topPriority_ = newPriority;
+                    }
+                    else if (oldPriority == topPriority_)
+                    {
+                        updateTopPriority();
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  The position assigned to elements which are not contained in the priority queue.
+             */
+            static const htd::index_t INVALID_POSITION = static_cast<htd::index_t>(-1);
+
+            /**
+             *  The buckets of elements, indexed by their priority.
+             */
+            std::vector<std::vector<ValueType>> buckets_;
+
+            /**
+             *  The priority of each element, indexed by the element.
+             */
+            std::vector<std::size_t> priorities_;
+
+            /**
+             *  The position of each element within its bucket, indexed by the element. Elements not contained in the priority queue have position INVALID_POSITION.
+             */
+            std::vector<htd::index_t> positions_;
+
+            /**
+             *  The top priority, i.e., the lowest priority of an element in the priority queue.
+             */
+            std::size_t topPriority_;
+
+            /**
+             *  The number of elements stored in the priority queue.
+             */
+            std::size_t size_;
+
+            /**
+             *  Append an element to the bucket of the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void insert(const ValueType & value, std::size_t priority)
+            {
+                if (priority >= buckets_.size())
+                {
+                    buckets_.resize(priority + 1);
+                }
+
+                std::vector<ValueType> & bucket = buckets_[priority];
+
+                priorities_[value] = priority;
+
+                positions_[value] = bucket.size();
+
+                bucket.push_back(value);
+            }
+
+            /**
+             *  Remove an element from its bucket by replacing it with the last element of the bucket.
+             *
+             *  @param[in] value    The element which shall be removed.
+             */
+            void remove(ValueType value)
+            {
+                std::vector<ValueType> & bucket = buckets_[priorities_[value]];
+
+                htd::index_t position = positions_[value];
+
+                ValueType lastValue = bucket.back();
+
+                bucket[position] = lastValue;
+
+                positions_[lastValue] = position;
+
+                bucket.pop_back();
+
+                positions_[value] = INVALID_POSITION;
+            }
+
+            /**
+             *  Advance the top priority to the lowest priority of a non-empty bucket.
+             */
+            void updateTopPriority(void)
+            {
+                if (size_ > 0)
+                {
+                    while (buckets_[topPriority_].empty())
+                    {
+                        ++topPriority_;
+                    }
+                }
+            }
+    };
+
+    template < typename ValueType >
+    const htd::index_t BucketPriorityQueue<ValueType>::INVALID_POSITION;
+}
+
+#endif /* HTD_HTD_BUCKETPRIORITYQUEUE_HPP */
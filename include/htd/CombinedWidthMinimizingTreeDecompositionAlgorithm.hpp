@@ -50,6 +50,12 @@ namespace htd
      *  by a call to htd::LibraryInstance::terminate().
      *
      *  @note The base algorithms must be assigned before the optional manipulation operations!
+     *
+     *  @note If the thread count is set to a value greater than one, the base algorithms are run concurrently as a
+     *  portfolio. Each worker thread operates on its own clone of a base algorithm and the best maximum bag size
+     *  found so far is shared among all workers. Width-minimizing base algorithms re-read this bound while their
+     *  orderings are computed, so that an ordering which is already worse than a result of another worker is
+     *  abandoned early.
      */
     class CombinedWidthMinimizingTreeDecompositionAlgorithm : public htd::IWidthMinimizingTreeDecompositionAlgorithm
     {
@@ -81,6 +87,23 @@ namespace htd
              */
             HTD_API void addDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm);
 
+            /**
+             *  Getter for the number of worker threads which shall be used to run the base algorithms.
+             *
+             *  @return The number of worker threads which shall be used to run the base algorithms.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to run the base algorithms (1=sequential, 0=number of hardware threads).
+             *
+             *  @note With more than one thread, the workers share the best width found so far as pruning bound. Base algorithms
+             *  which prune with this bound may therefore return different decompositions from run to run, even for a fixed seed.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to run the base algorithms.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
 
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph,
@@ -0,0 +1,212 @@
+/*
+ * File:   ConnectedComponentTreeDecompositionAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ITreeDecompositionAlgorithm interface which decomposes
+     *  each connected component of the input graph independently.
+     *
+     *  The components are determined on the preprocessed format of the input graph, only the
+     *  hyperedges containing a vertex eliminated during the preprocessing phase are inspected
+     *  in the input graph itself.
+     *
+     *  The components are decomposed concurrently by a configurable number of worker threads.
+     *  Components with at most smallComponentSizeLimit() vertices are decomposed by the
+     *  algorithm provided via setSmallComponentDecompositionAlgorithm() (min-fill bucket
+     *  elimination by default), all other components are decomposed by the algorithm provided
+     *  via setDecompositionAlgorithm() (min-degree bucket elimination by default). The
+     *  decompositions of the components are attached as children to a common root with an
+     *  empty bag, hence the maximum bag size of the result is the maximum bag size among the
+     *  decompositions of the components.
+     *
+     *  @note The decomposition of each component is computed after re-seeding the random number
+     *  generator with a seed derived from the index of the component, so that the result does
+     *  not depend on the number of worker threads.
+     */
+    class ConnectedComponentTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new tree decomposition algorithm which decomposes each connected component independently.
+             *
+             *  @param[in] manager  The management instance to which the new algorithm belongs.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Constructor for a new tree decomposition algorithm which decomposes each connected component independently.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @param[in] manager                  The management instance to which the new algorithm belongs.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations);
+
+            /**
+             *  Copy constructor for a htd::ConnectedComponentTreeDecompositionAlgorithm object.
+             *
+             *  @param[in] original The original htd::ConnectedComponentTreeDecompositionAlgorithm object.
+             */
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm(const htd::ConnectedComponentTreeDecompositionAlgorithm & original);
+
+            HTD_API virtual ~ConnectedComponentTreeDecompositionAlgorithm();
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] preprocessedGraph            The input graph in preprocessed format.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const;
+
+            /**
+             *  Set the decomposition algorithm which shall be used to decompose components with more than smallComponentSizeLimit() vertices.
+             *
+             *  @param[in] algorithm    The decomposition algorithm which shall be used to decompose components with more than smallComponentSizeLimit() vertices.
+             *
+             *  @note When calling this method the control over the memory region of the decomposition algorithm is transferred to the
+             *  connected component decomposition algorithm. Deleting the decomposition algorithm provided to this method outside the
+             *  connected component decomposition algorithm or assigning the same decomposition algorithm multiple times will lead to
+             *  undefined behavior.
+             */
+            HTD_API void setDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm);
+
+            /**
+             *  Set the decomposition algorithm which shall be used to decompose components with at most smallComponentSizeLimit() vertices.
+             *
+             *  @param[in] algorithm    The decomposition algorithm which shall be used to decompose components with at most smallComponentSizeLimit() vertices.
+             *
+             *  @note When calling this method the control over the memory region of the decomposition algorithm is transferred to the
+             *  connected component decomposition algorithm. Deleting the decomposition algorithm provided to this method outside the
+             *  connected component decomposition algorithm or assigning the same decomposition algorithm multiple times will lead to
+             *  undefined behavior.
+             */
+            HTD_API void setSmallComponentDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm);
+
+            /**
+             *  Getter for the maximum number of vertices of a component which is decomposed by the small-component decomposition algorithm.
+             *
+             *  @return The maximum number of vertices of a component which is decomposed by the small-component decomposition algorithm.
+             */
+            HTD_API std::size_t smallComponentSizeLimit(void) const;
+
+            /**
+             *  Set the maximum number of vertices of a component which is decomposed by the small-component decomposition algorithm.
+             *
+             *  @param[in] smallComponentSizeLimit  The maximum number of vertices of a component which is decomposed by the small-component decomposition algorithm.
+             */
+            HTD_API void setSmallComponentSizeLimit(std::size_t smallComponentSizeLimit);
+
+            /**
+             *  Getter for the number of worker threads which shall be used to decompose the components.
+             *
+             *  @return The number of worker threads which shall be used to decompose the components.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to decompose the components (1=sequential, 0=number of hardware threads).
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to decompose the components.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            HTD_API void setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API bool isSafelyInterruptible(void) const HTD_OVERRIDE;
+
+            HTD_API bool isComputeInducedEdgesEnabled(void) const HTD_OVERRIDE;
+
+            HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API ConnectedComponentTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a tree decomposition algorithm which decomposes each connected component independently.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ConnectedComponentTreeDecompositionAlgorithm & operator=(const ConnectedComponentTreeDecompositionAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_HPP */
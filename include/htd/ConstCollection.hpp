@@ -31,6 +31,7 @@
 #include <htd/Algorithm.hpp>
 
 #include <iterator>
+#include <vector>
 
 namespace htd
 {
@@ -158,6 +159,7 @@ namespace htd
             {
                 begin_ = original.begin_;
                 end_ = original.end_;
+                size_ = original.size_;
 
                 return *this;
             }
@@ -171,6 +173,7 @@ namespace htd
             {
                 begin_ = std::move(original.begin_);
                 end_ = std::move(original.end_);
+                size_ = original.size_;
 
                 return *this;
             }
@@ -185,6 +188,7 @@ namespace htd
             {
                 begin_ = original.begin();
                 end_ = original.end();
+                size_ = original.size();
 
                 return *this;
             }
@@ -224,6 +228,20 @@ namespace htd
                 return ConstCollection<T>(std::begin(collection), std::end(collection), collection.size());
             }
 
+            /**
+             *  Create a new ConstCollection object wrapping the provided vector.
+             *
+             *  The iterators of the new collection point directly into the storage of the vector, so that iterating
+             *  the collection does not involve virtual function calls.
+             *
+             *  @param[in] collection   The vector which shall be wrapped.
+             */
+            template <typename Allocator>
+            static ConstCollection<T> getInstance(const std::vector<T, Allocator> & collection)
+            {
+                return ConstCollection<T>(htd::ConstIterator<T>(collection.data()), htd::ConstIterator<T>(collection.data() + collection.size()), collection.size());
+            }
+
         private:
             /**
              *  An iterator to the first element of the collection.
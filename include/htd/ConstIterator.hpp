@@ -36,6 +36,10 @@ namespace htd
 {
     /**
      *  Wrapper for iterators of immutable collections.
+     *
+     *  Iterators over contiguous storage (see ConstCollection::getInstance() and VectorAdapter) are represented by a
+     *  plain pointer, so that advancing, dereferencing, comparing and copying them does not require virtual function
+     *  calls or heap allocations. All other iterators are wrapped in a polymorphic base iterator.
      */
     template <typename T>
     class ConstIterator : public htd::ConstIteratorBase<T>
@@ -79,7 +83,7 @@ namespace htd
             /**
              *  Constructor for an iterator pointing nowhere.
              */
-            ConstIterator(void) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator(void) HTD_NOEXCEPT : baseIterator_(nullptr), position_(nullptr), owner_()
             {
 
             }
@@ -90,7 +94,28 @@ namespace htd
              *  @param[in] iterator The underlying iterator.
              */
             template <class Iter>
-            ConstIterator(Iter iterator) : baseIterator_(new htd::ConstIteratorWrapper<Iter, T>(iterator))
+            ConstIterator(Iter iterator) : baseIterator_(new htd::ConstIteratorWrapper<Iter, T>(iterator)), position_(nullptr), owner_()
+            {
+
+            }
+
+            /**
+             *  Constructor for an iterator pointing into contiguous storage.
+             *
+             *  @param[in] position The position of the iterator.
+             */
+            ConstIterator(const T * position) HTD_NOEXCEPT : baseIterator_(nullptr), position_(position), owner_()
+            {
+
+            }
+
+            /**
+             *  Constructor for an iterator pointing into contiguous storage.
+             *
+             *  @param[in] position The position of the iterator.
+             *  @param[in] owner    The object owning the storage which shall be kept alive as long as the iterator exists.
+             */
+            ConstIterator(const T * position, const std::shared_ptr<const void> & owner) HTD_NOEXCEPT : baseIterator_(nullptr), position_(position), owner_(owner)
             {
 
             }
@@ -104,7 +129,7 @@ namespace htd
              *  the new iterator wrapper. Deleting the base iterator outside the iterator wrapper or using the same base iterator in
              *  different iterator wrappers will lead to undefined behavior.
              */
-            ConstIterator(htd::ConstIteratorBase<T> * iterator) HTD_NOEXCEPT : baseIterator_(iterator)
+            ConstIterator(htd::ConstIteratorBase<T> * iterator) HTD_NOEXCEPT : baseIterator_(iterator), position_(nullptr), owner_()
             {
 
             }
@@ -114,7 +139,7 @@ namespace htd
              *
              *  @param[in] original  The original iterator.
              */
-            ConstIterator<T>(const ConstIterator<T> & original) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator<T>(const ConstIterator<T> & original) HTD_NOEXCEPT : baseIterator_(nullptr), position_(original.position_), owner_(original.owner_)
             {
                 if (original.baseIterator_ != nullptr)
                 {
@@ -127,7 +152,7 @@ namespace htd
              *
              *  @param[in] original  The original iterator.
              */
-            ConstIterator<T>(ConstIterator<T> && original) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator<T>(ConstIterator<T> && original) HTD_NOEXCEPT : baseIterator_(nullptr), position_(original.position_), owner_(std::move(original.owner_))
             {
                 if (original.baseIterator_ != nullptr)
                 {
@@ -156,6 +181,10 @@ namespace htd
                 {
                     ++(*baseIterator_);
                 }
+                else
+                {
+                    ++position_;
+                }
 
                 return *this;
             }
@@ -167,7 +196,7 @@ namespace htd
              */
             ConstIterator<T> operator++(int) HTD_NOEXCEPT
             {
-                ConstIterator<T> ret(*baseIterator_);
+                ConstIterator<T> ret(*this);
 
                 operator++();
 
@@ -193,6 +222,10 @@ namespace htd
                     baseIterator_ = original.baseIterator_->clone();
                 }
 
+                position_ = original.position_;
+
+                owner_ = original.owner_;
+
                 return *this;
             }
 
@@ -217,6 +250,10 @@ namespace htd
                     original.baseIterator_ = nullptr;
                 }
 
+                position_ = original.position_;
+
+                owner_ = std::move(original.owner_);
+
                 return *this;
             }
 
@@ -228,7 +265,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = o->baseIterator_ == nullptr;
+                    ret = o->baseIterator_ == nullptr && position_ == o->position_;
                 }
                 else if (o->baseIterator_ != nullptr)
                 {
@@ -251,7 +288,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = rhs.baseIterator_ == nullptr;
+                    ret = rhs.baseIterator_ == nullptr && position_ == rhs.position_;
                 }
                 else if (rhs.baseIterator_ != nullptr)
                 {
@@ -269,7 +306,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = o->baseIterator_ != nullptr;
+                    ret = o->baseIterator_ != nullptr || position_ != o->position_;
                 }
                 else if (o->baseIterator_ != nullptr)
                 {
@@ -292,7 +329,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = rhs.baseIterator_ != nullptr;
+                    ret = rhs.baseIterator_ != nullptr || position_ != rhs.position_;
                 }
                 else if (rhs.baseIterator_ != nullptr)
                 {
@@ -304,19 +341,19 @@ namespace htd
 
             const T * operator->(void) const HTD_OVERRIDE
             {
-                return baseIterator_->operator->();
+                return baseIterator_ != nullptr ? baseIterator_->operator->() : position_;
             }
 
             const T & operator*(void) const HTD_OVERRIDE
             {
-                return baseIterator_->operator*();
+                return baseIterator_ != nullptr ? baseIterator_->operator*() : *position_;
             }
 
             ConstIterator<T> * clone(void) const HTD_NOEXCEPT HTD_OVERRIDE
             {
                 ConstIterator<T> * ret = nullptr;
 
-                if (baseIterator_ == nullptr)
+                if (baseIterator_ == nullptr && position_ == nullptr)
                 {
                     return new ConstIterator<T>();
                 }
@@ -331,7 +368,17 @@ namespace htd
         private:
             htd::ConstIteratorBase<T> * baseIterator_;
 
-            ConstIterator<T>(const htd::ConstIteratorBase<T> & original) : baseIterator_(original.clone())
+            /**
+             *  The position of the iterator if it points into contiguous storage, nullptr otherwise.
+             */
+            const T * position_;
+
+            /**
+             *  The object owning the contiguous storage, if the iterator shall keep it alive.
+             */
+            std::shared_ptr<const void> owner_;
+
+            ConstIterator<T>(const htd::ConstIteratorBase<T> & original) : baseIterator_(original.clone()), position_(nullptr), owner_()
             {
 
             }
@@ -0,0 +1,307 @@
+/*
+ * File:   DenseIdentifierMap.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_DENSEIDENTIFIERMAP_HPP
+#define HTD_HTD_DENSEIDENTIFIERMAP_HPP
+
+#include <htd/Globals.hpp>
+
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Map from identifiers (e.g. vertex IDs) to values which is optimized for densely populated identifier ranges.
+     *
+     *  The identifiers are resolved via a vector of slot positions without hashing. The values themselves are stored
+     *  in a std::deque, i.e., in fixed-size blocks which are contiguous internally but not with respect to each other,
+     *  so that growing the map never moves existing values. Slots of removed identifiers are recycled via a free-list,
+     *  hence the memory consumed by a map subject to frequent insertions and removals is bounded by the maximum number
+     *  of values stored at the same time plus one slot position per identifier ever used.
+     *
+     *  @note References to values remain valid until the corresponding identifier is removed from the map, which is
+     *        relied upon by decompositions handing out references to bags while further nodes are added. Values which
+     *        own heap memory themselves, e.g. the vertex vectors of bags, keep that memory in separate allocations.
+     */
+    template <typename ValueType>
+    class DenseIdentifierMap
+    {
+        public:
+            /**
+             *  Constructor of a new, empty map.
+             */
+            DenseIdentifierMap(void) : positions_(), values_(), freeSlots_(), size_(0)
+            {
+
+            }
+
+            /**
+             *  Copy constructor of a map.
+             *
+             *  @param[in] original The original map.
+             */
+            DenseIdentifierMap(const DenseIdentifierMap<ValueType> & original) = default;
+
+            /**
+             *  Move constructor of a map.
+             *
+             *  @param[in] original The original map.
+             */
+            DenseIdentifierMap(DenseIdentifierMap<ValueType> && original) = default;
+
+            /**
+             *  Destructor of a map.
+             */
+            ~DenseIdentifierMap(void)
+            {
+
+            }
+
+            /**
+             *  Copy assignment operator for a map.
+             *
+             *  @param[in] original The original map.
+             */
+            DenseIdentifierMap<ValueType> & operator=(const DenseIdentifierMap<ValueType> & original) = default;
+
+            /**
+             *  Move assignment operator for a map.
+             *
+             *  @param[in] original The original map.
+             */
+            DenseIdentifierMap<ValueType> & operator=(DenseIdentifierMap<ValueType> && original) = default;
+
+            /**
+             *  Check whether the map is empty.
+             *
+             *  @return True if the map is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of values stored in the map.
+             *
+             *  @return The number of values stored in the map.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Get the number of values associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier of interest.
+             *
+             *  @return 1 if a value is associated with the given identifier, 0 otherwise.
+             */
+            std::size_t count(htd::id_t identifier) const
+            {
+                return identifier < positions_.size() && positions_[identifier] != UNUSED ? 1 : 0;
+            }
+
+            /**
+             *  Access the value associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier of interest. If no value is associated with it, std::out_of_range is thrown.
+             *
+             *  @return The value associated with the given identifier.
+             */
+            ValueType & at(htd::id_t identifier)
+            {
+                if (count(identifier) == 0)
+                {
+                    throw std::out_of_range("ValueType & htd::DenseIdentifierMap<ValueType>::at(htd::id_t)");
+                }
+
+                return values_[positions_[identifier]];
+            }
+
+            /**
+             *  Access the value associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier of interest. If no value is associated with it, std::out_of_range is thrown.
+             *
+             *  @return The value associated with the given identifier.
+             */
+            const ValueType & at(htd::id_t identifier) const
+            {
+                if (count(identifier) == 0)
+                {
+                    throw std::out_of_range("const ValueType & htd::DenseIdentifierMap<ValueType>::at(htd::id_t) const");
+                }
+
+                return values_[positions_[identifier]];
+            }
+
+            /**
+             *  Access the value associated with the given identifier and insert a default-constructed value if no such value exists.
+             *
+             *  @param[in] identifier   The identifier of interest.
+             *
+             *  @return The value associated with the given identifier.
+             */
+            ValueType & operator[](htd::id_t identifier)
+            {
+                if (count(identifier) == 0)
+                {
+                    emplace(identifier);
+                }
+
+                return values_[positions_[identifier]];
+            }
+
+            /**
+             *  Associate a new value with the given identifier, if no value is associated with it yet.
+             *
+             *  @param[in] identifier   The identifier of interest.
+             *  @param[in] arguments    The arguments forwarded to the constructor of the new value.
+             *
+             *  @return True if a new value was inserted, false if a value was already associated with the given identifier.
+             */
+            template <typename... Arguments>
+            bool emplace(htd::id_t identifier, Arguments &&... arguments)
+            {
+                bool ret = count(identifier) == 0;
+
+                if (ret)
+                {
+                    if (identifier >= positions_.size())
+                    {
+                        positions_.resize(identifier + 1, UNUSED);
+                    }
+
+                    if (freeSlots_.empty())
+                    {
+                        positions_[identifier] = values_.size();
+
+                        values_.emplace_back(std::forward<Arguments>(arguments)...);
+                    }
+                    else
+                    {
+                        positions_[identifier] = freeSlots_.back();
+
+                        freeSlots_.pop_back();
+
+                        values_[positions_[identifier]] = ValueType(std::forward<Arguments>(arguments)...);
+                    }
+
+                    ++size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Remove the value associated with the given identifier, if such a value exists.
+             *
+             *  The memory held by the removed value is released immediately and its slot is reused by subsequent insertions.
+             *
+             *  @param[in] identifier   The identifier of interest.
+             *
+             *  @return The number of removed values.
+             */
+            std::size_t erase(htd::id_t identifier)
+            {
+                std::size_t ret = count(identifier);
+
+                if (ret == 1)
+                {
+                    htd::index_t slot = positions_[identifier];
+
+                    values_[slot] = ValueType();
+
+                    freeSlots_.push_back(slot);
+
+                    positions_[identifier] = UNUSED;
+
+                    --size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Remove all values from the map.
+             */
+            void clear(void)
+            {
+                positions_.clear();
+
+                values_.clear();
+
+                freeSlots_.clear();
+
+                size_ = 0;
+            }
+
+            /**
+             *  Reserve the memory required for identifiers less than the given bound.
+             *
+             *  @param[in] identifierBound  The exclusive upper bound of the identifiers which are expected to be stored in the map.
+             */
+            void reserve(htd::id_t identifierBound)
+            {
+                positions_.reserve(identifierBound);
+            }
+
+        private:
+            /**
+             *  Slot position marking an identifier without associated value.
+             */
+            static const htd::index_t UNUSED = std::numeric_limits<htd::index_t>::max();
+
+            /**
+             *  The slot positions of the values, indexed by their identifier.
+             */
+            std::vector<htd::index_t> positions_;
+
+            /**
+             *  The slots holding the values. A deque instead of a vector is used so that growing the map does not invalidate references to existing values.
+             */
+            std::deque<ValueType> values_;
+
+            /**
+             *  The positions of the slots which are currently unused.
+             */
+            std::vector<htd::index_t> freeSlots_;
+
+            /**
+             *  The number of values stored in the map.
+             */
+            std::size_t size_;
+    };
+
+    template <typename ValueType>
+    const htd::index_t DenseIdentifierMap<ValueType>::UNUSED;
+}
+
+#endif /* HTD_HTD_DENSEIDENTIFIERMAP_HPP */
@@ -31,6 +31,11 @@ namespace htd
 {
     /**
      *  Implementation of the IMaxFlowAlgorithm interface based on Yefim Dinitz's algorithm.
+     *
+     *  The algorithm operates on a sparse residual graph in which each edge of the flow network is paired with a
+     *  reverse arc. Each phase computes the level graph via breadth-first search and augments a blocking flow via
+     *  depth-first search using the current-arc technique, hence the memory consumption is linear in the number of
+     *  vertices and edges of the flow network.
      */
     class DinitzMaxFlowAlgorithm : public htd::IMaxFlowAlgorithm
     {
@@ -50,6 +55,36 @@ namespace htd
 
             HTD_API htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE;
 
+            /**
+             *  Determine the maximum flow between the source and the target vertex in the given flow network, but stop
+             *  as soon as the value of the flow reaches the given limit.
+             *
+             *  @param[in] flowNetwork  The flow network.
+             *  @param[in] source       The source vertex.
+             *  @param[in] target       The target vertex.
+             *  @param[in] limit        The flow value at which the computation shall stop.
+             *
+             *  @return A flow between the source and the target vertex. If its value is less than the given limit, it is a maximum flow.
+             */
+            HTD_API htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t limit) const;
+
+            /**
+             *  Determine the maximum flow between the source and the target vertex in the given flow network, starting
+             *  from the given flow, but stop as soon as the value of the flow reaches the given limit.
+             *
+             *  This allows to re-use the flow of a previous computation after the capacities of the flow network were
+             *  increased or after edges were added to it.
+             *
+             *  @param[in] flowNetwork  The flow network.
+             *  @param[in] source       The source vertex.
+             *  @param[in] target       The target vertex.
+             *  @param[in] limit        The flow value at which the computation shall stop.
+             *  @param[in] initialFlow  The flow from which the computation shall start or nullptr to start from the empty flow. The flow must have the same source and target vertex and it must respect the capacities of the given flow network.
+             *
+             *  @return A flow between the source and the target vertex. If its value is less than the given limit, it is a maximum flow.
+             */
+            HTD_API htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t limit, const htd::IFlow * initialFlow) const;
+
             HTD_API DinitzMaxFlowAlgorithm * clone(void) const HTD_OVERRIDE;
 
         private:
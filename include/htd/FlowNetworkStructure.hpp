@@ -31,6 +31,9 @@ namespace htd
 {
     /**
      *  Default implementation of the IFlowNetworkStructure interface.
+     *
+     *  The capacities are stored alongside the directed neighborhood of each vertex, hence the memory consumption
+     *  is linear in the number of vertices and edges of the flow network.
      */
     class FlowNetworkStructure : public htd::IFlowNetworkStructure
     {
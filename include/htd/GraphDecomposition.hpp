@@ -26,12 +26,11 @@
 #define HTD_HTD_GRAPHDECOMPOSITION_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/DenseIdentifierMap.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/IMutableGraphDecomposition.hpp>
 #include <htd/LabeledMultiHypergraph.hpp>
 
-#include <unordered_map>
-
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
 
@@ -150,9 +149,9 @@ namespace htd
 #endif
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
+            htd::DenseIdentifierMap<std::vector<htd::vertex_t>> bagContent_;
 
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            htd::DenseIdentifierMap<htd::FilteredHyperedgeCollection> inducedEdges_;
     };
 }
 
@@ -51,7 +51,7 @@ namespace htd
             /**
              *  Set the preprocessing strategy which shall be used.
              *
-             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + retain only largest biconnected component)
+             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3 or more: full, including the separation of the graph into atoms along articulation points and clique minimal separators)
              */
             HTD_API void setPreprocessingStrategy(std::size_t level);
 
@@ -91,10 +91,41 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which are used to order the atoms of the input graph.
+             *
+             *  @return The number of worker threads which are used to order the atoms of the input graph.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to order the atoms of the input graph (1=sequential, 0=number of hardware threads).
+             *
+             *  @note The input graph is only split into atoms when the full preprocessing strategy is selected.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to order the atoms of the input graph.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            /**
+             *  Getter for the maximum number of remaining vertices for which the input graph is split along its clique minimal separators.
+             *
+             *  @return The maximum number of remaining vertices for which the input graph is split along its clique minimal separators.
+             */
+            HTD_API std::size_t cliqueSeparatorVertexLimit(void) const;
+
+            /**
+             *  Set the maximum number of remaining vertices for which the input graph shall be split along its clique minimal separators (0=never).
+             *
+             *  @note Computing the clique minimal separators takes quadratic time, hence larger graphs are only split along their articulation points. The limit is only relevant when the full preprocessing strategy is selected.
+             *
+             *  @param[in] cliqueSeparatorVertexLimit   The maximum number of remaining vertices for which the input graph shall be split along its clique minimal separators.
+             */
+            HTD_API void setCliqueSeparatorVertexLimit(std::size_t cliqueSeparatorVertexLimit);
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination
-             *  ordering of the remainder of the input graph when only the largest biconnected
-             *  component is retained.
+             *  ordering of the atoms which are split off from the input graph.
              *
              *  @param[in] algorithm    The ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
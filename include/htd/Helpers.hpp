@@ -39,13 +39,16 @@
 #include <cassert>
 #include <functional>
 #include <chrono>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -325,14 +328,107 @@ namespace htd
         }
     }
 
+    /**
+     *  Access the pseudo-random number generator of the calling thread.
+     *
+     *  Each thread owns a separate generator so that randomized algorithms can run concurrently without
+     *  sharing hidden global state. A generator which was never seeded explicitly uses a fixed default seed.
+     *
+     *  @return The pseudo-random number generator of the calling thread.
+     */
+    HTD_API std::mt19937 & randomNumberGenerator(void);
+
+    /**
+     *  Seed the pseudo-random number generator of the calling thread.
+     *
+     *  @param[in] seed The new seed of the pseudo-random number generator of the calling thread.
+     */
+    HTD_API void seedRandomNumberGenerator(std::uint_fast32_t seed);
+
+    /**
+     *  Derive the seed of an independent random stream from a base seed.
+     *
+     *  The derived seed only depends on the given arguments, hence parallel computations which seed their
+     *  generator with the derived seed of each unit of work are reproducible independent of scheduling.
+     *
+     *  @param[in] seed         The base seed.
+     *  @param[in] streamIndex  The index of the random stream.
+     *
+     *  @return The seed of the random stream with the given index.
+     */
+    HTD_API std::uint_fast32_t deriveRandomSeed(std::uint_fast32_t seed, std::size_t streamIndex);
+
+    /**
+     *  Guard which restores the state of the pseudo-random number generator of the calling thread on destruction.
+     *
+     *  Parallel computations re-seed the generator of each participating thread, including the calling one, for
+     *  every unit of work. The guard ensures that the caller observes the same generator state afterwards, even
+     *  if the computation is left via an exception.
+     */
+    class RandomNumberGeneratorGuard
+    {
+        public:
+            /**
+             *  Constructor for a new guard which saves the current state of the generator of the calling thread.
+             */
+            RandomNumberGeneratorGuard(void) : state_(htd::randomNumberGenerator())
+            {
+
+            }
+
+            /**
+             *  Destructor of the guard which restores the saved state of the generator of the calling thread.
+             */
+            ~RandomNumberGeneratorGuard()
+            {
+                htd::randomNumberGenerator() = state_;
+            }
+
+            /**
+             *  Copy constructor for the guard.
+             *
+             *  @param[in] original The original guard which shall be copied.
+             */
+            RandomNumberGeneratorGuard(const RandomNumberGeneratorGuard & original) = delete;
+
+            /**
+             *  Copy assignment operator for the guard.
+             *
+             *  @param[in] original The original guard which shall be copied.
+             */
+            RandomNumberGeneratorGuard & operator=(const RandomNumberGeneratorGuard & original) = delete;
+
+        private:
+            /**
+             *  The saved state of the generator of the calling thread.
+             */
+            std::mt19937 state_;
+    };
+
+    /**
+     *  Draw a uniformly distributed index using the pseudo-random number generator of the calling thread.
+     *
+     *  @param[in] size The number of available indices. The value must be greater than zero.
+     *
+     *  @return A pseudo-random index in the range [0, size).
+     */
+    HTD_API std::size_t selectRandomIndex(std::size_t size);
+
+    /**
+     *  Select a random element of a non-empty collection.
+     *
+     *  @note The selection takes constant time for collections providing random-access iterators.
+     *
+     *  @param[in] collection   The collection from which an element shall be selected.
+     *
+     *  @return A reference to the selected element.
+     */
     template < typename T, typename Collection >
     const T & selectRandomElement(const Collection & collection)
     {
         auto position = collection.begin();
 
-        /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-        // coverity[dont_call]
-        std::advance(position, std::rand() % collection.size());
+        std::advance(position, selectRandomIndex(collection.size()));
 
         return *position;
     }
@@ -393,6 +489,86 @@ namespace htd
 
     HTD_API std::pair<std::size_t, std::size_t> symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
 
+    /**
+     *  Type trait indicating whether an iterator refers to a contiguous array of vertices.
+     *
+     *  Set operations on ranges of such iterators are forwarded to the vectorized implementations.
+     */
+    template < typename Iterator >
+    struct is_contiguous_vertex_iterator : public std::integral_constant<bool, std::is_same<Iterator, std::vector<htd::vertex_t>::iterator>::value ||
+                                                                              std::is_same<Iterator, std::vector<htd::vertex_t>::const_iterator>::value ||
+                                                                              std::is_same<Iterator, htd::vertex_t *>::value ||
+                                                                              std::is_same<Iterator, const htd::vertex_t *>::value>
+    {
+
+    };
+
+    /**
+     *  Compute the size of the intersection of two sets of vertices.
+     *
+     *  @note Depending on the capabilities of the CPU, the computation uses SSE4.2 or AVX2 instructions. If one of
+     *  the sets is much smaller than the other one, the elements of the smaller set are located in the larger set
+     *  via exponential search instead.
+     *
+     *  @param[in] first1   A pointer to the first element of the first set of vertices, sorted in ascending order and free of duplicates.
+     *  @param[in] last1    A pointer past the last element of the first set of vertices.
+     *  @param[in] first2   A pointer to the first element of the second set of vertices, sorted in ascending order and free of duplicates.
+     *  @param[in] last2    A pointer past the last element of the second set of vertices.
+     *
+     *  @return The number of vertices contained in both sets.
+     */
+    HTD_API std::size_t set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                              const htd::vertex_t * first2, const htd::vertex_t * last2);
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::false_type)
+    {
+        std::size_t ret = 0;
+
+        while (first1 != last1 && first2 != last2)
+        {
+            if (*first1 < *first2)
+            {
+                ++first1;
+            } 
+            else
+            {
+                if (*first1 == *first2)
+                {
+                    ++ret;
+
+                    ++first1;
+                }
+
+                ++first2;
+            }
+        }
+        
+        return ret;
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::true_type)
+    {
+        std::size_t ret = 0;
+
+        if (first1 != last1 && first2 != last2)
+        {
+            const htd::vertex_t * begin1 = &(*first1);
+            const htd::vertex_t * begin2 = &(*first2);
+
+            ret = htd::set_intersection_size(begin1, begin1 + std::distance(first1, last1), begin2, begin2 + std::distance(first2, last2));
+        }
+
+        return ret;
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
@@ -434,7 +610,19 @@ namespace htd
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
-                                    InputIterator2 first2, InputIterator2 last2)
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::true_type)
+    {
+        std::size_t size1 = static_cast<std::size_t>(std::distance(first1, last1));
+
+        return size1 - htd::set_intersection_size(first1, last1, first2, last2, std::true_type());
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::false_type)
     {
         std::size_t ret = 0;
 
@@ -460,33 +648,48 @@ namespace htd
         return ret + std::distance(first1, last1);
     }
 
+    /**
+     *  Compute the number of elements of the first set which are not contained in the second set.
+     *
+     *  @note If both sets are stored in contiguous arrays of vertices, the computation is based on the vectorized version of htd::set_intersection_size.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set, sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set.
+     *  @param[in] first2   An iterator to the begin of the second set, sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set.
+     *
+     *  @return The number of elements of the first set which are not contained in the second set.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2)
+    {
+        return htd::set_difference_size(first1, last1, first2, last2,
+                                        std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                     htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
+    }
+
+    /**
+     *  Compute the number of elements contained in both sets.
+     *
+     *  @note If both sets are stored in contiguous arrays of vertices, the vectorized version of htd::set_intersection_size is used.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set, sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set.
+     *  @param[in] first2   An iterator to the begin of the second set, sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set.
+     *
+     *  @return The number of elements contained in both sets.
+     */
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
                                       InputIterator2 first2, InputIterator2 last2)
     {
-        std::size_t ret = 0;
-
-        while (first1 != last1 && first2 != last2)
-        {
-            if (*first1 < *first2)
-            {
-                ++first1;
-            } 
-            else
-            {
-                if (*first1 == *first2)
-                {
-                    ++ret;
-
-                    ++first1;
-                }
-
-                ++first2;
-            }
-        }
-        
-        return ret;
+        return htd::set_intersection_size(first1, last1, first2, last2,
+                                          std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                       htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
     }
 
     template < class InputIterator1,
@@ -547,6 +750,16 @@ namespace htd
         return ret;
     }
 
+    /**
+     *  Merge a sorted vector into another sorted vector.
+     *
+     *  @note The vectors are merged from the back, so no temporary buffer is required. If the second vector is much
+     *  smaller than the first one, the insertion points are determined via binary search and the elements of the
+     *  first vector are moved block-wise.
+     *
+     *  @param[in,out] set1 The vector into which the elements of the second vector shall be merged, sorted in ascending order.
+     *  @param[in] set2     The vector whose elements shall be merged into the first vector, sorted in ascending order.
+     */
     template < typename T >
     void inplace_merge(std::vector<T> & set1, const std::vector<T> & set2)
     {
@@ -554,20 +767,54 @@ namespace htd
         {
             auto it = set1.begin();
 
-            for (htd::vertex_t newElement : set2)
+            for (const T & newElement : set2)
             {
                 it = set1.insert(std::lower_bound(it, set1.end(), newElement), newElement) + 1;
             }
         }
         else
         {
-            std::size_t middle = set1.size();
+            std::size_t size1 = set1.size();
+
+            set1.resize(size1 + set2.size());
+
+            auto first1 = set1.begin();
+            auto last1 = set1.begin() + size1;
+
+            auto first2 = set2.begin();
+            auto last2 = set2.end();
+
+            auto position = set1.end();
+
+            if (set2.size() * 8 < size1)
+            {
+                while (last2 != first2)
+                {
+                    --last2;
+
+                    auto insertionPoint = std::upper_bound(first1, last1, *last2);
+
+                    position = std::move_backward(insertionPoint, last1, position);
 
-            set1.insert(set1.end(), set2.begin(), set2.end());
+                    last1 = insertionPoint;
 
-            std::inplace_merge(set1.begin(),
-                               set1.begin() + middle,
-                               set1.end());
+                    *(--position) = *last2;
+                }
+            }
+            else
+            {
+                while (last2 != first2)
+                {
+                    if (last1 != first1 && *(last2 - 1) < *(last1 - 1))
+                    {
+                        *(--position) = std::move(*(--last1));
+                    }
+                    else
+                    {
+                        *(--position) = *(--last2);
+                    }
+                }
+            }
         }
     }
 
@@ -116,6 +116,20 @@ namespace htd
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of worker threads which shall be used to compute the set covers of the bags.
+             *
+             *  @return The number of worker threads which shall be used to compute the set covers of the bags.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to compute the set covers of the bags (1=sequential, 0=number of hardware threads).
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to compute the set covers of the bags.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
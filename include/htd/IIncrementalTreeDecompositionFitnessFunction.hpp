@@ -0,0 +1,94 @@
+/*
+ * File:   IIncrementalTreeDecompositionFitnessFunction.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_IINCREMENTALTREEDECOMPOSITIONFITNESSFUNCTION_HPP
+#define HTD_HTD_IINCREMENTALTREEDECOMPOSITIONFITNESSFUNCTION_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionFitnessFunction.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Interface for fitness functions which can be computed from summaries of the subtrees of a tree decomposition.
+     *
+     *  The summary of a subtree is computed bottom-up from the summaries of the subtrees below its root. This allows
+     *  to evaluate the fitness of the decomposition for each possible root in linear time by re-rooting the summaries.
+     *  Implementations have to ensure that evaluating the summary of the whole tree yields the same result as the
+     *  method fitness(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &) for the respective root.
+     */
+    class IIncrementalTreeDecompositionFitnessFunction : public virtual htd::ITreeDecompositionFitnessFunction
+    {
+        public:
+            virtual ~IIncrementalTreeDecompositionFitnessFunction() = 0;
+
+            /**
+             *  Initialize the combined summary of an empty set of subtrees.
+             *
+             *  @param[out] summary The summary which shall be initialized.
+             */
+            virtual void initializeSummary(std::vector<double> & summary) const = 0;
+
+            /**
+             *  Combine two summaries.
+             *
+             *  @note The combination has to be associative and commutative and the initial summary has to be its neutral element.
+             *
+             *  @param[in,out] summary  The summary which shall be updated.
+             *  @param[in] otherSummary The summary which shall be combined with the given summary.
+             */
+            virtual void combineSummaries(std::vector<double> & summary, const std::vector<double> & otherSummary) const = 0;
+
+            /**
+             *  Compute the summary of the subtree rooted at the given node.
+             *
+             *  @note The summary may only depend on the node itself and on the combined summary of its children. The current
+             *  parent and children of the node within the decomposition must not be accessed, because the summary is also
+             *  requested for subtrees which are only present after re-rooting the decomposition.
+             *
+             *  @param[in] graph            The graph from which the decomposition was computed.
+             *  @param[in] decomposition    The tree decomposition containing the node.
+             *  @param[in] node             The root of the subtree.
+             *  @param[in] childSummary     The combined summary of all subtrees below the given node.
+             *  @param[out] summary         The summary of the subtree rooted at the given node.
+             */
+            virtual void computeSummary(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t node, const std::vector<double> & childSummary, std::vector<double> & summary) const = 0;
+
+            /**
+             *  Compute the fitness evaluation of a tree decomposition based on the summary of the whole tree.
+             *
+             *  @param[in] summary  The summary of the subtree rooted at the root of the decomposition.
+             *
+             *  @return The fitness evaluation of the tree decomposition.
+             */
+            virtual htd::FitnessEvaluation * evaluateSummary(const std::vector<double> & summary) const = 0;
+    };
+
+    inline htd::IIncrementalTreeDecompositionFitnessFunction::~IIncrementalTreeDecompositionFitnessFunction() { }
+}
+
+#endif /* HTD_HTD_IINCREMENTALTREEDECOMPOSITIONFITNESSFUNCTION_HPP */
@@ -27,8 +27,11 @@
 
 #include <htd/Globals.hpp>
 
+#include <htd/AdjacencyArray.hpp>
 #include <htd/IGraphStructure.hpp>
 
+#include <memory>
+
 namespace htd
 {
     /**
@@ -76,6 +79,19 @@ namespace htd
              */
             virtual htd::vertex_t vertexName(htd::vertex_t vertex) const = 0;
 
+            /**
+             *  Getter for the immutable adjacency array containing the preprocessed neighborhood of each of the vertices.
+             *
+             *  The adjacency array stores all neighborhoods in two contiguous arrays and is the preferred source
+             *  for algorithms which only read the neighborhoods or which modify them via a NeighborhoodWorkingSet.
+             *
+             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
+             *
+             *  @return The immutable adjacency array containing the preprocessed neighborhood of each of the vertices. The caller
+             *          shares ownership of the array, hence it remains valid even if the preprocessed graph is modified afterwards.
+             */
+            virtual std::shared_ptr<const htd::AdjacencyArray> adjacencyArray(void) const = 0;
+
             /**
              *  Getter for the vector containing the preprocessed neighborhood of each of the vertices.
              *
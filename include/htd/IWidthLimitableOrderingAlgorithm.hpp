@@ -29,6 +29,8 @@
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IWidthLimitedVertexOrdering.hpp>
 
+#include <functional>
+
 namespace htd
 {
     /**
@@ -64,6 +66,25 @@ namespace htd
              */
             virtual htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT = 0;
 
+            /**
+             *  Compute the vertex ordering of a given graph with respect to an upper bound which may be tightened while the ordering is computed.
+             *
+             *  Implementations re-evaluate the bound after each eliminated vertex, so that an ordering which already exceeds a bound
+             *  tightened concurrently, e.g. by another worker thread, is abandoned early. The default implementation evaluates the
+             *  bound only once.
+             *
+             *  @param[in] graph                The input graph for which the vertex ordering shall be computed.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] maxBagSize           A function returning the current upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+             *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which an empty ordering is returned.
+             *
+             *  @return The vertex ordering of the given graph.
+             */
+            virtual htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+            {
+                return computeOrdering(graph, preprocessedGraph, maxBagSize(), maxIterationCount);
+            }
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             /**
              *  Create a deep copy of the current ordering algorithm.
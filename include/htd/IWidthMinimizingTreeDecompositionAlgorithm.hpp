@@ -192,6 +192,37 @@ namespace htd
                                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                            const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const = 0;
 
+            /**
+             *  Compute a decomposition of the given graph with respect to an upper bound which may be tightened during the computation and apply the given manipulation operations to it.
+             *
+             *  Implementations pass the bound on to the orderings they compute, so that an ordering which already exceeds a bound
+             *  tightened by another thread is abandoned early. The default implementation evaluates the bound only once.
+             *
+             *  @param[in] graph                    The input graph to decompose.
+             *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+             *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
+             *  @param[in] maxBagSize               A function returning the current upper bound for the maximum bag size of the computed decomposition.
+             *
+             *  @note The maximum bag size of the computed decomposition must be less than or equal to the upper bound at the time the decomposition was found.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            virtual htd::ITreeDecomposition * computeImprovedDecomposition(const htd::IMultiHypergraph & graph,
+                                                                           const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                           const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                           const std::function<std::size_t(void)> & maxBagSize) const
+            {
+                return computeImprovedDecomposition(graph, preprocessedGraph, manipulationOperations, progressCallback, maxBagSize());
+            }
+
             virtual IWidthMinimizingTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE = 0;
     };
 
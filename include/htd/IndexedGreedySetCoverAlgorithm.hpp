@@ -0,0 +1,112 @@
+/*
+ * File:   IndexedGreedySetCoverAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_INDEXEDGREEDYSETCOVERALGORITHM_HPP
+#define HTD_HTD_INDEXEDGREEDYSETCOVERALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ISetCoverAlgorithm.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ISetCoverAlgorithm interface based on greedy search with the help of an inverted index.
+     *
+     *  The algorithm maps each element to the containers including it, so that only containers sharing at least one
+     *  element with the set to cover are considered. The number of uncovered elements of each relevant container is
+     *  kept in a bucket queue which is updated incrementally whenever an element gets covered. The result is identical
+     *  to the one of htd::GreedySetCoverAlgorithm.
+     *
+     *  When many sets shall be covered by the same collection of containers (e.g. all bags of a decomposition by the
+     *  hyperedges of a graph), the inverted index can be built once via setContainers() and reused by subsequent calls
+     *  of computeSetCover(elements, target).
+     *
+     *  @note The algorithm re-uses internal buffers between calls, hence a single instance must not be used by multiple threads concurrently.
+     */
+    class IndexedGreedySetCoverAlgorithm : public htd::ISetCoverAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new set-cover algorithm of type IndexedGreedySetCoverAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API IndexedGreedySetCoverAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a set-cover algorithm of type IndexedGreedySetCoverAlgorithm.
+             *
+             *  @param[in] original  The original set-cover algorithm.
+             */
+            HTD_API IndexedGreedySetCoverAlgorithm(const htd::IndexedGreedySetCoverAlgorithm & original);
+
+            HTD_API virtual ~IndexedGreedySetCoverAlgorithm();
+
+            HTD_API void computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE;
+
+            HTD_API void computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE;
+
+            /**
+             *  Set the collection of containers which shall be used by computeSetCover(elements, target) and build its inverted index.
+             *
+             *  @param[in] containers   The collection of containers which are available for covering sets of elements.
+             *
+             *  @note All vectors stored in the argument 'containers' must be sorted and must not contain duplicates, otherwise the result of computeSetCover(elements, target) is undefined.
+             */
+            HTD_API void setContainers(const std::vector<std::vector<htd::id_t>> & containers);
+
+            /**
+             *  Compute a set cover of the given elements using the collection of containers provided via setContainers().
+             *
+             *  @param[in] elements     The set of elements which must be covered.
+             *  @param[out] target      The target vector to which the indices of the covering containers shall be appended.
+             *
+             *  @note The vector 'elements' must be sorted and must not contain duplicates, otherwise the result of this method is undefined.
+             */
+            HTD_API void computeSetCover(const std::vector<htd::id_t> & elements, std::vector<htd::index_t> & target) const;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API IndexedGreedySetCoverAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a set cover algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            HTD_API IndexedGreedySetCoverAlgorithm & operator=(const IndexedGreedySetCoverAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_INDEXEDGREEDYSETCOVERALGORITHM_HPP */
@@ -48,6 +48,12 @@ namespace htd
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithm and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
+     *
+     *  @note If the thread count is set to a value greater than one, the iterations are distributed among worker
+     *  threads which operate on their own clones of the base algorithm, the fitness function and the manipulation
+     *  operations. The iteration count and the non-improvement limit are applied to the iterations of all workers
+     *  together. In this mode, the progress callback is only invoked for decompositions improving the best fitness
+     *  found so far, i.e., the reported fitness values are strictly increasing.
      */
     class IterativeImprovementTreeDecompositionAlgorithm : public htd::ICustomizedTreeDecompositionAlgorithm
     {
@@ -187,6 +193,20 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which shall be used to perform the iterations.
+             *
+             *  @return The number of worker threads which shall be used to perform the iterations.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to perform the iterations (1=sequential, 0=number of hardware threads).
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to perform the iterations.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
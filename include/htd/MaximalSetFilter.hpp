@@ -0,0 +1,111 @@
+/*
+ * File:   MaximalSetFilter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_MAXIMALSETFILTER_HPP
+#define HTD_HTD_MAXIMALSETFILTER_HPP
+
+#include <htd/Globals.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Filter which determines the sets of a collection which are not a subset of any other set of the collection.
+     *
+     *  The sets are visited in descending order of their size and each set is compared only against the maximal sets
+     *  found so far which contain its rarest element, i.e., the element contained in the smallest number of maximal
+     *  sets found so far. These candidates are retrieved via an inverted index. Optionally, a 64-bit signature of each
+     *  set is used to reject most of the candidates before the actual subset test.
+     *
+     *  Among multiple identical sets, only the one with the largest index is considered maximal.
+     */
+    class MaximalSetFilter
+    {
+        public:
+            /**
+             *  Constructor for a new maximal set filter.
+             */
+            HTD_API MaximalSetFilter(void);
+
+            /**
+             *  Copy constructor for a maximal set filter.
+             *
+             *  @param[in] original  The original maximal set filter.
+             */
+            HTD_API MaximalSetFilter(const htd::MaximalSetFilter & original);
+
+            /**
+             *  Destructor of a maximal set filter.
+             */
+            HTD_API virtual ~MaximalSetFilter();
+
+            /**
+             *  Determine the maximal sets of the given collection.
+             *
+             *  @param[in] sets     The collection of sets.
+             *  @param[out] target  The target vector to which the indices of the maximal sets shall be appended in ascending order.
+             *
+             *  @note All vectors stored in the argument 'sets' must be sorted and must not contain duplicates, otherwise the result of this method is undefined.
+             */
+            HTD_API void computeMaximalSets(const std::vector<std::vector<htd::id_t>> & sets, std::vector<htd::index_t> & target) const;
+
+            /**
+             *  Check whether the signature-based rejection of candidates is enabled.
+             *
+             *  @return True if the signature-based rejection of candidates is enabled, false otherwise.
+             */
+            HTD_API bool isSignatureCheckEnabled(void) const;
+
+            /**
+             *  Set whether the signature-based rejection of candidates shall be enabled.
+             *
+             *  @param[in] signatureCheckEnabled    A boolean flag indicating whether the signature-based rejection of candidates shall be enabled.
+             */
+            HTD_API void setSignatureCheckEnabled(bool signatureCheckEnabled);
+
+            /**
+             *  Create a deep copy of the current maximal set filter.
+             *
+             *  @return A new MaximalSetFilter object identical to the current maximal set filter.
+             */
+            HTD_API MaximalSetFilter * clone(void) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for a maximal set filter.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized filter.
+             */
+            MaximalSetFilter & operator=(const MaximalSetFilter &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_MAXIMALSETFILTER_HPP */
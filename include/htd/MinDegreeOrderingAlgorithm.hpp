@@ -53,6 +53,25 @@ namespace htd
 
             HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Check whether a bucket priority queue is used for selecting the vertex which is eliminated next.
+             *
+             *  @return True if a bucket priority queue is used for selecting the vertex which is eliminated next, false otherwise.
+             */
+            HTD_API bool isBucketPriorityQueueEnabled(void) const;
+
+            /**
+             *  Set whether a bucket priority queue shall be used for selecting the vertex which is eliminated next.
+             *
+             *  @note The bucket priority queue (see htd::BucketPriorityQueue) updates the priority of a vertex in constant
+             *  time, but its memory consumption is linear in the largest priority which is ever assigned to a vertex.
+             *
+             *  @param[in] bucketPriorityQueueEnabled   A boolean flag whether a bucket priority queue shall be used for selecting the vertex which is eliminated next.
+             */
+            HTD_API void setBucketPriorityQueueEnabled(bool bucketPriorityQueueEnabled);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -31,6 +31,13 @@ namespace htd
 {
     /**
      *  Implementation of the IGraphSeparatorAlgorithm interface which computes minimimal separating vertex sets.
+     *
+     *  The separator is determined via maximum flows between source/sink pairs of non-adjacent vertices. Following
+     *  Even's algorithm, only as many sources as the size of the best known separator plus one are considered,
+     *  visited in ascending order of their degree, and the sinks of each source are visited in descending order of
+     *  their distance from the source. Each maximum flow computation stops as soon as the flow value shows that the
+     *  current source/sink pair cannot yield a better separator. The sinks of a source may be evaluated by multiple
+     *  worker threads in parallel.
      */
     class MinimumSeparatorAlgorithm : public htd::IGraphSeparatorAlgorithm
     {
@@ -42,6 +49,13 @@ namespace htd
              */
             HTD_API MinimumSeparatorAlgorithm(const htd::LibraryInstance * const manager);
 
+            /**
+             *  Copy constructor for a minimum separator algorithm.
+             *
+             *  @param[in] original  The original minimum separator algorithm.
+             */
+            HTD_API MinimumSeparatorAlgorithm(const htd::MinimumSeparatorAlgorithm & original);
+
             /**
              *  Destructor of a minimum separator algorithm.
              */
@@ -49,6 +63,43 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> * computeSeparator(const htd::IGraphStructure & graph) const HTD_OVERRIDE;
 
+            /**
+             *  Check whether the balanced separator mode is enabled.
+             *
+             *  In balanced separator mode, the algorithm does not minimize the size of the separator, but the size of the
+             *  separator plus the size of the largest connected component remaining after removing the separator, i.e.,
+             *  the size of the largest bag resulting from splitting the graph along the separator.
+             *
+             *  @return True if the balanced separator mode is enabled, false otherwise.
+             */
+            HTD_API bool isBalancedSeparatorModeEnabled(void) const;
+
+            /**
+             *  Set whether the balanced separator mode shall be enabled.
+             *
+             *  @param[in] balancedSeparatorModeEnabled A boolean flag indicating whether the balanced separator mode shall be enabled.
+             */
+            HTD_API void setBalancedSeparatorModeEnabled(bool balancedSeparatorModeEnabled);
+
+            /**
+             *  Getter for the number of worker threads which shall be used to evaluate the source/sink pairs.
+             *
+             *  @return The number of worker threads which shall be used to evaluate the source/sink pairs.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to evaluate the source/sink pairs (1=sequential, 0=number of hardware threads).
+             *
+             *  The sinks of each source are distributed among the worker threads and the score of the best separator found
+             *  so far is shared between them, so that each maximum flow computation is bounded by the best result of all
+             *  threads. Ties between separators of equal score are broken by the order in which the source/sink pairs are
+             *  visited, hence the result does not depend on the number of worker threads.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to evaluate the source/sink pairs.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
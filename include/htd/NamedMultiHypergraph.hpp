@@ -151,6 +151,18 @@ namespace htd
                 names_.setEdgeName(edgeId, name);
             }
 
+            /**
+             *  Check whether a name is associated with the given edge.
+             *
+             *  @param[in] edgeId   The ID of the edge.
+             *
+             *  @return True if a name is associated with the given edge, false otherwise.
+             */
+            bool isNamedEdge(htd::id_t edgeId) const
+            {
+                return names_.isNamedEdge(edgeId);
+            }
+
             /**
              *  Access the name associated with the given vertex.
              *
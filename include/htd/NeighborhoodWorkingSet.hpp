@@ -0,0 +1,161 @@
+/*
+ * File:   NeighborhoodWorkingSet.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_NEIGHBORHOODWORKINGSET_HPP
+#define HTD_HTD_NEIGHBORHOODWORKINGSET_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/AdjacencyArray.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Copy-on-write view of the neighborhoods stored in an adjacency array.
+     *
+     *  The neighborhood of a vertex is copied from the underlying adjacency array into a private vector the
+     *  first time it is accessed for modification. Until then, read accesses are answered directly by the
+     *  adjacency array. Creating a working set therefore does not require a heap allocation per vertex and
+     *  vertices which are never modified, e.g., vertices outside the currently processed component, are
+     *  never copied.
+     *
+     *  @note The underlying adjacency array must outlive the working set.
+     */
+    class NeighborhoodWorkingSet
+    {
+        public:
+            /**
+             *  Constructor for a new working set.
+             *
+             *  @param[in] adjacencyArray   The adjacency array providing the initial neighborhood of each vertex.
+             */
+            NeighborhoodWorkingSet(const htd::AdjacencyArray & adjacencyArray) : adjacencyArray_(adjacencyArray), neighborhood_(adjacencyArray.vertexCount()), modified_(adjacencyArray.vertexCount(), false)
+            {
+
+            }
+
+            /**
+             *  Destructor of a working set.
+             */
+            ~NeighborhoodWorkingSet(void)
+            {
+
+            }
+
+            /**
+             *  Check whether the neighborhood of a vertex was already copied for modification.
+             *
+             *  @param[in] vertex   The vertex which shall be checked.
+             *
+             *  @return True if the neighborhood of the given vertex was already copied for modification, false otherwise.
+             */
+            bool isModified(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < modified_.size())
+
+                return modified_[vertex];
+            }
+
+            /**
+             *  Getter for the number of neighbors of a vertex.
+             *
+             *  @param[in] vertex   The vertex whose number of neighbors shall be returned.
+             *
+             *  @return The number of neighbors of the given vertex.
+             */
+            std::size_t size(htd::vertex_t vertex) const
+            {
+                return isModified(vertex) ? neighborhood_[vertex].size() : adjacencyArray_.neighborCount(vertex);
+            }
+
+            /**
+             *  Getter for the beginning of the current, sorted neighborhood of a vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
+             *
+             *  @return A pointer to the first neighbor of the given vertex.
+             */
+            const htd::vertex_t * begin(htd::vertex_t vertex) const
+            {
+                return isModified(vertex) ? neighborhood_[vertex].data() : adjacencyArray_.begin(vertex);
+            }
+
+            /**
+             *  Getter for the end of the current, sorted neighborhood of a vertex.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
+             *
+             *  @return A pointer past the last neighbor of the given vertex.
+             */
+            const htd::vertex_t * end(htd::vertex_t vertex) const
+            {
+                return isModified(vertex) ? neighborhood_[vertex].data() + neighborhood_[vertex].size() : adjacencyArray_.end(vertex);
+            }
+
+            /**
+             *  Updatable getter for the neighborhood of a vertex.
+             *
+             *  The neighborhood is copied from the underlying adjacency array on the first call for the given vertex.
+             *  References returned by this function stay valid for the lifetime of the working set.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
+             *
+             *  @return The updatable neighborhood of the given vertex.
+             */
+            std::vector<htd::vertex_t> & operator[](htd::vertex_t vertex)
+            {
+                HTD_ASSERT(vertex < modified_.size())
+
+                std::vector<htd::vertex_t> & ret = neighborhood_[vertex];
+
+                if (!modified_[vertex])
+                {
+                    ret.assign(adjacencyArray_.begin(vertex), adjacencyArray_.end(vertex));
+
+                    modified_[vertex] = true;
+                }
+
+                return ret;
+            }
+
+        private:
+            /**
+             *  The adjacency array providing the initial neighborhood of each vertex.
+             */
+            const htd::AdjacencyArray & adjacencyArray_;
+
+            /**
+             *  The modified neighborhood of each vertex. The entry of a vertex is only valid if the vertex is marked as modified.
+             */
+            std::vector<std::vector<htd::vertex_t>> neighborhood_;
+
+            /**
+             *  A vector indicating for each vertex whether its neighborhood was already copied for modification.
+             */
+            std::vector<bool> modified_;
+    };
+}
+
+#endif /* HTD_HTD_NEIGHBORHOODWORKINGSET_HPP */
@@ -121,6 +121,19 @@ namespace htd
 
             HTD_API htd::vertex_t vertexName(htd::vertex_t vertex) const HTD_OVERRIDE;
 
+            /**
+             *  Getter for the immutable adjacency array containing the preprocessed neighborhood of each of the vertices.
+             *
+             *  The adjacency array is built on first access and shared by all copies of the preprocessed graph. The
+             *  preprocessed graph releases its share whenever the neighborhoods are accessed for modification, so an
+             *  array obtained earlier keeps describing the neighborhoods at the time of the call.
+             *
+             *  @note This function may be called concurrently by multiple threads.
+             *
+             *  @return The immutable adjacency array containing the preprocessed neighborhood of each of the vertices.
+             */
+            HTD_API std::shared_ptr<const htd::AdjacencyArray> adjacencyArray(void) const HTD_OVERRIDE;
+
             /**
              *  Updatable getter for the vector containing the preprocessed neighborhood of each of the vertices.
              *
@@ -133,6 +133,23 @@ namespace htd
              */
             HTD_API void setVertexSelectionStrategy(htd::IVertexSelectionStrategy * strategy);
 
+            /**
+             *  Getter for the number of worker threads which are used to evaluate the candidate roots when manipulation operations are involved.
+             *
+             *  @return The number of worker threads which are used to evaluate the candidate roots when manipulation operations are involved.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to evaluate the candidate roots when manipulation operations are involved (1=sequential, 0=number of hardware threads).
+             *
+             *  @note Each worker thread evaluates the candidates on its own copy of the decomposition using its own copies of the manipulation
+             *  operations, the labeling functions and the fitness function. Only the optimal root is applied to the given decomposition.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to evaluate the candidate roots.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
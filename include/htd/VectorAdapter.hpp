@@ -175,7 +175,7 @@ namespace htd
              */
             htd::ConstIterator<T> begin(void) const
             {
-                return htd::ConstIterator<T>(static_cast<htd::ConstIteratorBase<T> *>(new htd::VectorAdapterConstIteratorWrapper<typename std::vector<T, Allocator>::const_iterator, T, Allocator>(container_, container_->begin())));
+                return htd::ConstIterator<T>(container_->data(), container_);
             }
 
             /**
@@ -195,7 +195,7 @@ namespace htd
              */
             htd::ConstIterator<T> end(void) const
             {
-                return htd::ConstIterator<T>(static_cast<htd::ConstIteratorBase<T> *>(new htd::VectorAdapterConstIteratorWrapper<typename std::vector<T, Allocator>::const_iterator, T, Allocator>(container_, container_->end())));
+                return htd::ConstIterator<T>(container_->data() + container_->size(), container_);
             }
 
             /**
@@ -49,6 +49,11 @@ namespace htd
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithm and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
+     *
+     *  @note If the thread count is set to a value greater than one, the iterations are distributed among worker
+     *  threads which operate on their own clones of the base algorithm. The maximum bag size of the best decomposition
+     *  found so far is shared among all workers, so that each iteration is performed with the tightest bound known
+     *  at that time. The iteration count and the non-improvement limit are applied to all workers together.
      */
     class WidthMinimizingTreeDecompositionAlgorithm : public htd::IWidthMinimizingTreeDecompositionAlgorithm
     {
@@ -187,6 +192,12 @@ namespace htd
                                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                            const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const HTD_OVERRIDE;
 
+            HTD_API htd::ITreeDecomposition * computeImprovedDecomposition(const htd::IMultiHypergraph & graph,
+                                                                           const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                           const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                           const std::function<std::size_t(void)> & maxBagSize) const HTD_OVERRIDE;
+
             /**
              *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
              *
@@ -251,6 +262,20 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of worker threads which shall be used to perform the iterations.
+             *
+             *  @return The number of worker threads which shall be used to perform the iterations.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to perform the iterations (1=sequential, 0=number of hardware threads).
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to perform the iterations.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Check whether the computed decompositions shall contain only subset-maximal bags.
              *
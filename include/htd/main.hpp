@@ -26,6 +26,7 @@
 #define HTD_HTD_MAIN_HPP
 
 #include <htd/AdaptiveWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/AdjacencyArray.hpp>
 #include <htd/AddEmptyLeavesOperation.hpp>
 #include <htd/AddEmptyRootOperation.hpp>
 #include <htd/AddIdenticalJoinNodeParentOperation.hpp>
@@ -33,6 +34,7 @@
 #include <htd/AssemblyInfo.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
+#include <htd/BranchAndBoundSetCoverAlgorithm.hpp>
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
@@ -41,6 +43,7 @@
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/CompressionOperation.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/ConnectedComponentTreeDecompositionAlgorithm.hpp>
 #include <htd/ConstCollection.hpp>
 #include <htd/ConstIteratorBase.hpp>
 #include <htd/ConstIterator.hpp>
@@ -48,6 +51,7 @@
 #include <htd/ConstPointerIteratorWrapper.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
+#include <htd/DenseIdentifierMap.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
 #include <htd/DirectedGraphFactory.hpp>
 #include <htd/DirectedGraph.hpp>
@@ -104,6 +108,7 @@
 #include <htd/IHypergraph.hpp>
 #include <htd/IHypertreeDecompositionAlgorithm.hpp>
 #include <htd/IHypertreeDecomposition.hpp>
+#include <htd/IIncrementalTreeDecompositionFitnessFunction.hpp>
 #include <htd/ILabelCollection.hpp>
 #include <htd/ILabeledDirectedGraph.hpp>
 #include <htd/ILabeledDirectedMultiGraph.hpp>
@@ -139,6 +144,7 @@
 #include <htd/IMutablePath.hpp>
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/IMutableTree.hpp>
+#include <htd/IndexedGreedySetCoverAlgorithm.hpp>
 #include <htd/InducedSubgraphLabelingOperation.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPathDecompositionAlgorithm.hpp>
@@ -191,6 +197,7 @@
 #include <htd/LimitChildCountOperation.hpp>
 #include <htd/LimitMaximumForgottenVertexCountOperation.hpp>
 #include <htd/LimitMaximumIntroducedVertexCountOperation.hpp>
+#include <htd/MaximalSetFilter.hpp>
 #include <htd/MaximumCardinalitySearchOrderingAlgorithm.hpp>
 #include <htd/MinDegreeOrderingAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
@@ -209,6 +216,7 @@
 #include <htd/NamedTree.hpp>
 #include <htd/NamedVertexHyperedge.hpp>
 #include <htd/NaturalOrderingAlgorithm.hpp>
+#include <htd/NeighborhoodWorkingSet.hpp>
 #include <htd/NormalizationOperation.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
 #include <htd/PathDecompositionAlgorithmFactory.hpp>
@@ -220,6 +228,7 @@
 #include <htd/PreOrderTreeTraversal.hpp>
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/PreprocessorDefinitions.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 #include <htd/PriorityQueue.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
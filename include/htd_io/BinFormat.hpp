@@ -0,0 +1,123 @@
+/*
+ * File:   BinFormat.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMAT_HPP
+#define HTD_IO_BINFORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace htd_io
+{
+    /**
+     *  Layout of the binary graph format 'bin'.
+     *
+     *  A file in format 'bin' starts with a header of HEADER_SIZE bytes:
+     *
+     *  Offset | Type       | Content
+     *  -------|------------|---------------------------------------------------------------
+     *       0 | char[8]    | The magic string "HTDGRAPH"
+     *       8 | uint32     | The format version (VERSION)
+     *      12 | uint32     | The value BYTE_ORDER_MARK, used to detect foreign byte orders
+     *      16 | uint64     | A combination of the flags VERTEX_NAMES and EDGE_NAMES
+     *      24 | uint64     | The number of vertices
+     *      32 | uint64     | The number of hyperedges
+     *      40 | uint64     | The total number of hyperedge elements
+     *      48 | uint64     | The size of the vertex name table in bytes
+     *      56 | uint64     | The size of the edge name table in bytes
+     *
+     *  The header is followed by the hyperedges in compressed sparse row format, i.e., an array of
+     *  <edge count> + 1 offsets and an array containing the elements of all hyperedges back to back.
+     *  The elements of hyperedge i occupy the range [offsets[i], offsets[i + 1]) of the element array.
+     *  Elements refer to the 0-based position of a vertex in the ordered vertex set of the graph.
+     *
+     *  If the flag VERTEX_NAMES (EDGE_NAMES) is set, the hyperedges are followed by an array of
+     *  <vertex count> + 1 (<edge count> + 1) offsets and the concatenated names. Empty edge names
+     *  denote unnamed edges.
+     *
+     *  All integers are stored as unsigned 64-bit values in the byte order of the machine which wrote
+     *  the file and every section is padded to a multiple of 8 bytes, so that a memory-mapped file can
+     *  be accessed directly without any parsing.
+     */
+    struct BinFormat
+    {
+        public:
+            /**
+             *  Getter for the magic string at the beginning of each file in format 'bin'.
+             *
+             *  @return The magic string at the beginning of each file in format 'bin'.
+             */
+            static const char * magic(void)
+            {
+                return "HTDGRAPH";
+            }
+
+            /**
+             *  The size of the magic string in bytes.
+             */
+            static const std::size_t MAGIC_SIZE = 8;
+
+            /**
+             *  The current version of the format.
+             */
+            static const std::uint32_t VERSION = 1;
+
+            /**
+             *  The value stored in the header to detect files written on machines with a different byte order.
+             */
+            static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+            /**
+             *  The size of the header in bytes.
+             */
+            static const std::size_t HEADER_SIZE = 64;
+
+            /**
+             *  Flag indicating that the file contains a vertex name table.
+             */
+            static const std::uint64_t VERTEX_NAMES = 1;
+
+            /**
+             *  Flag indicating that the file contains an edge name table.
+             */
+            static const std::uint64_t EDGE_NAMES = 2;
+
+            /**
+             *  Compute the size of a section after padding it to a multiple of 8 bytes.
+             *
+             *  @param[in] size The size of the section in bytes.
+             *
+             *  @return The size of the section after padding.
+             */
+            static std::size_t paddedSize(std::size_t size)
+            {
+                return (size + 7) & ~static_cast<std::size_t>(7);
+            }
+
+        private:
+            BinFormat(void);
+    };
+}
+
+#endif /* HTD_IO_BINFORMAT_HPP */
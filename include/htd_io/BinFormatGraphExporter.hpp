@@ -0,0 +1,99 @@
+/*
+ * File:   BinFormatGraphExporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMATGRAPHEXPORTER_HPP
+#define HTD_IO_BINFORMATGRAPHEXPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/NamedMultiHypergraph.hpp>
+
+#include <iostream>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Exporter which allows to store graphs in the binary graph format 'bin'.
+     *
+     *  Files in format 'bin' can be loaded by htd_io::BinFormatImporter without parsing any text and hence they
+     *  are well suited as a cache for instances which are decomposed many times.
+     *
+     *  @note The vertices of the graph are renumbered consecutively, starting with htd::Vertex::FIRST, in the order
+     *  of their identifiers. The hyperedges keep their order, so that graphs without removed vertices and edges are
+     *  restored with identical vertex and edge identifiers.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available input formats.)
+     */
+    class BinFormatGraphExporter
+    {
+        public:
+            HTD_IO_API BinFormatGraphExporter(void);
+
+            HTD_IO_API virtual ~BinFormatGraphExporter();
+
+            /**
+             *  Write a graph to the given output stream.
+             *
+             *  @param[in] graph        The graph which shall be written.
+             *  @param[in] outputStream The output stream to which the graph shall be written. The stream must be opened in binary mode.
+             *
+             *  @return True if the graph was written successfully, false otherwise.
+             */
+            HTD_IO_API bool write(const htd::IMultiHypergraph & graph, std::ostream & outputStream) const;
+
+            /**
+             *  Write a named graph, including its vertex and edge names, to the given output stream.
+             *
+             *  @param[in] graph        The graph which shall be written.
+             *  @param[in] outputStream The output stream to which the graph shall be written. The stream must be opened in binary mode.
+             *
+             *  @return True if the graph was written successfully, false otherwise.
+             */
+            HTD_IO_API bool write(const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const;
+
+            /**
+             *  Write a graph to the given file.
+             *
+             *  @param[in] graph    The graph which shall be written.
+             *  @param[in] path     The path to the file to which the graph shall be written.
+             *
+             *  @return True if the graph was written successfully, false otherwise.
+             */
+            HTD_IO_API bool write(const htd::IMultiHypergraph & graph, const std::string & path) const;
+
+            /**
+             *  Write a named graph, including its vertex and edge names, to the given file.
+             *
+             *  @param[in] graph    The graph which shall be written.
+             *  @param[in] path     The path to the file to which the graph shall be written.
+             *
+             *  @return True if the graph was written successfully, false otherwise.
+             */
+            HTD_IO_API bool write(const htd::NamedMultiHypergraph<std::string, std::string> & graph, const std::string & path) const;
+    };
+}
+
+#endif /* HTD_IO_BINFORMATGRAPHEXPORTER_HPP */
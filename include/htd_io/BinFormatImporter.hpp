@@ -0,0 +1,126 @@
+/*
+ * File:   BinFormatImporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMATIMPORTER_HPP
+#define HTD_IO_BINFORMATIMPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/NamedMultiHypergraph.hpp>
+
+#include <iostream>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Importer which allows to read graphs stored in the binary graph format 'bin'.
+     *
+     *  Files are mapped into memory and the hyperedges are read directly from the mapped content, i.e.,
+     *  no text has to be parsed. Files in format 'bin' can be created via htd_io::BinFormatGraphExporter.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available input formats.)
+     */
+    class BinFormatImporter
+    {
+        public:
+            /**
+             *  Constructor for a new graph importer.
+             */
+            HTD_IO_API BinFormatImporter(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Destructor of a graph importer.
+             */
+            HTD_IO_API virtual ~BinFormatImporter();
+
+            /**
+             *  Check whether the given file contains a graph in format 'bin' which can be read on this machine.
+             *
+             *  @note Only the header and the size of the file are checked.
+             *
+             *  @param[in] path The path to the file which shall be checked.
+             *
+             *  @return True if the given file contains a valid header of format 'bin', false otherwise.
+             */
+            HTD_IO_API bool isValid(const std::string & path) const;
+
+            /**
+             *  Check whether the given file contains a named graph, i.e., a graph with a vertex name table.
+             *
+             *  @param[in] path The path to the file which shall be checked.
+             *
+             *  @return True if the given file contains a valid header of format 'bin' and a vertex name table, false otherwise.
+             */
+            HTD_IO_API bool isNamed(const std::string & path) const;
+
+            /**
+             *  Create a new IMultiHypergraph instance based on the information stored in a given file.
+             *
+             *  @note Vertex and edge names stored in the file are ignored.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new IMultiHypergraph instance based on the information stored in the given file or nullptr if the file is invalid.
+             */
+            HTD_IO_API htd::IMultiHypergraph * import(const std::string & path) const;
+
+            /**
+             *  Create a new IMultiHypergraph instance based on the information from a given stream.
+             *
+             *  @note Vertex and edge names stored in the stream are ignored.
+             *
+             *  @param[in] stream   The input stream from which the information can be read. The stream must be opened in binary mode.
+             *
+             *  @return A new IMultiHypergraph instance based on the information from the given stream or nullptr if the content is invalid.
+             */
+            HTD_IO_API htd::IMultiHypergraph * import(std::istream & stream) const;
+
+            /**
+             *  Create a new htd::NamedMultiHypergraph<std::string, std::string> instance based on the information stored in a given file.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new htd::NamedMultiHypergraph<std::string, std::string> instance based on the information stored in the given file or nullptr if the file is invalid or contains no vertex names.
+             */
+            HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * importNamed(const std::string & path) const;
+
+            /**
+             *  Create a new htd::NamedMultiHypergraph<std::string, std::string> instance based on the information from a given stream.
+             *
+             *  @param[in] stream   The input stream from which the information can be read. The stream must be opened in binary mode.
+             *
+             *  @return A new htd::NamedMultiHypergraph<std::string, std::string> instance based on the information from the given stream or nullptr if the content is invalid or contains no vertex names.
+             */
+            HTD_IO_API htd::NamedMultiHypergraph<std::string, std::string> * importNamed(std::istream & stream) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_BINFORMATIMPORTER_HPP */
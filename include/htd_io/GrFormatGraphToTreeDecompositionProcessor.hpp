@@ -67,6 +67,22 @@ namespace htd_io
 
             HTD_IO_API void registerDecompositionCallback(const std::function<void(const htd::FitnessEvaluation &)> & callback) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of worker threads which shall be used to parse input files.
+             *
+             *  @return The number of worker threads which shall be used to parse input files.
+             */
+            HTD_IO_API std::size_t parserThreadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to parse input files (1=sequential, 0=number of hardware threads).
+             *
+             *  @note Input streams are always parsed sequentially.
+             *
+             *  @param[in] parserThreadCount    The number of worker threads which shall be used to parse input files.
+             */
+            HTD_IO_API void setParserThreadCount(std::size_t parserThreadCount);
+
         private:
             struct Implementation;
 
@@ -55,6 +55,9 @@ namespace htd_io
             /**
              *  Create a new IMultiHypergraph instance based on the information stored in a given file.
              *
+             *  The file is mapped into memory and parsed in place. If more than one worker thread is configured,
+             *  the file is split on line boundaries and the chunks are parsed concurrently.
+             *
              *  @param[in] path The path to the file from which the information can be read.
              *
              *  @return A new IMultiHypergraph instance based on the information stored in the given file.
@@ -70,6 +73,22 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiHypergraph * import(std::istream & stream) const;
 
+            /**
+             *  Getter for the number of worker threads which shall be used to parse files.
+             *
+             *  @return The number of worker threads which shall be used to parse files.
+             */
+            HTD_IO_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of worker threads which shall be used to parse files (1=sequential, 0=number of hardware threads).
+             *
+             *  @note Input streams are always parsed sequentially.
+             *
+             *  @param[in] threadCount  The number of worker threads which shall be used to parse files.
+             */
+            HTD_IO_API void setThreadCount(std::size_t threadCount);
+
         private:
             struct Implementation;
 
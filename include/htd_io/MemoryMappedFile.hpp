@@ -0,0 +1,96 @@
+/*
+ * File:   MemoryMappedFile.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_MEMORYMAPPEDFILE_HPP
+#define HTD_IO_MEMORYMAPPEDFILE_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/Globals.hpp>
+
+#include <memory>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Read-only view of the complete content of a file.
+     *
+     *  The file is mapped into memory if the platform supports it, so that its content can be accessed without
+     *  copying it into a user-space buffer. If the file cannot be mapped, e.g., because it is not a regular
+     *  file, the content is read into an internal buffer instead.
+     */
+    class MemoryMappedFile
+    {
+        public:
+            /**
+             *  Constructor for a new view of a file.
+             *
+             *  @param[in] path The path to the file which shall be opened.
+             */
+            HTD_IO_API MemoryMappedFile(const std::string & path);
+
+            /**
+             *  Destructor of a view of a file.
+             */
+            HTD_IO_API virtual ~MemoryMappedFile();
+
+            /**
+             *  Check whether the file could be opened.
+             *
+             *  @return True if the file could be opened, false otherwise.
+             */
+            HTD_IO_API bool isOpen(void) const;
+
+            /**
+             *  Check whether the content of the file is accessed via a memory mapping.
+             *
+             *  @return True if the content of the file is accessed via a memory mapping, false if it was read into an internal buffer.
+             */
+            HTD_IO_API bool isMapped(void) const;
+
+            /**
+             *  Getter for the content of the file.
+             *
+             *  @note The content is not null-terminated.
+             *
+             *  @return A pointer to the first byte of the file.
+             */
+            HTD_IO_API const char * data(void) const;
+
+            /**
+             *  Getter for the size of the file.
+             *
+             *  @return The size of the file in bytes.
+             */
+            HTD_IO_API std::size_t size(void) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_MEMORYMAPPEDFILE_HPP */
@@ -25,6 +25,10 @@
 #ifndef HTD_IO_MAIN_HPP
 #define HTD_IO_MAIN_HPP
 
+#include <htd_io/BinFormat.hpp>
+#include <htd_io/BinFormatGraphExporter.hpp>
+#include <htd_io/BinFormatGraphToTreeDecompositionProcessor.hpp>
+#include <htd_io/BinFormatImporter.hpp>
 #include <htd_io/GrFormatGraphProcessor.hpp>
 #include <htd_io/GrFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/GrFormatImporter.hpp>
@@ -38,6 +42,7 @@
 #include <htd_io/ITreeDecompositionExporter.hpp>
 #include <htd_io/LpFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/LpFormatImporter.hpp>
+#include <htd_io/MemoryMappedFile.hpp>
 #include <htd_io/ParsingResult.hpp>
 #include <htd_io/TdFormatExporter.hpp>
 #include <htd_io/WidthExporter.hpp>
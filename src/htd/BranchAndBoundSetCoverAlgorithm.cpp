@@ -0,0 +1,570 @@
+/* 
+ * File:   BranchAndBoundSetCoverAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BRANCHANDBOUNDSETCOVERALGORITHM_CPP
+#define HTD_HTD_BRANCHANDBOUNDSETCOVERALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/BranchAndBoundSetCoverAlgorithm.hpp>
+#include <htd/MaximalSetFilter.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+
+/**
+ *  Private implementation details of class htd::BranchAndBoundSetCoverAlgorithm.
+ */
+struct htd::BranchAndBoundSetCoverAlgorithm::Implementation
+{
+    /**
+     *  The state of a single branch-and-bound search.
+     *
+     *  Elements and containers are renumbered consecutively and sets of elements are represented as bit vectors.
+     */
+    struct SearchState
+    {
+        /**
+         *  Constructor for a new search state.
+         *
+         *  @param[in] elementCount The number of elements which must be covered.
+         *  @param[in] nodeLimit    The maximum number of search nodes which shall be explored.
+         *  @param[in] timeLimit    The maximum time in milliseconds which shall be spent on the search.
+         */
+        SearchState(std::size_t elementCount, std::size_t nodeLimit, std::size_t timeLimit) : wordCount((elementCount + 63) / 64), containerBits(), containerSizes(), maximumContainerSize(0), elementContainers(), elementOrder(), levels(), currentSolution(), bestSolution(), marks(), markEpoch(0), remainingNodes(nodeLimit), timeLimited(timeLimit != (std::size_t)-1), deadline(), aborted(false)
+        {
+            if (timeLimited)
+            {
+                deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeLimit);
+            }
+        }
+
+        /**
+         *  The number of 64-bit words per bit vector.
+         */
+        std::size_t wordCount;
+
+        /**
+         *  The elements of each container, represented as bit vector.
+         */
+        std::vector<std::vector<std::uint64_t>> containerBits;
+
+        /**
+         *  The number of elements of each container.
+         */
+        std::vector<std::size_t> containerSizes;
+
+        /**
+         *  The number of elements of the largest container.
+         */
+        std::size_t maximumContainerSize;
+
+        /**
+         *  The containers including each element.
+         */
+        std::vector<std::vector<htd::index_t>> elementContainers;
+
+        /**
+         *  The elements in ascending order of the number of containers including them.
+         */
+        std::vector<htd::index_t> elementOrder;
+
+        /**
+         *  The bit vectors of uncovered elements for each search depth.
+         */
+        std::vector<std::vector<std::uint64_t>> levels;
+
+        /**
+         *  The containers selected on the current search path.
+         */
+        std::vector<htd::index_t> currentSolution;
+
+        /**
+         *  The best solution found so far.
+         */
+        std::vector<htd::index_t> bestSolution;
+
+        /**
+         *  The epoch in which each container was marked last during the computation of the lower bound.
+         */
+        std::vector<std::size_t> marks;
+
+        /**
+         *  The current epoch of the container marks.
+         */
+        std::size_t markEpoch;
+
+        /**
+         *  The number of search nodes which may still be explored.
+         */
+        std::size_t remainingNodes;
+
+        /**
+         *  A boolean flag indicating whether the search is limited in time.
+         */
+        bool timeLimited;
+
+        /**
+         *  The point in time at which the search shall be aborted.
+         */
+        std::chrono::steady_clock::time_point deadline;
+
+        /**
+         *  A boolean flag indicating whether the search was aborted because a budget ran out.
+         */
+        bool aborted;
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), nodeLimit_(100000), timeLimit_((std::size_t)-1)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), nodeLimit_(original.nodeLimit_), timeLimit_(original.timeLimit_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The maximum number of search nodes which are explored per call of computeSetCover().
+     */
+    std::size_t nodeLimit_;
+
+    /**
+     *  The maximum time in milliseconds which is spent on the search per call of computeSetCover().
+     */
+    std::size_t timeLimit_;
+
+    /**
+     *  Count the elements of the intersection of two bit vectors.
+     *
+     *  @param[in] bits1        The first bit vector.
+     *  @param[in] bits2        The second bit vector.
+     *  @param[in] wordCount    The number of words of the bit vectors.
+     *
+     *  @return The number of elements of the intersection of both bit vectors.
+     */
+    static std::size_t intersectionSize(const std::vector<std::uint64_t> & bits1, const std::vector<std::uint64_t> & bits2, std::size_t wordCount)
+    {
+        std::size_t ret = 0;
+
+        for (std::size_t word = 0; word < wordCount; ++word)
+        {
+            ret += std::bitset<64>(bits1[word] & bits2[word]).count();
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute a greedy solution which serves as initial upper bound of the search.
+     *
+     *  @param[in,out] state    The search state.
+     *  @param[in] elementCount The number of elements which must be covered.
+     */
+    void computeGreedySolution(SearchState & state, std::size_t elementCount) const;
+
+    /**
+     *  Compute a lower bound for the number of containers needed to cover the given elements.
+     *
+     *  @param[in,out] state        The search state.
+     *  @param[in] uncovered        The bit vector of the uncovered elements.
+     *  @param[in] uncoveredCount   The number of uncovered elements.
+     *
+     *  @return A lower bound for the number of containers needed to cover the given elements.
+     */
+    std::size_t lowerBound(SearchState & state, const std::vector<std::uint64_t> & uncovered, std::size_t uncoveredCount) const;
+
+    /**
+     *  Explore the sub-tree of the search rooted at the current search path.
+     *
+     *  @param[in,out] state        The search state.
+     *  @param[in] uncoveredCount   The number of elements which are not covered by the current search path.
+     */
+    void search(SearchState & state, std::size_t uncoveredCount) const;
+};
+
+htd::BranchAndBoundSetCoverAlgorithm::BranchAndBoundSetCoverAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::BranchAndBoundSetCoverAlgorithm::BranchAndBoundSetCoverAlgorithm(const htd::BranchAndBoundSetCoverAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::BranchAndBoundSetCoverAlgorithm::~BranchAndBoundSetCoverAlgorithm()
+{
+
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
+{
+    if (!elements.empty())
+    {
+        std::vector<std::vector<htd::id_t>> restrictedContainers;
+
+        std::vector<htd::index_t> originalIndices;
+
+        for (htd::index_t index = 0; index < containers.size(); ++index)
+        {
+            const std::vector<htd::id_t> & container = containers[index];
+
+            std::vector<htd::id_t> restrictedContainer;
+
+            auto it1 = elements.begin();
+            auto it2 = container.begin();
+
+            while (it1 != elements.end() && it2 != container.end())
+            {
+                if (*it1 < *it2)
+                {
+                    ++it1;
+                }
+                else if (*it2 < *it1)
+                {
+                    ++it2;
+                }
+                else
+                {
+                    restrictedContainer.push_back(static_cast<htd::id_t>(std::distance(elements.begin(), it1)));
+
+                    ++it1;
+                    ++it2;
+                }
+            }
+
+            if (!restrictedContainer.empty())
+            {
+                restrictedContainers.push_back(std::move(restrictedContainer));
+
+                originalIndices.push_back(index);
+            }
+        }
+
+        std::vector<htd::index_t> maximalContainers;
+
+        htd::MaximalSetFilter().computeMaximalSets(restrictedContainers, maximalContainers);
+
+        Implementation::SearchState state(elements.size(), implementation_->nodeLimit_, implementation_->timeLimit_);
+
+        state.elementContainers.resize(elements.size());
+
+        for (htd::index_t index : maximalContainers)
+        {
+            std::vector<std::uint64_t> bits(state.wordCount, 0);
+
+            for (htd::id_t element : restrictedContainers[index])
+            {
+                bits[element >> 6] |= ((std::uint64_t)1) << (element & 63);
+
+                state.elementContainers[element].push_back(state.containerBits.size());
+            }
+
+            state.containerBits.push_back(std::move(bits));
+
+            state.containerSizes.push_back(restrictedContainers[index].size());
+
+            state.maximumContainerSize = std::max(state.maximumContainerSize, restrictedContainers[index].size());
+        }
+
+        bool coverable = true;
+
+        for (auto it = state.elementContainers.begin(); coverable && it != state.elementContainers.end(); ++it)
+        {
+            coverable = !it->empty();
+        }
+
+        if (coverable)
+        {
+            state.elementOrder.resize(elements.size());
+
+            std::iota(state.elementOrder.begin(), state.elementOrder.end(), 0);
+
+            std::stable_sort(state.elementOrder.begin(), state.elementOrder.end(), [&](htd::index_t element1, htd::index_t element2) { return state.elementContainers[element1].size() < state.elementContainers[element2].size(); });
+
+            state.marks.resize(state.containerBits.size(), 0);
+
+            implementation_->computeGreedySolution(state, elements.size());
+
+            state.levels.resize(state.bestSolution.size() + 1, std::vector<std::uint64_t>(state.wordCount, 0));
+
+            std::vector<std::uint64_t> & root = state.levels[0];
+
+            for (std::size_t element = 0; element < elements.size(); ++element)
+            {
+                root[element >> 6] |= ((std::uint64_t)1) << (element & 63);
+            }
+
+            implementation_->search(state, elements.size());
+
+            std::vector<htd::index_t> result;
+
+            result.reserve(state.bestSolution.size());
+
+            for (htd::index_t container : state.bestSolution)
+            {
+                result.push_back(originalIndices[maximalContainers[container]]);
+            }
+
+            std::sort(result.begin(), result.end());
+
+            target.insert(target.end(), result.begin(), result.end());
+        }
+    }
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
+{
+    if (!elements.empty())
+    {
+        computeSetCover(std::vector<htd::id_t>(elements.begin(), elements.end()), std::vector<std::vector<htd::id_t>>(containers.begin(), containers.end()), target);
+    }
+}
+
+std::size_t htd::BranchAndBoundSetCoverAlgorithm::nodeLimit(void) const
+{
+    return implementation_->nodeLimit_;
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::setNodeLimit(std::size_t nodeLimit)
+{
+    implementation_->nodeLimit_ = nodeLimit;
+}
+
+std::size_t htd::BranchAndBoundSetCoverAlgorithm::timeLimit(void) const
+{
+    return implementation_->timeLimit_;
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::setTimeLimit(std::size_t timeLimit)
+{
+    implementation_->timeLimit_ = timeLimit;
+}
+
+const htd::LibraryInstance * htd::BranchAndBoundSetCoverAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::BranchAndBoundSetCoverAlgorithm * htd::BranchAndBoundSetCoverAlgorithm::clone(void) const
+{
+    return new htd::BranchAndBoundSetCoverAlgorithm(*this);
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::Implementation::computeGreedySolution(SearchState & state, std::size_t elementCount) const
+{
+    std::vector<std::uint64_t> uncovered(state.wordCount, 0);
+
+    for (std::size_t element = 0; element < elementCount; ++element)
+    {
+        uncovered[element >> 6] |= ((std::uint64_t)1) << (element & 63);
+    }
+
+    std::size_t uncoveredCount = elementCount;
+
+    while (uncoveredCount > 0)
+    {
+        htd::index_t bestContainer = 0;
+
+        std::size_t bestOverlap = 0;
+
+        for (htd::index_t container = 0; container < state.containerBits.size(); ++container)
+        {
+            if (state.containerSizes[container] > bestOverlap)
+            {
+                std::size_t overlap = intersectionSize(uncovered, state.containerBits[container], state.wordCount);
+
+                if (overlap > bestOverlap)
+                {
+                    bestOverlap = overlap;
+
+                    bestContainer = container;
+                }
+            }
+        }
+
+        const std::vector<std::uint64_t> & bits = state.containerBits[bestContainer];
+
+        for (std::size_t word = 0; word < state.wordCount; ++word)
+        {
+            uncovered[word] &= ~bits[word];
+        }
+
+        uncoveredCount -= bestOverlap;
+
+        state.bestSolution.push_back(bestContainer);
+    }
+}
+
+std::size_t htd::BranchAndBoundSetCoverAlgorithm::Implementation::lowerBound(SearchState & state, const std::vector<std::uint64_t> & uncovered, std::size_t uncoveredCount) const
+{
+    std::size_t ret = 0;
+
+    ++state.markEpoch;
+
+    for (htd::index_t element : state.elementOrder)
+    {
+        if ((uncovered[element >> 6] >> (element & 63)) & 1)
+        {
+            const std::vector<htd::index_t> & containers = state.elementContainers[element];
+
+            bool independent = true;
+
+            for (auto it = containers.begin(); independent && it != containers.end(); ++it)
+            {
+                independent = state.marks[*it] != state.markEpoch;
+            }
+
+            if (independent)
+            {
+                ++ret;
+
+                for (htd::index_t container : containers)
+                {
+                    state.marks[container] = state.markEpoch;
+                }
+            }
+        }
+    }
+
+    return std::max(ret, (uncoveredCount + state.maximumContainerSize - 1) / state.maximumContainerSize);
+}
+
+void htd::BranchAndBoundSetCoverAlgorithm::Implementation::search(SearchState & state, std::size_t uncoveredCount) const
+{
+    std::size_t depth = state.currentSolution.size();
+
+    if (uncoveredCount == 0)
+    {
+        if (depth < state.bestSolution.size())
+        {
+            state.bestSolution = state.currentSolution;
+        }
+    }
+    else if (!state.aborted)
+    {
+        if (state.remainingNodes == 0 || (state.timeLimited && (state.remainingNodes & 255) == 0 && std::chrono::steady_clock::now() >= state.deadline))
+        {
+            state.aborted = true;
+        }
+        else
+        {
+            --state.remainingNodes;
+
+            const std::vector<std::uint64_t> & uncovered = state.levels[depth];
+
+            if (depth + lowerBound(state, uncovered, uncoveredCount) < state.bestSolution.size())
+            {
+                auto branchingElement = state.elementOrder.begin();
+
+                while (((uncovered[*branchingElement >> 6] >> (*branchingElement & 63)) & 1) == 0)
+                {
+                    ++branchingElement;
+                }
+
+                const std::vector<htd::index_t> & containers = state.elementContainers[*branchingElement];
+
+                std::vector<std::pair<std::size_t, htd::index_t>> candidates;
+
+                candidates.reserve(containers.size());
+
+                for (htd::index_t container : containers)
+                {
+                    candidates.emplace_back(intersectionSize(uncovered, state.containerBits[container], state.wordCount), container);
+                }
+
+                std::sort(candidates.begin(), candidates.end(), [](const std::pair<std::size_t, htd::index_t> & candidate1, const std::pair<std::size_t, htd::index_t> & candidate2) { return candidate1.first > candidate2.first || (candidate1.first == candidate2.first && candidate1.second < candidate2.second); });
+
+                std::vector<std::uint64_t> & next = state.levels[depth + 1];
+
+                for (auto it = candidates.begin(); it != candidates.end() && !state.aborted && depth + 1 < state.bestSolution.size(); ++it)
+                {
+                    const std::vector<std::uint64_t> & bits = state.containerBits[it->second];
+
+                    bool dominated = false;
+
+                    for (auto it2 = candidates.begin(); !dominated && it2 != it; ++it2)
+                    {
+                        const std::vector<std::uint64_t> & otherBits = state.containerBits[it2->second];
+
+                        dominated = true;
+
+                        for (std::size_t word = 0; dominated && word < state.wordCount; ++word)
+                        {
+                            dominated = (uncovered[word] & bits[word] & ~otherBits[word]) == 0;
+                        }
+                    }
+
+                    if (!dominated)
+                    {
+                        for (std::size_t word = 0; word < state.wordCount; ++word)
+                        {
+                            next[word] = uncovered[word] & ~bits[word];
+                        }
+
+                        state.currentSolution.push_back(it->second);
+
+                        search(state, uncoveredCount - it->first);
+
+                        state.currentSolution.pop_back();
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif /* HTD_HTD_BRANCHANDBOUNDSETCOVERALGORITHM_CPP */
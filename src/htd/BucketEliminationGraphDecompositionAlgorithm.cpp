@@ -36,10 +36,12 @@
 #include <htd/IGraphPreprocessor.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <functional>
 #include <memory>
 #include <stack>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -56,7 +58,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), compressionEnabled_(true), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), compressionEnabled_(true), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -106,6 +108,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The number of worker threads which shall be used to distribute the hyperedges to the bags containing them.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Compute a new mutable graph decompostion of the given graph.
      *
@@ -121,12 +128,12 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @param[in] graph                The graph which shall be decomposed.
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
-     *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition which is re-evaluated after each eliminated vertex.
      *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
      *
      *  @return A pair consisting of a mutable graph decompostion of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
      */
-    std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+    std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const;
 
     /**
      *  Get the vertex which is ranked first in the vertex elimination ordering.
@@ -235,7 +242,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] startBucket      The identifier of the node from which the process shall start.
      *  @param[in] buckets          The available buckets.
      *  @param[in] neighbors        The neighbors of the buckets.
-     *  @param[in] inducedEdges     The set of edge indices induced by a bucket.
+     *  @param[out] assignedBuckets The buckets containing the edge. The identifiers of the buckets are appended to the vector.
      *  @param[in] lastAssignedEdge The identifier of the last edge which was assigned to a bucket.
      *  @param[in] originStack      The stack instance used for backtracking.
      */
@@ -244,7 +251,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
                         htd::vertex_t startBucket,
                         const std::vector<std::vector<htd::vertex_t>> & buckets,
                         const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                        std::vector<std::vector<htd::index_t>> & inducedEdges,
+                        std::vector<htd::vertex_t> & assignedBuckets,
                         std::vector<htd::id_t> & lastAssignedEdge,
                         std::stack<htd::vertex_t> & originStack) const;
 
@@ -257,7 +264,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] startBucket      The identifier of the node from which the process shall start.
      *  @param[in] buckets          The available buckets.
      *  @param[in] neighbors        The neighbors of the buckets.
-     *  @param[in] inducedEdges     The set of edge indices induced by a bucket.
+     *  @param[out] assignedBuckets The buckets containing the edge. The identifiers of the buckets are appended to the vector.
      *  @param[in] lastAssignedEdge The identifier of the last edge which was assigned to a bucket.
      *  @param[in] originStack      The stack instance used for backtracking.
      */
@@ -267,10 +274,32 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
                         htd::vertex_t startBucket,
                         const std::vector<std::vector<htd::vertex_t>> & buckets,
                         const std::vector<std::vector<htd::vertex_t>> & neighbors,
-                        std::vector<std::vector<htd::index_t>> & inducedEdges,
+                        std::vector<htd::vertex_t> & assignedBuckets,
                         std::vector<htd::id_t> & lastAssignedEdge,
                         std::stack<htd::vertex_t> & originStack) const;
 
+    /**
+     *  Distribute all hyperedges of the graph concurrently so that the information about induced edges is updated.
+     *
+     *  The hyperedges are split into consecutive blocks which are claimed by the worker threads one at a time. Each
+     *  worker uses its own visited marks and backtracking stack and records the buckets containing the hyperedges of a
+     *  block separately. The blocks are merged in ascending order afterwards, hence each list of induced edges is sorted
+     *  by edge index and equal to the one computed by the sequential distribution.
+     *
+     *  @param[in] hyperedges       The hyperedges of the graph.
+     *  @param[in] edgeTarget       The identifier of the bucket from which the distribution of the respective hyperedge shall start.
+     *  @param[in] buckets          The available buckets.
+     *  @param[in] neighbors        The neighbors of the buckets.
+     *  @param[out] inducedEdges    The set of edge indices induced by a bucket.
+     *  @param[in] threadCount      The number of worker threads which shall be used.
+     */
+    void distributeEdges(const htd::ConstCollection<htd::Hyperedge> & hyperedges,
+                         const std::vector<htd::index_t> & edgeTarget,
+                         const std::vector<std::vector<htd::vertex_t>> & buckets,
+                         const std::vector<std::vector<htd::vertex_t>> & neighbors,
+                         std::vector<std::vector<htd::index_t>> & inducedEdges,
+                         std::size_t threadCount) const;
+
     /**
      *  Compute the set union of two sets and store the result in the first set.
      *
@@ -385,6 +414,11 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
 }
 
 std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const
+{
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations, [maxBagSize]() { return maxBagSize; }, maxIterationCount);
+}
+
+std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const
 {
     std::pair<htd::IMutableGraphDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
 
@@ -609,12 +643,23 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::setComputeInducedEdgesEn
     implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
 }
 
+std::size_t htd::BucketEliminationGraphDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::BucketEliminationGraphDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::BucketEliminationGraphDecompositionAlgorithm * htd::BucketEliminationGraphDecompositionAlgorithm::clone(void) const
 {
     htd::BucketEliminationGraphDecompositionAlgorithm * ret = new htd::BucketEliminationGraphDecompositionAlgorithm(implementation_->managementInstance_);
 
     ret->setCompressionEnabled(implementation_->compressionEnabled_);
     ret->setComputeInducedEdgesEnabled(implementation_->computeInducedEdges_);
+    ret->setThreadCount(implementation_->threadCount_);
 
     for (const auto & labelingFunction : implementation_->labelingFunctions_)
     {
@@ -643,7 +688,7 @@ htd::BucketEliminationGraphDecompositionAlgorithm * htd::BucketEliminationGraphD
     return ret;
 }
 
-std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const
+std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const
 {
     htd::IMutableGraphDecomposition * ret = nullptr;
 
@@ -667,7 +712,7 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
                     HTD_ASSERT(ret != nullptr)
 
-                    if (ret->maximumBagSize() > maxBagSize)
+                    if (ret->maximumBagSize() > maxBagSize())
                     {
                         delete ret;
 
@@ -881,26 +926,49 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             if (computeInducedEdges_)
             {
-                hyperedgePosition = hyperedges.begin();
+                std::size_t threadCount = threadCount_;
 
-                std::vector<htd::id_t> lastAssignedEdge(buckets.size() + 1, (htd::id_t)-1);
-
-                std::stack<htd::vertex_t> originStack;
+                if (threadCount == 0)
+                {
+                    threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+                }
 
-                for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
+                if (threadCount > 1 && edgeCount > 1)
+                {
+                    distributeEdges(hyperedges, edgeTarget, buckets, neighbors, inducedEdges, threadCount);
+                }
+                else
                 {
-                    const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
+                    hyperedgePosition = hyperedges.begin();
 
-                    if (edgeElements.size() == 2)
-                    {
-                        distributeEdge(index, edgeElements[0], edgeElements[1], edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
-                    }
-                    else
+                    std::vector<htd::id_t> lastAssignedEdge(buckets.size() + 1, (htd::id_t)-1);
+
+                    std::stack<htd::vertex_t> originStack;
+
+                    std::vector<htd::vertex_t> assignedBuckets;
+
+                    for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
                     {
-                        distributeEdge(index, edgeElements, edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
-                    }
+                        const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
+
+                        assignedBuckets.clear();
+
+                        if (edgeElements.size() == 2)
+                        {
+                            distributeEdge(index, edgeElements[0], edgeElements[1], edgeTarget[index], buckets, neighbors, assignedBuckets, lastAssignedEdge, originStack);
+                        }
+                        else
+                        {
+                            distributeEdge(index, edgeElements, edgeTarget[index], buckets, neighbors, assignedBuckets, lastAssignedEdge, originStack);
+                        }
+
+                        for (htd::vertex_t bucket : assignedBuckets)
+                        {
+                            inducedEdges[bucket].push_back(index);
+                        }
 
-                    ++hyperedgePosition;
+                        ++hyperedgePosition;
+                    }
                 }
             }
 
@@ -1202,7 +1270,7 @@ int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maxima
     return ret;
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<htd::vertex_t> & assignedBuckets, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     long size = static_cast<long>(edge.size());
 
@@ -1210,7 +1278,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
     lastAssignedEdge[currentBucket] = static_cast<htd::id_t>(edgeIndex);
 
-    inducedEdges[currentBucket].push_back(edgeIndex);
+    assignedBuckets.push_back(currentBucket);
 
     htd::vertex_t firstVertex = edge[0];
 
@@ -1241,7 +1309,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
         lastAssignedEdge[currentBucket] = static_cast<htd::id_t>(edgeIndex);
 
-        inducedEdges[currentBucket].push_back(edgeIndex);
+        assignedBuckets.push_back(currentBucket);
 
         for (htd::vertex_t neighbor : neighbors[currentBucket])
         {
@@ -1262,13 +1330,13 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
     }
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<htd::vertex_t> & assignedBuckets, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     htd::vertex_t currentBucket = startBucket;
 
     lastAssignedEdge[currentBucket] = static_cast<htd::id_t>(edgeIndex);
 
-    inducedEdges[currentBucket].push_back(edgeIndex);
+    assignedBuckets.push_back(currentBucket);
 
     for (htd::vertex_t neighbor : neighbors[currentBucket])
     {
@@ -1299,7 +1367,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
 
         lastAssignedEdge[currentBucket] = static_cast<htd::id_t>(edgeIndex);
 
-        inducedEdges[currentBucket].push_back(edgeIndex);
+        assignedBuckets.push_back(currentBucket);
 
         for (htd::vertex_t neighbor : neighbors[currentBucket])
         {
@@ -1325,6 +1393,109 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distribu
     }
 }
 
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdges(const htd::ConstCollection<htd::Hyperedge> & hyperedges,
+                                                                                        const std::vector<htd::index_t> & edgeTarget,
+                                                                                        const std::vector<std::vector<htd::vertex_t>> & buckets,
+                                                                                        const std::vector<std::vector<htd::vertex_t>> & neighbors,
+                                                                                        std::vector<std::vector<htd::index_t>> & inducedEdges,
+                                                                                        std::size_t threadCount) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    const std::size_t blockSize = 1024;
+
+    std::vector<const std::vector<htd::vertex_t> *> edgeElements;
+
+    edgeElements.reserve(edgeTarget.size());
+
+    for (const htd::Hyperedge & hyperedge : hyperedges)
+    {
+        edgeElements.push_back(&(hyperedge.sortedElements()));
+    }
+
+    std::size_t edgeCount = edgeElements.size();
+
+    std::size_t blockCount = (edgeCount + blockSize - 1) / blockSize;
+
+    /* For each block, the buckets of all its hyperedges in a single vector and the position of the first bucket of each hyperedge. */
+    std::vector<std::vector<htd::vertex_t>> blockBuckets(blockCount);
+
+    std::vector<std::vector<htd::index_t>> blockOffsets(blockCount);
+
+    std::atomic<htd::index_t> nextBlock(0);
+
+    auto worker = [&]()
+    {
+        std::vector<htd::id_t> lastAssignedEdge(buckets.size() + 1, (htd::id_t)-1);
+
+        std::stack<htd::vertex_t> originStack;
+
+        for (htd::index_t block = nextBlock++; block < blockCount && !managementInstance.isTerminated(); block = nextBlock++)
+        {
+            std::vector<htd::vertex_t> & assignedBuckets = blockBuckets[block];
+
+            std::vector<htd::index_t> & offsets = blockOffsets[block];
+
+            htd::index_t last = std::min((block + 1) * blockSize, edgeCount);
+
+            for (htd::index_t index = block * blockSize; index < last; ++index)
+            {
+                const std::vector<htd::vertex_t> & elements = *(edgeElements[index]);
+
+                offsets.push_back(assignedBuckets.size());
+
+                if (elements.size() == 2)
+                {
+                    distributeEdge(index, elements[0], elements[1], edgeTarget[index], buckets, neighbors, assignedBuckets, lastAssignedEdge, originStack);
+                }
+                else
+                {
+                    distributeEdge(index, elements, edgeTarget[index], buckets, neighbors, assignedBuckets, lastAssignedEdge, originStack);
+                }
+            }
+
+            offsets.push_back(assignedBuckets.size());
+        }
+    };
+
+    threadCount = std::max(std::min(threadCount, blockCount), (std::size_t)1);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (htd::index_t block = 0; block < blockCount && !managementInstance.isTerminated(); ++block)
+    {
+        const std::vector<htd::vertex_t> & assignedBuckets = blockBuckets[block];
+
+        const std::vector<htd::index_t> & offsets = blockOffsets[block];
+
+        for (htd::index_t position = 0; position + 1 < offsets.size(); ++position)
+        {
+            htd::index_t index = block * blockSize + position;
+
+            for (htd::index_t offset = offsets[position]; offset < offsets[position + 1]; ++offset)
+            {
+                inducedEdges[assignedBuckets[offset]].push_back(index);
+            }
+        }
+
+        std::vector<htd::vertex_t>().swap(blockBuckets[block]);
+
+        std::vector<htd::index_t>().swap(blockOffsets[block]);
+    }
+}
+
 void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::updateDecomposition(const htd::IMultiHypergraph & graph,
                                                                                             htd::IMutableGraphDecomposition & decomposition,
                                                                                             htd::vertex_t startingVertex,
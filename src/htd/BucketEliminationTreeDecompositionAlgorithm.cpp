@@ -43,6 +43,7 @@
 
 #include <algorithm>
 #include <cstdarg>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -129,12 +130,12 @@ struct htd::BucketEliminationTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] graph                The graph which shall be decomposed.
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
-     *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition which is re-evaluated after each eliminated vertex.
      *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
      *
      *  @return A pair consisting of a mutable tree decompostion of the given graph or a null-pointer in case that no decomposition with a appropriate maximum bag size could be found after maxIterationCount iterations and the number of iterations actually needed to find the decomposition at hand.
      */
-    std::pair<htd::IMutableTreeDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+    std::pair<htd::IMutableTreeDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const;
 };
 
 htd::BucketEliminationTreeDecompositionAlgorithm::BucketEliminationTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -203,6 +204,11 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 }
 
 std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const
+{
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations, [maxBagSize]() { return maxBagSize; }, maxIterationCount);
+}
+
+std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const
 {
     std::pair<htd::IMutableTreeDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
 
@@ -411,12 +417,22 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::setComputeInducedEdgesEna
     implementation_->baseAlgorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
 }
 
+std::size_t htd::BucketEliminationTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->baseAlgorithm_->threadCount();
+}
+
+void htd::BucketEliminationTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->baseAlgorithm_->setThreadCount(threadCount);
+}
+
 htd::BucketEliminationTreeDecompositionAlgorithm * htd::BucketEliminationTreeDecompositionAlgorithm::clone(void) const
 {
     return new htd::BucketEliminationTreeDecompositionAlgorithm(*this);
 }
 
-std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const
+std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const
 {
     htd::IMutableTreeDecomposition * ret = managementInstance_->treeDecompositionFactory().createInstance();
 
@@ -424,7 +440,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
     if (graph.vertexCount() > 0)
     {
-        std::pair<htd::IGraphDecomposition *, std::size_t> graphDecomposition = baseAlgorithm_->computeDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        std::pair<htd::IGraphDecomposition *, std::size_t> graphDecomposition = baseAlgorithm_->computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>(), maxBagSize, maxIterationCount);
 
         if (graphDecomposition.first != nullptr)
         {
@@ -453,13 +469,9 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
+                            htd::vertex_t vertex1 = htd::selectRandomElement<htd::vertex_t>(component1);
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex2 = htd::selectRandomElement<htd::vertex_t>(component2);
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -472,9 +484,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(htd::selectRandomIndex(graphDecomposition.first->vertexCount())), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
@@ -30,8 +30,14 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/Helpers.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::CombinedWidthMinimizingTreeDecompositionAlgorithm.
@@ -44,7 +50,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -54,7 +60,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_), threadCount_(original.threadCount_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -84,6 +90,176 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
     bool computeInducedEdges_;
+
+    /**
+     *  The number of worker threads which shall be used to run the base algorithms.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Determine the number of worker threads which will actually be started.
+     *
+     *  @return The number of worker threads which will actually be started.
+     */
+    std::size_t effectiveThreadCount(void) const
+    {
+        std::size_t ret = threadCount_;
+
+        if (ret == 0)
+        {
+            ret = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        return std::min(ret, algorithms_.size());
+    }
+
+    /**
+     *  Run the base algorithms concurrently and return the decomposition of lowest width.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked for each decomposition computed by one of the workers.
+     *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] threadCount              The number of worker threads which shall be used.
+     *
+     *  @return The decomposition of lowest width found by one of the workers or nullptr, if no decomposition respecting the upper bound was found.
+     */
+    htd::ITreeDecomposition * computeImprovedDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                     const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                     std::size_t maxBagSize, std::size_t threadCount) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        std::atomic<std::size_t> bestMaxBagSize(maxBagSize);
+
+        std::atomic<std::size_t> nextAlgorithmIndex(0);
+
+        std::mutex resultMutex;
+
+        htd::ITreeDecomposition * ret = nullptr;
+
+        std::size_t retMaxBagSize = maxBagSize;
+
+        std::size_t retAlgorithmIndex = algorithms_.size();
+
+        auto updateBound = [&](std::size_t currentMaxBagSize)
+        {
+            std::size_t expected = bestMaxBagSize.load();
+
+            while (currentMaxBagSize < expected && !bestMaxBagSize.compare_exchange_weak(expected, currentMaxBagSize))
+            {
+
+            }
+        };
+
+        /* Each base algorithm re-seeds the random number generator of its thread with a seed derived from its index. Base algorithms which prune with the shared bound still see a timing-dependent bound, so the returned decomposition may differ between runs. */
+        std::uint_fast32_t randomSeed = htd::randomNumberGenerator()();
+
+        auto worker = [&]()
+        {
+            for (std::size_t index = nextAlgorithmIndex++; index < algorithms_.size() && !managementInstance.isTerminated(); index = nextAlgorithmIndex++)
+            {
+                htd::seedRandomNumberGenerator(htd::deriveRandomSeed(randomSeed, index));
+
+                std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithms_[index]->clone());
+
+                std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+                for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+                {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                    clonedManipulationOperations.push_back(operation->clone());
+#else
+                    clonedManipulationOperations.push_back(operation->cloneDecompositionManipulationOperation());
+#endif
+                }
+
+                htd::ITreeDecomposition * currentDecomposition = nullptr;
+
+                htd::IWidthMinimizingTreeDecompositionAlgorithm * widthMinimizingTreeDecompositionAlgorithm = dynamic_cast<htd::IWidthMinimizingTreeDecompositionAlgorithm *>(algorithm.get());
+
+                if (widthMinimizingTreeDecompositionAlgorithm != nullptr)
+                {
+                    currentDecomposition =
+                        widthMinimizingTreeDecompositionAlgorithm->computeImprovedDecomposition(graph, preprocessedGraph, clonedManipulationOperations, [&](const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, const htd::FitnessEvaluation & fitness)
+                        {
+                            std::lock_guard<std::mutex> lock(resultMutex);
+
+                            updateBound(decomposition.maximumBagSize());
+
+                            progressCallback(graph, decomposition, fitness);
+                        }, [&]() { return bestMaxBagSize.load() - 1; });
+                }
+                else
+                {
+                    currentDecomposition = algorithm->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+
+                    if (currentDecomposition != nullptr)
+                    {
+                        if (!managementInstance.isTerminated() || algorithm->isSafelyInterruptible())
+                        {
+                            std::lock_guard<std::mutex> lock(resultMutex);
+
+                            progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentDecomposition->maximumBagSize()))));
+                        }
+                        else
+                        {
+                            delete currentDecomposition;
+
+                            currentDecomposition = nullptr;
+                        }
+                    }
+                }
+
+                if (currentDecomposition != nullptr)
+                {
+                    std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
+
+                    std::lock_guard<std::mutex> lock(resultMutex);
+
+                    updateBound(currentMaxBagSize);
+
+                    if (currentMaxBagSize < retMaxBagSize || (ret != nullptr && currentMaxBagSize == retMaxBagSize && index < retAlgorithmIndex))
+                    {
+                        delete ret;
+
+                        ret = currentDecomposition;
+
+                        retMaxBagSize = currentMaxBagSize;
+
+                        retAlgorithmIndex = index;
+                    }
+                    else
+                    {
+                        delete currentDecomposition;
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(worker);
+        }
+
+        {
+            htd::RandomNumberGeneratorGuard randomNumberGeneratorGuard;
+
+            worker();
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+
+        return ret;
+    }
 };
 
 htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::CombinedWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -110,6 +286,16 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::addDecompositionAlg
     implementation_->algorithms_.push_back(algorithm);
 }
 
+std::size_t htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
 {
     return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>(), [](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &){});
@@ -227,6 +413,20 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    std::size_t threadCount = implementation_->effectiveThreadCount();
+
+    if (threadCount > 1)
+    {
+        htd::ITreeDecomposition * ret = implementation_->computeImprovedDecompositionInParallel(graph, preprocessedGraph, manipulationOperations, progressCallback, maxBagSize, threadCount);
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
     std::size_t bestMaxBagSize = maxBagSize;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
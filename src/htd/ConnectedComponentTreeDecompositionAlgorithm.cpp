@@ -0,0 +1,979 @@
+/*
+ * File:   ConnectedComponentTreeDecompositionAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP
+#define HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+
+#include <htd/ConnectedComponentTreeDecompositionAlgorithm.hpp>
+#include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/MultiHypergraphFactory.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+#include <htd/GraphLabeling.hpp>
+#include <htd/ILabelingFunction.hpp>
+#include <htd/ITreeDecompositionManipulationOperation.hpp>
+#include <htd/IMutableTreeDecomposition.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/MinDegreeOrderingAlgorithm.hpp>
+#include <htd/MinFillOrderingAlgorithm.hpp>
+#include <htd/PreprocessedGraph.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ConnectedComponentTreeDecompositionAlgorithm.
+ */
+struct htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager  The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), algorithm_(nullptr), smallComponentAlgorithm_(nullptr), smallComponentSizeLimit_(1024), threadCount_(1), computeInducedEdges_(true), labelingFunctions_(), postProcessingOperations_()
+    {
+        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
+
+        algorithm->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(manager));
+
+        algorithm_ = algorithm;
+
+        htd::BucketEliminationTreeDecompositionAlgorithm * smallComponentAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
+
+        smallComponentAlgorithm->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(manager));
+
+        smallComponentAlgorithm_ = smallComponentAlgorithm;
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), smallComponentAlgorithm_(original.smallComponentAlgorithm_->clone()), smallComponentSizeLimit_(original.smallComponentSizeLimit_), threadCount_(original.threadCount_), computeInducedEdges_(original.computeInducedEdges_), labelingFunctions_(), postProcessingOperations_()
+    {
+        for (htd::ILabelingFunction * labelingFunction : original.labelingFunctions_)
+        {
+    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            labelingFunctions_.push_back(labelingFunction->clone());
+    #else
+            labelingFunctions_.push_back(labelingFunction->cloneLabelingFunction());
+    #endif
+        }
+
+        for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : original.postProcessingOperations_)
+        {
+    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            postProcessingOperations_.push_back(postProcessingOperation->clone());
+    #else
+            postProcessingOperations_.push_back(postProcessingOperation->cloneTreeDecompositionManipulationOperation());
+    #endif
+        }
+    }
+
+    virtual ~Implementation()
+    {
+        delete algorithm_;
+        delete smallComponentAlgorithm_;
+
+        for (auto & labelingFunction : labelingFunctions_)
+        {
+            delete labelingFunction;
+        }
+
+        for (auto & postProcessingOperation : postProcessingOperations_)
+        {
+            delete postProcessingOperation;
+        }
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The decomposition algorithm which is used to decompose components with more than smallComponentSizeLimit_ vertices.
+     */
+    htd::ITreeDecompositionAlgorithm * algorithm_;
+
+    /**
+     *  The decomposition algorithm which is used to decompose components with at most smallComponentSizeLimit_ vertices.
+     */
+    htd::ITreeDecompositionAlgorithm * smallComponentAlgorithm_;
+
+    /**
+     *  The maximum number of vertices of a component which is decomposed by the small-component decomposition algorithm.
+     */
+    std::size_t smallComponentSizeLimit_;
+
+    /**
+     *  The number of worker threads which shall be used to decompose the components.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
+     */
+    bool computeInducedEdges_;
+
+    /**
+     *  The labeling functions which are applied after the decomposition was computed.
+     */
+    std::vector<htd::ILabelingFunction *> labelingFunctions_;
+
+    /**
+     *  The manipuation operations which are applied after the decomposition was computed.
+     */
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
+
+    /**
+     *  Structure representing the decomposition of a single component in terms of the input graph.
+     */
+    struct ComponentDecomposition
+    {
+        /**
+         *  The position of the parent of each node or (htd::index_t)-1 for the root. Each node is stored after its parent.
+         */
+        std::vector<htd::index_t> parents;
+
+        /**
+         *  The bag content of each node in terms of the vertices of the input graph.
+         */
+        std::vector<std::vector<htd::vertex_t>> bags;
+
+        /**
+         *  The positions of the hyperedges of the input graph which are induced by the bag of each node.
+         */
+        std::vector<std::vector<htd::index_t>> inducedEdges;
+    };
+
+    /**
+     *  Determine the connected components of the given graph based on its preprocessed format.
+     *
+     *  The remaining vertices are grouped via their preprocessed neighborhoods. The vertices eliminated during the
+     *  preprocessing phase lost their neighborhoods, hence they are joined with the endpoints of their hyperedges.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] components          The connected components of the input graph in terms of its vertex identifiers.
+     */
+    void determineComponents(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & components) const;
+
+    /**
+     *  Compute the decompositions of the given components of size at least two and attach them, together with the
+     *  components consisting of a single vertex, to a new root with an empty bag.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] components           The connected components of the input graph. The vertices of each component must be sorted in ascending order.
+     *
+     *  @return A mutable tree decomposition of the given graph or a null-pointer in case that the decomposition of a component failed or the algorithm was terminated.
+     */
+    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<std::vector<htd::vertex_t>> & components) const;
+
+    /**
+     *  Apply the given manipulation operations and labeling functions to the given decomposition.
+     *
+     *  @param[in] graph                    The graph which was decomposed.
+     *  @param[in] decomposition            The decomposition of the given graph.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied after the manipulation operations defined globally for the algorithm.
+     */
+    void applyManipulationOperations(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const;
+};
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) : implementation_(new Implementation(manager))
+{
+    setManipulationOperations(manipulationOperations);
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::ConnectedComponentTreeDecompositionAlgorithm(const htd::ConnectedComponentTreeDecompositionAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm::~ConnectedComponentTreeDecompositionAlgorithm()
+{
+
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::ITreeDecomposition * ret = computeDecomposition(graph, *preprocessedGraph, manipulationOperations);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::ITreeDecomposition * ret = nullptr;
+
+    std::vector<std::vector<htd::vertex_t>> components;
+
+    implementation_->determineComponents(graph, preprocessedGraph, components);
+
+    if (components.size() == 1)
+    {
+        /* A connected graph is handed over to the decomposition algorithm selected by its size, including all manipulation operations. */
+        std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            clonedManipulationOperations.push_back(operation->clone());
+#else
+            clonedManipulationOperations.push_back(operation->cloneTreeDecompositionManipulationOperation());
+#endif
+        }
+
+        for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            clonedManipulationOperations.push_back(labelingFunction->clone());
+#else
+            clonedManipulationOperations.push_back(labelingFunction->cloneLabelingFunction());
+#endif
+        }
+
+        clonedManipulationOperations.insert(clonedManipulationOperations.end(), manipulationOperations.begin(), manipulationOperations.end());
+
+        if (components[0].size() <= implementation_->smallComponentSizeLimit_)
+        {
+            ret = implementation_->smallComponentAlgorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+        }
+        else
+        {
+            ret = implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+        }
+    }
+    else
+    {
+        for (std::vector<htd::vertex_t> & component : components)
+        {
+            std::sort(component.begin(), component.end());
+        }
+
+        htd::IMutableTreeDecomposition * decomposition = implementation_->computeMutableDecomposition(graph, preprocessedGraph, components);
+
+        if (decomposition != nullptr)
+        {
+            implementation_->applyManipulationOperations(graph, *decomposition, manipulationOperations);
+        }
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        ret = decomposition;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->algorithm_;
+
+    implementation_->algorithm_ = algorithm;
+
+    implementation_->algorithm_->setComputeInducedEdgesEnabled(implementation_->computeInducedEdges_);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setSmallComponentDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->smallComponentAlgorithm_;
+
+    implementation_->smallComponentAlgorithm_ = algorithm;
+
+    implementation_->smallComponentAlgorithm_->setComputeInducedEdgesEnabled(implementation_->computeInducedEdges_);
+}
+
+std::size_t htd::ConnectedComponentTreeDecompositionAlgorithm::smallComponentSizeLimit(void) const
+{
+    return implementation_->smallComponentSizeLimit_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setSmallComponentSizeLimit(std::size_t smallComponentSizeLimit)
+{
+    implementation_->smallComponentSizeLimit_ = smallComponentSizeLimit;
+}
+
+std::size_t htd::ConnectedComponentTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (auto & labelingFunction : implementation_->labelingFunctions_)
+    {
+        delete labelingFunction;
+    }
+
+    for (auto & postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        delete postProcessingOperation;
+    }
+
+    implementation_->labelingFunctions_.clear();
+
+    implementation_->postProcessingOperations_.clear();
+
+    addManipulationOperations(manipulationOperations);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation)
+{
+    bool assigned = false;
+
+    htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(manipulationOperation);
+
+    if (labelingFunction != nullptr)
+    {
+        implementation_->labelingFunctions_.emplace_back(labelingFunction);
+
+        assigned = true;
+    }
+
+    htd::ITreeDecompositionManipulationOperation * newManipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(manipulationOperation);
+
+    if (newManipulationOperation != nullptr)
+    {
+        implementation_->postProcessingOperations_.emplace_back(newManipulationOperation);
+
+        assigned = true;
+    }
+
+    if (!assigned)
+    {
+        delete manipulationOperation;
+    }
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        addManipulationOperation(operation);
+    }
+}
+
+bool htd::ConnectedComponentTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
+{
+    return false;
+}
+
+bool htd::ConnectedComponentTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
+{
+    return implementation_->computeInducedEdges_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled)
+{
+    implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
+
+    implementation_->algorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
+
+    implementation_->smallComponentAlgorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
+}
+
+const htd::LibraryInstance * htd::ConnectedComponentTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+
+    implementation_->algorithm_->setManagementInstance(manager);
+
+    implementation_->smallComponentAlgorithm_->setManagementInstance(manager);
+}
+
+htd::ConnectedComponentTreeDecompositionAlgorithm * htd::ConnectedComponentTreeDecompositionAlgorithm::clone(void) const
+{
+    return new htd::ConnectedComponentTreeDecompositionAlgorithm(*this);
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::determineComponents(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & components) const
+{
+    const std::vector<htd::vertex_t> & vertexNames = preprocessedGraph.vertexNames();
+
+    std::size_t vertexCount = vertexNames.size();
+
+    /* The vertices of the preprocessed graph are merged in a disjoint-set forest whose roots are the smallest positions of their sets. */
+    std::vector<htd::vertex_t> representatives(vertexCount);
+
+    std::iota(representatives.begin(), representatives.end(), 0);
+
+    auto findRepresentative = [&](htd::vertex_t vertex)
+    {
+        while (representatives[vertex] != vertex)
+        {
+            representatives[vertex] = representatives[representatives[vertex]];
+
+            vertex = representatives[vertex];
+        }
+
+        return vertex;
+    };
+
+    auto merge = [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        vertex1 = findRepresentative(vertex1);
+        vertex2 = findRepresentative(vertex2);
+
+        if (vertex1 < vertex2)
+        {
+            representatives[vertex2] = vertex1;
+        }
+        else if (vertex2 < vertex1)
+        {
+            representatives[vertex1] = vertex2;
+        }
+    };
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+        {
+            merge(vertex, neighbor);
+        }
+    }
+
+    const std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
+
+    if (!eliminationSequence.empty())
+    {
+        htd::vertex_t maximumVertex = *std::max_element(vertexNames.begin(), vertexNames.end());
+
+        /* The position of each vertex of the input graph within the preprocessed graph. */
+        std::vector<htd::vertex_t> preprocessedPositions(maximumVertex + 1);
+
+        for (htd::index_t index = 0; index < vertexCount; ++index)
+        {
+            preprocessedPositions[vertexNames[index]] = index;
+        }
+
+        std::vector<bool> eliminated(maximumVertex + 1, false);
+
+        /* In contrast to the remaining vertices, the partial elimination ordering consists of the actual vertex identifiers. */
+        for (htd::vertex_t vertex : eliminationSequence)
+        {
+            eliminated[vertex] = true;
+        }
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            if (std::any_of(hyperedge.begin(), hyperedge.end(), [&](htd::vertex_t vertex) { return eliminated[vertex]; }))
+            {
+                htd::vertex_t first = preprocessedPositions[hyperedge[0]];
+
+                for (htd::vertex_t vertex : hyperedge)
+                {
+                    merge(first, preprocessedPositions[vertex]);
+                }
+            }
+        }
+    }
+
+    std::vector<htd::index_t> componentIndices(vertexCount, (htd::index_t)-1);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        htd::vertex_t representative = findRepresentative(vertex);
+
+        if (componentIndices[representative] == (htd::index_t)-1)
+        {
+            componentIndices[representative] = components.size();
+
+            components.emplace_back();
+        }
+
+        components[componentIndices[representative]].push_back(vertexNames[vertex]);
+    }
+}
+
+htd::IMutableTreeDecomposition * htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<std::vector<htd::vertex_t>> & components) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::size_t componentCount = components.size();
+
+    htd::vertex_t maximumVertex = 0;
+
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        maximumVertex = std::max(maximumVertex, component.back());
+    }
+
+    /* For each vertex of the input graph, the index of its component and its 0-based position within the component. */
+    std::vector<htd::index_t> componentIndices(maximumVertex + 1);
+
+    std::vector<htd::vertex_t> localPositions(maximumVertex + 1);
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        const std::vector<htd::vertex_t> & component = components[index];
+
+        for (htd::index_t position = 0; position < component.size(); ++position)
+        {
+            componentIndices[component[position]] = index;
+
+            localPositions[component[position]] = position;
+        }
+    }
+
+    std::vector<std::vector<htd::index_t>> componentEdgePositions(componentCount);
+
+    std::vector<htd::index_t> emptyEdgePositions;
+
+    htd::index_t edgePosition = 0;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        if (hyperedge.empty())
+        {
+            emptyEdgePositions.push_back(edgePosition);
+        }
+        else
+        {
+            componentEdgePositions[componentIndices[hyperedge[0]]].push_back(edgePosition);
+        }
+
+        ++edgePosition;
+    }
+
+    std::vector<std::vector<htd::vertex_t>> componentEliminationSequences(componentCount);
+
+    /* In contrast to the remaining vertices, the partial elimination ordering consists of the actual vertex identifiers. */
+    for (htd::vertex_t vertex : preprocessedGraph.eliminationSequence())
+    {
+        componentEliminationSequences[componentIndices[vertex]].push_back(htd::Vertex::FIRST + localPositions[vertex]);
+    }
+
+    std::vector<std::vector<htd::vertex_t>> componentRemainingVertices(componentCount);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        htd::vertex_t vertexName = preprocessedGraph.vertexName(vertex);
+
+        componentRemainingVertices[componentIndices[vertexName]].push_back(localPositions[vertexName]);
+    }
+
+    /* The position of each vertex of the input graph within the preprocessed graph. */
+    std::vector<htd::vertex_t> preprocessedPositions(maximumVertex + 1);
+
+    const std::vector<htd::vertex_t> & vertexNames = preprocessedGraph.vertexNames();
+
+    for (htd::index_t index = 0; index < vertexNames.size(); ++index)
+    {
+        preprocessedPositions[vertexNames[index]] = index;
+    }
+
+    /* Components consisting of a single vertex are attached directly, all other components are decomposed by the workers, largest components first. */
+    std::vector<htd::index_t> pendingComponents;
+
+    for (htd::index_t index = 0; index < componentCount; ++index)
+    {
+        if (components[index].size() > 1)
+        {
+            pendingComponents.push_back(index);
+        }
+    }
+
+    std::stable_sort(pendingComponents.begin(), pendingComponents.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return components[index1].size() > components[index2].size();
+    });
+
+    std::vector<ComponentDecomposition> componentDecompositions(componentCount);
+
+    std::atomic<htd::index_t> nextComponent(0);
+
+    std::atomic<bool> failed(false);
+
+    /* Components are seeded by index and write to their own slot, which is joined in index order, so the thread assignment does not affect the result. */
+    std::uint_fast32_t randomSeed = htd::randomNumberGenerator()();
+
+    auto worker = [&]()
+    {
+        std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+        std::unique_ptr<htd::ITreeDecompositionAlgorithm> smallComponentAlgorithm(smallComponentAlgorithm_->clone());
+
+        for (htd::index_t pendingIndex = nextComponent++;
+             pendingIndex < pendingComponents.size() && !failed.load() && !managementInstance.isTerminated();
+             pendingIndex = nextComponent++)
+        {
+            htd::index_t componentIndex = pendingComponents[pendingIndex];
+
+            const std::vector<htd::vertex_t> & component = components[componentIndex];
+
+            const std::vector<htd::index_t> & edgePositions = componentEdgePositions[componentIndex];
+
+            std::size_t componentSize = component.size();
+
+            std::unique_ptr<htd::IMutableMultiHypergraph> subgraph(managementInstance.multiHypergraphFactory().createInstance(componentSize));
+
+            std::vector<htd::vertex_t> elements;
+
+            for (htd::index_t index = 0; index < edgePositions.size(); ++index)
+            {
+                const htd::Hyperedge & hyperedge = graph.hyperedgeAtPosition(edgePositions[index]);
+
+                htd::id_t edgeId = htd::Id::UNKNOWN;
+
+                if (hyperedge.size() == 2)
+                {
+                    edgeId = subgraph->addEdge(htd::Vertex::FIRST + localPositions[hyperedge[0]], htd::Vertex::FIRST + localPositions[hyperedge[1]]);
+                }
+                else
+                {
+                    elements.clear();
+
+                    for (htd::vertex_t vertex : hyperedge)
+                    {
+                        elements.push_back(htd::Vertex::FIRST + localPositions[vertex]);
+                    }
+
+                    edgeId = subgraph->addEdge(elements);
+                }
+
+                /* The hyperedges of the new subgraph are numbered consecutively, hence their identifiers can be mapped back via edgePositions. */
+                HTD_ASSERT(edgeId == htd::Id::FIRST + index)
+
+                HTD_UNUSED(edgeId)
+            }
+
+            std::vector<htd::vertex_t> names(componentSize);
+
+            std::vector<std::vector<htd::vertex_t>> neighborhood(componentSize);
+
+            for (htd::index_t position = 0; position < componentSize; ++position)
+            {
+                names[position] = htd::Vertex::FIRST + position;
+
+                std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[position];
+
+                for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(preprocessedPositions[component[position]]))
+                {
+                    currentNeighborhood.push_back(localPositions[preprocessedGraph.vertexName(neighbor)]);
+                }
+
+                std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+            }
+
+            std::vector<htd::vertex_t> eliminationSequence(componentEliminationSequences[componentIndex]);
+
+            std::vector<htd::vertex_t> remainingVertices(componentRemainingVertices[componentIndex]);
+
+            std::sort(remainingVertices.begin(), remainingVertices.end());
+
+            htd::PreprocessedGraph componentGraph(std::move(names),
+                                                  std::move(neighborhood),
+                                                  std::move(eliminationSequence),
+                                                  std::move(remainingVertices),
+                                                  edgePositions.size(),
+                                                  std::min(preprocessedGraph.minTreeWidth(), componentSize - 1));
+
+            htd::seedRandomNumberGenerator(htd::deriveRandomSeed(randomSeed, componentIndex));
+
+            const htd::ITreeDecompositionAlgorithm & selectedAlgorithm = componentSize <= smallComponentSizeLimit_ ? *smallComponentAlgorithm : *algorithm;
+
+            std::unique_ptr<htd::ITreeDecomposition> decomposition(selectedAlgorithm.computeDecomposition(*subgraph, componentGraph));
+
+            if (decomposition != nullptr && !managementInstance.isTerminated())
+            {
+                ComponentDecomposition & result = componentDecompositions[componentIndex];
+
+                std::vector<std::pair<htd::vertex_t, htd::index_t>> stack;
+
+                stack.emplace_back(decomposition->root(), (htd::index_t)-1);
+
+                while (!stack.empty())
+                {
+                    htd::vertex_t node = stack.back().first;
+
+                    result.parents.push_back(stack.back().second);
+
+                    stack.pop_back();
+
+                    std::vector<htd::vertex_t> bag;
+
+                    for (htd::vertex_t vertex : decomposition->bagContent(node))
+                    {
+                        bag.push_back(component[vertex - htd::Vertex::FIRST]);
+                    }
+
+                    result.bags.push_back(std::move(bag));
+
+                    std::vector<htd::index_t> inducedEdges;
+
+                    for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(node))
+                    {
+                        inducedEdges.push_back(edgePositions[hyperedge.id() - htd::Id::FIRST]);
+                    }
+
+                    result.inducedEdges.push_back(std::move(inducedEdges));
+
+                    htd::index_t nodePosition = result.parents.size() - 1;
+
+                    for (htd::vertex_t child : decomposition->children(node))
+                    {
+                        stack.emplace_back(child, nodePosition);
+                    }
+                }
+            }
+            else
+            {
+                failed = true;
+            }
+        }
+    };
+
+    std::size_t threadCount = threadCount_;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    threadCount = std::max(std::min(threadCount, pendingComponents.size()), (std::size_t)1);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(worker);
+    }
+
+    {
+        htd::RandomNumberGeneratorGuard randomNumberGeneratorGuard;
+
+        worker();
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    htd::IMutableTreeDecomposition * ret = nullptr;
+
+    if (!failed.load() && !managementInstance.isTerminated())
+    {
+        ret = managementInstance.treeDecompositionFactory().createInstance();
+
+        htd::vertex_t root = htd::Vertex::UNKNOWN;
+
+        if (computeInducedEdges_)
+        {
+            root = ret->insertRoot(std::vector<htd::vertex_t>(), graph.hyperedgesAtPositions(std::move(emptyEdgePositions)));
+        }
+        else
+        {
+            root = ret->insertRoot();
+        }
+
+        std::vector<htd::vertex_t> nodes;
+
+        for (htd::index_t index = 0; index < componentCount; ++index)
+        {
+            if (components[index].size() == 1)
+            {
+                if (computeInducedEdges_)
+                {
+                    ret->addChild(root, std::vector<htd::vertex_t>(components[index]), graph.hyperedgesAtPositions(std::move(componentEdgePositions[index])));
+                }
+                else
+                {
+                    ret->addChild(root, std::vector<htd::vertex_t>(components[index]), htd::FilteredHyperedgeCollection());
+                }
+            }
+            else
+            {
+                ComponentDecomposition & componentDecomposition = componentDecompositions[index];
+
+                nodes.clear();
+
+                for (htd::index_t position = 0; position < componentDecomposition.parents.size(); ++position)
+                {
+                    htd::index_t parent = componentDecomposition.parents[position];
+
+                    nodes.push_back(ret->addChild(parent == (htd::index_t)-1 ? root : nodes[parent],
+                                                  std::move(componentDecomposition.bags[position]),
+                                                  graph.hyperedgesAtPositions(std::move(componentDecomposition.inducedEdges[position]))));
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+void htd::ConnectedComponentTreeDecompositionAlgorithm::Implementation::applyManipulationOperations(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(operation);
+
+        if (labelingFunction != nullptr)
+        {
+            labelingFunctions.push_back(labelingFunction);
+        }
+
+        htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(operation);
+
+        if (manipulationOperation != nullptr)
+        {
+            postProcessingOperations.push_back(manipulationOperation);
+        }
+    }
+
+    for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations_)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (const htd::ILabelingFunction * labelingFunction : labelingFunctions_)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+
+    for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTTREEDECOMPOSITIONALGORITHM_CPP */
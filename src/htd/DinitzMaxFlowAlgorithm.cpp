@@ -31,13 +31,147 @@
 #include <htd/IFlow.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <stack>
 #include <stdexcept>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace htd
 {
+    /**
+     *  Residual graph of a flow network.
+     *
+     *  Each edge of the flow network is represented by a forward arc and a paired reverse arc. The arcs are stored
+     *  contiguously, grouped by their tail vertex and sorted by their head vertex within each group, so that the
+     *  memory consumption is linear in the number of vertices and edges of the flow network.
+     */
+    struct ResidualNetwork
+    {
+        /**
+         *  Constructor of the residual graph of a flow network in which no flow is present.
+         *
+         *  @param[in] flowNetwork  The flow network.
+         */
+        ResidualNetwork(const htd::IFlowNetworkStructure & flowNetwork) : offsets_(flowNetwork.vertexCount() + 1, 0), heads_(), capacities_(), residualCapacities_(), reverseArcs_()
+        {
+            std::size_t vertexCount = flowNetwork.vertexCount();
+
+            std::vector<htd::vertex_t> tails;
+            std::vector<htd::vertex_t> heads;
+            std::vector<std::size_t> capacities;
+
+            for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+            {
+                for (htd::vertex_t neighbor : flowNetwork.neighbors(vertex))
+                {
+                    std::size_t capacity = flowNetwork.capacity(vertex, neighbor);
+
+                    if (capacity > 0 && neighbor != vertex)
+                    {
+                        tails.push_back(vertex);
+                        heads.push_back(neighbor);
+                        capacities.push_back(capacity);
+
+                        tails.push_back(neighbor);
+                        heads.push_back(vertex);
+                        capacities.push_back(0);
+                    }
+                }
+            }
+
+            std::size_t arcCount = tails.size();
+
+            /* Sort the arcs by their head and afterwards stably by their tail using two passes of counting sort. */
+            std::vector<htd::index_t> orderByHead(arcCount);
+            std::vector<htd::index_t> positions(arcCount);
+
+            std::vector<htd::index_t> bucketStarts(vertexCount + 1, 0);
+
+            for (htd::vertex_t head : heads)
+            {
+                ++bucketStarts[head + 1];
+            }
+
+            for (htd::index_t index = 0; index < vertexCount; ++index)
+            {
+                bucketStarts[index + 1] += bucketStarts[index];
+            }
+
+            for (htd::index_t arc = 0; arc < arcCount; ++arc)
+            {
+                orderByHead[bucketStarts[heads[arc]]++] = arc;
+            }
+
+            for (htd::vertex_t tail : tails)
+            {
+                ++offsets_[tail + 1];
+            }
+
+            for (htd::index_t index = 0; index < vertexCount; ++index)
+            {
+                offsets_[index + 1] += offsets_[index];
+            }
+
+            std::copy(offsets_.begin(), offsets_.end() - 1, bucketStarts.begin());
+
+            for (htd::index_t arc : orderByHead)
+            {
+                positions[arc] = bucketStarts[tails[arc]]++;
+            }
+
+            heads_.resize(arcCount);
+            capacities_.resize(arcCount);
+            reverseArcs_.resize(arcCount);
+
+            for (htd::index_t arc = 0; arc < arcCount; ++arc)
+            {
+                htd::index_t position = positions[arc];
+
+                heads_[position] = heads[arc];
+
+                capacities_[position] = capacities[arc];
+
+                reverseArcs_[position] = positions[arc ^ 1];
+            }
+
+            residualCapacities_ = capacities_;
+        }
+
+        /**
+         *  Getter for the number of vertices of the residual graph.
+         *
+         *  @return The number of vertices of the residual graph.
+         */
+        std::size_t vertexCount(void) const
+        {
+            return offsets_.size() - 1;
+        }
+
+        /**
+         *  The position of the first arc of each vertex. The arcs of vertex v are located at positions [offsets_[v], offsets_[v + 1]).
+         */
+        std::vector<htd::index_t> offsets_;
+
+        /**
+         *  The head vertex of each arc.
+         */
+        std::vector<htd::vertex_t> heads_;
+
+        /**
+         *  The capacity of each arc. Reverse arcs have capacity zero.
+         */
+        std::vector<std::size_t> capacities_;
+
+        /**
+         *  The residual capacity of each arc.
+         */
+        std::vector<std::size_t> residualCapacities_;
+
+        /**
+         *  The position of the paired reverse arc of each arc.
+         */
+        std::vector<htd::index_t> reverseArcs_;
+    };
+
     /**
      *  Internal implementation of the htd::IFlow interface.
      */
@@ -47,13 +181,17 @@ namespace htd
             /**
              *  Constructor of a new flow data structure.
              *
-             *  @param[in] vertexCount  The number of vertices of the flow data structure.
-             *  @param[in] source       The source vertex.
-             *  @param[in] target       The target vertex.
+             *  @param[in] network  The residual graph from which the flow shall be derived. The arrays of the residual graph are moved into the flow data structure.
+             *  @param[in] source   The source vertex.
+             *  @param[in] target   The target vertex.
+             *  @param[in] value    The value of the flow.
              */
-            Flow(std::size_t vertexCount, htd::vertex_t source, htd::vertex_t target) : flow_(vertexCount, std::vector<long long>(vertexCount)), source_(source), target_(target)
+            Flow(htd::ResidualNetwork && network, htd::vertex_t source, htd::vertex_t target, std::size_t value) : offsets_(std::move(network.offsets_)), heads_(std::move(network.heads_)), flow_(heads_.size()), source_(source), target_(target), value_(value)
             {
-
+                for (htd::index_t arc = 0; arc < heads_.size(); ++arc)
+                {
+                    flow_[arc] = static_cast<long long>(network.capacities_[arc] - network.residualCapacities_[arc]);
+                }
             }
 
             /**
@@ -61,14 +199,14 @@ namespace htd
              *
              *  @param[in] original The original flow data structure.
              */
-            Flow(const Flow & original) : flow_(original.flow_), source_(original.source_), target_(original.target_)
+            Flow(const Flow & original) : offsets_(original.offsets_), heads_(original.heads_), flow_(original.flow_), source_(original.source_), target_(original.target_), value_(original.value_)
             {
 
             }
 
             std::size_t vertexCount(void) const HTD_OVERRIDE
             {
-                return flow_.size();
+                return offsets_.size() - 1;
             }
 
             htd::vertex_t source(void) const HTD_OVERRIDE
@@ -83,21 +221,24 @@ namespace htd
 
             std::size_t value(void) const HTD_OVERRIDE
             {
-                std::size_t ret = 0;
-
-                for (const std::vector<long long> & current : flow_)
-                {
-                    ret = ret + static_cast<std::size_t>(current[target_]);
-                }
-
-                return ret;
+                return value_;
             }
 
             virtual long long flow(htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE
             {
                 HTD_ASSERT(source < vertexCount() && target < vertexCount())
 
-                return flow_[source][target];
+                long long ret = 0;
+
+                auto first = heads_.begin() + offsets_[source];
+                auto last = heads_.begin() + offsets_[source + 1];
+
+                for (auto it = std::lower_bound(first, last, target); it != last && *it == target; ++it)
+                {
+                    ret += flow_[static_cast<htd::index_t>(it - heads_.begin())];
+                }
+
+                return ret;
             }
 
             Flow * clone(void) const HTD_OVERRIDE
@@ -105,10 +246,21 @@ namespace htd
                 return new Flow(*this);
             }
 
+        private:
+            /**
+             *  The position of the first arc of each vertex within the residual graph.
+             */
+            std::vector<htd::index_t> offsets_;
+
             /**
-             *  The flow.
+             *  The head vertex of each arc of the residual graph.
              */
-            std::vector<std::vector<long long>> flow_;
+            std::vector<htd::vertex_t> heads_;
+
+            /**
+             *  The flow along each arc of the residual graph. The flow along a reverse arc is the negated flow along its paired forward arc.
+             */
+            std::vector<long long> flow_;
 
             /**
              *  The source vertex.
@@ -119,6 +271,11 @@ namespace htd
              *  The target vertex.
              */
             htd::vertex_t target_;
+
+            /**
+             *  The value of the flow.
+             */
+            std::size_t value_;
     };
 }
 
@@ -148,47 +305,30 @@ struct htd::DinitzMaxFlowAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Try to improve an existing flow.
+     *  Compute the level graph of the given residual graph, i.e., the distance of each vertex from the source vertex
+     *  when only arcs with positive residual capacity are considered.
      *
-     *  @param[in] flowNetwork  The network for which the improved flow shall be computed.
-     *  @param[in] flow         The (currently) best known flow within the given flow network.
+     *  @param[in] network  The residual graph.
+     *  @param[in] source   The source vertex.
+     *  @param[in] target   The target vertex.
+     *  @param[out] levels  The distance of each vertex from the source vertex or (std::size_t)-1 for vertices which are not relevant for the next blocking flow.
      *
-     *  @return A matrix containing the updated residual capacities or nullptr if the provided flow is already maximal.
+     *  @return True if the target vertex is reachable from the source vertex, false otherwise.
      */
-    std::vector<std::vector<std::size_t>> * improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const;
+    bool computeLevels(const htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels) const;
 
     /**
-     *  Perform an improvement step for the flow between the source and the target vertex.
+     *  Compute a blocking flow within the level graph and apply it to the given residual graph.
      *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The residual capacities which will be updated.
-     *  @param[in] distances    The distances from each vertex to the target vertex of the flow network.
+     *  @param[in] network      The residual graph which will be updated.
      *  @param[in] source       The source vertex.
      *  @param[in] target       The target vertex.
-     */
-    void performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const;
-
-    /**
-     *  Compute the minimum distances between the vertices of the given flow network to the selected target vertex.
-     *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The current residual capacities of the flow network.
-     *  @param[in] target       The target vertex.
+     *  @param[in] levels       The levels of the vertices as computed by computeLevels(). Dead ends are marked as irrelevant during the search.
+     *  @param[in] limit        The flow value at which the augmentation shall stop.
      *
-     *  @return A vector containing the distances from each vertex to the target vertex.
+     *  @return The value of the blocking flow.
      */
-    std::vector<std::size_t> * computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
-
-    /**
-     *  Compute the minimum capacity within the given path starting from the given target vertex.
-     *
-     *  @param[in] path         A sequence of vertices which defines the path to investigate.
-     *  @param[in] capacities   The current residual capacities of the flow network.
-     *  @param[in] target       The target vertex.
-     *
-     *  @return The minimum capacity within the given path.
-     */
-    std::size_t computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
+    std::size_t augmentBlockingFlow(htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels, std::size_t limit) const;
 };
 
 htd::DinitzMaxFlowAlgorithm::DinitzMaxFlowAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -203,28 +343,60 @@ htd::DinitzMaxFlowAlgorithm::~DinitzMaxFlowAlgorithm()
 
 htd::IFlow * htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    return determineMaximumFlow(flowNetwork, source, target, (std::size_t)-1);
+}
 
-    htd::Flow * ret = new htd::Flow(vertexCount, source, target);
+htd::IFlow * htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t limit) const
+{
+    return determineMaximumFlow(flowNetwork, source, target, limit, nullptr);
+}
 
-    std::vector<std::vector<std::size_t>> * capacities = implementation_->improveFlow(flowNetwork, *ret);
+htd::IFlow * htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t limit, const htd::IFlow * initialFlow) const
+{
+    HTD_ASSERT(flowNetwork.isVertex(source) && flowNetwork.isVertex(target))
 
-    while (capacities != nullptr)
+    htd::ResidualNetwork network(flowNetwork);
+
+    std::size_t value = 0;
+
+    if (initialFlow != nullptr)
     {
-        for (htd::index_t i = 0; i < vertexCount; ++i)
+        HTD_ASSERT(initialFlow->vertexCount() == network.vertexCount() && initialFlow->source() == source && initialFlow->target() == target)
+
+        for (htd::vertex_t vertex = 0; vertex < network.vertexCount(); ++vertex)
         {
-            for (htd::index_t j = 0; j < vertexCount; ++j)
+            for (htd::index_t arc = network.offsets_[vertex]; arc < network.offsets_[vertex + 1]; ++arc)
             {
-                ret->flow_[i][j] = flowNetwork.capacity(i, j) - (*capacities)[i][j];
+                if (network.capacities_[arc] > 0)
+                {
+                    long long currentFlow = initialFlow->flow(vertex, network.heads_[arc]);
+
+                    if (currentFlow > 0)
+                    {
+                        HTD_ASSERT(static_cast<std::size_t>(currentFlow) <= network.capacities_[arc])
+
+                        network.residualCapacities_[arc] -= static_cast<std::size_t>(currentFlow);
+
+                        network.residualCapacities_[network.reverseArcs_[arc]] += static_cast<std::size_t>(currentFlow);
+                    }
+                }
             }
         }
 
-        delete capacities;
+        value = initialFlow->value();
+    }
+
+    if (source != target)
+    {
+        std::vector<std::size_t> levels(network.vertexCount());
 
-        capacities = implementation_->improveFlow(flowNetwork, *ret);
+        while (value < limit && !implementation_->managementInstance_->isTerminated() && implementation_->computeLevels(network, source, target, levels))
+        {
+            value += implementation_->augmentBlockingFlow(network, source, target, levels, limit - value);
+        }
     }
 
-    return ret;
+    return new htd::Flow(std::move(network), source, target, value);
 }
 
 const htd::LibraryInstance * htd::DinitzMaxFlowAlgorithm::managementInstance(void) const HTD_NOEXCEPT
@@ -244,162 +416,128 @@ htd::DinitzMaxFlowAlgorithm * htd::DinitzMaxFlowAlgorithm::clone(void) const
     return new htd::DinitzMaxFlowAlgorithm(managementInstance());
 }
 
-std::vector<std::vector<std::size_t>> * htd::DinitzMaxFlowAlgorithm::Implementation::improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const
+bool htd::DinitzMaxFlowAlgorithm::Implementation::computeLevels(const htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    std::fill(levels.begin(), levels.end(), (std::size_t)-1);
 
-    std::vector<std::vector<std::size_t>> * ret = new std::vector<std::vector<std::size_t>>(vertexCount, std::vector<std::size_t>(vertexCount));
+    std::vector<htd::vertex_t> queue;
 
-    std::vector<std::vector<std::size_t>> & capacities = *ret;
+    queue.reserve(network.vertexCount());
 
-    for (htd::index_t i = 0; i < vertexCount; i++)
-    {
-        for (htd::index_t j = 0; j < vertexCount; j++)
-        {
-            capacities[i][j] = flowNetwork.capacity(i, j) - static_cast<std::size_t>(flow.flow_[i][j]);
-        }
-    }
+    levels[source] = 0;
 
-    std::vector<std::size_t> * distances = computeMinimumDistances(flowNetwork, capacities, flow.target_);
+    queue.push_back(source);
 
-    if ((*distances)[flow.source_] == (std::size_t)-1)
+    /* Vertices at the level of the target vertex or beyond cannot be part of a shortest augmenting path, hence they are not expanded. */
+    for (htd::index_t index = 0; index < queue.size() && levels[queue[index]] < levels[target]; ++index)
     {
-        delete ret;
+        htd::vertex_t vertex = queue[index];
 
-        ret = nullptr;
-    }
-    else
-    {
-        performImprovementStep(flowNetwork, capacities, *distances, flow.source_, flow.target_);
-    }
+        std::size_t nextLevel = levels[vertex] + 1;
 
-    delete distances;
+        for (htd::index_t arc = network.offsets_[vertex]; arc < network.offsets_[vertex + 1]; ++arc)
+        {
+            htd::vertex_t head = network.heads_[arc];
 
-    return ret;
+            if (network.residualCapacities_[arc] > 0 && levels[head] == (std::size_t)-1)
+            {
+                levels[head] = nextLevel;
+
+                queue.push_back(head);
+            }
+        }
+    }
+
+    return levels[target] != (std::size_t)-1;
 }
 
-void htd::DinitzMaxFlowAlgorithm::Implementation::performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const
+std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::augmentBlockingFlow(htd::ResidualNetwork & network, htd::vertex_t source, htd::vertex_t target, std::vector<std::size_t> & levels, std::size_t limit) const
 {
-    std::deque<htd::vertex_t> originDeque;
+    std::size_t ret = 0;
 
-    std::unordered_set<htd::vertex_t> visitedVertices;
+    std::vector<htd::index_t> currentArcs(network.offsets_.begin(), network.offsets_.end() - 1);
 
-    htd::vertex_t currentVertex = source;
+    std::vector<htd::index_t> path;
 
-    originDeque.emplace_back(currentVertex);
+    htd::vertex_t vertex = source;
 
-    std::vector<htd::vertex_t> predecessors(flowNetwork.vertexCount(), (htd::vertex_t)-1);
+    bool finished = false;
 
-    while (!originDeque.empty() && !managementInstance_->isTerminated())
+    while (!finished)
     {
-        currentVertex = originDeque.front();
-
-        if (visitedVertices.count(currentVertex) == 0)
+        if (vertex == target)
         {
-            visitedVertices.insert(currentVertex);
+            std::size_t delta = (std::size_t)-1;
 
-            if (currentVertex == target)
+            for (htd::index_t arc : path)
             {
-                std::size_t delta = computeMinimumCapacity(predecessors, capacities, target);
+                delta = std::min(delta, network.residualCapacities_[arc]);
+            }
 
-                htd::vertex_t current = currentVertex;
+            htd::index_t firstSaturatedArc = path.size();
 
-                htd::vertex_t predecessor = predecessors[currentVertex];
+            for (htd::index_t index = 0; index < path.size(); ++index)
+            {
+                htd::index_t arc = path[index];
 
-                while (predecessor != (htd::vertex_t)-1)
-                {
-                    capacities[predecessor][current] = capacities[predecessor][current] - delta;
-                    capacities[current][predecessor] = capacities[current][predecessor] + delta;
+                network.residualCapacities_[arc] -= delta;
 
-                    if (capacities[predecessor][current] == 0)
-                    {
-                        currentVertex = predecessor;
-                    }
-
-                    current = predecessor;
+                network.residualCapacities_[network.reverseArcs_[arc]] += delta;
 
-                    predecessor = predecessors[predecessor];
+                if (network.residualCapacities_[arc] == 0 && firstSaturatedArc == path.size())
+                {
+                    firstSaturatedArc = index;
                 }
             }
 
-            originDeque.pop_front();
+            ret += delta;
 
-            for (htd::vertex_t otherVertex = 0; otherVertex < flowNetwork.vertexCount(); ++otherVertex)
+            if (ret >= limit)
             {
-                if (visitedVertices.count(otherVertex) == 0 && flowNetwork.capacity(currentVertex, otherVertex) > 0 && capacities[currentVertex][otherVertex] > 0 && distances[currentVertex] == distances[otherVertex] + 1)
-                {
-                    predecessors[otherVertex] = currentVertex;
-
-                    originDeque.emplace_back(otherVertex);
-                }
+                finished = true;
             }
+
+            /* Resume the search at the tail of the first saturated arc, all arcs before it still have residual capacity. */
+            path.resize(firstSaturatedArc);
+
+            vertex = path.empty() ? source : network.heads_[path.back()];
         }
         else
         {
-            originDeque.pop_front();
-        }
-    }
-}
+            htd::index_t & currentArc = currentArcs[vertex];
 
-std::vector<std::size_t> * htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t vertexCount = flowNetwork.vertexCount();
-
-    std::vector<std::size_t> * ret = new std::vector<std::size_t>(vertexCount, (std::size_t)-1);
-
-    std::vector<std::size_t> & distances = *ret;
-
-    distances[target]=0;
-
-    std::stack<htd::vertex_t> stack;
+            htd::index_t lastArc = network.offsets_[vertex + 1];
 
-    stack.push(target);
-
-    while(!stack.empty())
-    {
-        htd::vertex_t vertex = stack.top();
+            while (currentArc < lastArc && (network.residualCapacities_[currentArc] == 0 || levels[network.heads_[currentArc]] != levels[vertex] + 1))
+            {
+                ++currentArc;
+            }
 
-        stack.pop();
+            if (currentArc < lastArc)
+            {
+                path.push_back(currentArc);
 
-        for (htd::index_t index = 0; index < vertexCount; ++index)
-        {
-            if (flowNetwork.capacity(index, vertex) > 0 && capacities[index][vertex] > 0)
+                vertex = network.heads_[currentArc];
+            }
+            else
             {
-                std::size_t distance = distances[vertex] + 1;
+                /* The vertex is a dead end within the level graph, hence it is removed from the level graph. */
+                levels[vertex] = (std::size_t)-1;
 
-                if (distance < distances[index])
+                if (path.empty())
                 {
-                    distances[index] = distance;
-
-                    stack.push(index);
+                    finished = true;
                 }
-            }
-        }
-    }
-
-    return ret;
-}
-
-std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t ret = (std::size_t)-1;
-
-    htd::vertex_t current = target;
-
-    htd::vertex_t predecessor = path[current];
+                else
+                {
+                    path.pop_back();
 
-    while (predecessor != (htd::vertex_t)-1)
-    {
-        std::size_t capacity = capacities[predecessor][current];
+                    vertex = path.empty() ? source : network.heads_[path.back()];
 
-        if (ret > capacity)
-        {
-            ret = capacity;
+                    ++currentArcs[vertex];
+                }
+            }
         }
-
-        current = predecessor;
-
-        predecessor = path[predecessor];
     }
 
     return ret;
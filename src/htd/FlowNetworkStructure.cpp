@@ -32,6 +32,7 @@
 #include <htd/VectorAdapter.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 #include <utility>
 #include <stack>
@@ -47,7 +48,7 @@ struct htd::FlowNetworkStructure::Implementation
      *
      *  @param[in] vertexCount  The number of vertices of the flow network structure.
      */
-    Implementation(std::size_t vertexCount) : vertices_(vertexCount), neighborhood_(vertexCount), capacities_(vertexCount, std::vector<std::size_t>(vertexCount))
+    Implementation(std::size_t vertexCount) : vertices_(vertexCount), neighborhood_(vertexCount), capacities_(vertexCount)
     {
         std::iota(vertices_.begin(), vertices_.end(), 0);
     }
@@ -78,7 +79,7 @@ struct htd::FlowNetworkStructure::Implementation
     std::vector<std::vector<htd::vertex_t>> neighborhood_;
 
     /**
-     *  The residual capacities of the flow network.
+     *  The capacities of the edges of the flow network. The capacities are stored in the same order as the targets of the edges in the directed neighborhood of their source vertex.
      */
     std::vector<std::vector<std::size_t>> capacities_;
 };
@@ -353,7 +354,18 @@ std::size_t htd::FlowNetworkStructure::capacity(htd::vertex_t source, htd::verte
 {
     HTD_ASSERT(isVertex(source) && isVertex(target))
 
-    return implementation_->capacities_[source][target];
+    std::size_t ret = 0;
+
+    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[source];
+
+    auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), target);
+
+    if (position != currentNeighborhood.end() && *position == target)
+    {
+        ret = implementation_->capacities_[source][static_cast<htd::index_t>(std::distance(currentNeighborhood.begin(), position))];
+    }
+
+    return ret;
 }
 
 void htd::FlowNetworkStructure::updateCapacity(htd::vertex_t source, htd::vertex_t target, std::size_t capacity)
@@ -362,14 +374,22 @@ void htd::FlowNetworkStructure::updateCapacity(htd::vertex_t source, htd::vertex
 
     std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[source];
 
+    std::vector<std::size_t> & currentCapacities = implementation_->capacities_[source];
+
     auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), target);
 
+    auto capacityPosition = currentCapacities.begin() + std::distance(currentNeighborhood.begin(), position);
+
     if (position == currentNeighborhood.end() || *position != target)
     {
         currentNeighborhood.insert(position, target);
-    }
 
-    implementation_->capacities_[source][target] = capacity;
+        currentCapacities.insert(capacityPosition, capacity);
+    }
+    else
+    {
+        *capacityPosition = capacity;
+    }
 }
 
 htd::FlowNetworkStructure * htd::FlowNetworkStructure::clone(void) const
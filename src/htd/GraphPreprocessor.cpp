@@ -33,310 +33,16 @@
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
-#include <htd/ConnectedComponentAlgorithmFactory.hpp>
-#include <htd/IConnectedComponentAlgorithm.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <numeric>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
-
-namespace htd
-{
-    /**
-     *  This class is designed to hold the information of a connected component of a preprocessed graph.
-     */
-    class PreprocessedGraphComponent : public htd::IPreprocessedGraph
-    {
-        public:
-            /**
-             *  Constructor for a new, preprocessed graph component data structure.
-             *
-             *  @param[in] preprocessedGraph    The base graph containing the component represented by the new graph component data structure.
-             *  @param[in] remainingVertices    The set of vertices which were not eliminated during the preprocessing phase.
-             *  @param[in] minTreeWidth         The lower bound for the treewidth of the preprocessed graph component.
-             */
-            PreprocessedGraphComponent(const htd::IPreprocessedGraph & preprocessedGraph,
-                                       std::vector<htd::vertex_t> && remainingVertices,
-                                       std::size_t minTreeWidth) : baseGraph_(preprocessedGraph), remainingVertices_(std::move(remainingVertices)), eliminationSequence_(), minTreeWidth_(minTreeWidth), edgeCount_(0)
-            {
-                updateEdgeCount();
-            }
-
-            /**
-             *  Copy constructor for a preprocessed graph component data structure.
-             *
-             *  @param[in] original  The original preprocessed graph component data structure.
-             */
-            PreprocessedGraphComponent(const htd::PreprocessedGraphComponent & original) : baseGraph_(original.baseGraph_), remainingVertices_(original.remainingVertices_), eliminationSequence_(original.eliminationSequence_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_)
-            {
-
-            }
-
-            /**
-             *  Destructor for a preprocessed graph component data structure.
-             */
-            virtual ~PreprocessedGraphComponent()
-            {
-
-            }
-
-            std::size_t vertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return remainingVertices_.size();
-            }
-
-            std::size_t inputGraphVertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.inputGraphVertexCount();
-            }
-
-            std::size_t edgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return edgeCount_;
-            }
-
-            std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return neighborCount(vertex);
-            }
-
-            std::size_t inputGraphEdgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.inputGraphEdgeCount();
-            }
-
-            htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE
-            {
-                return htd::ConstCollection<htd::vertex_t>::getInstance(remainingVertices_);
-            }
-
-            void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                target.insert(target.end(), remainingVertices_.begin(), remainingVertices_.end());
-            }
-
-            htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(index < remainingVertices_.size())
-
-                return remainingVertices_[index];
-            }
-
-            bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return std::binary_search(remainingVertices_.begin(),
-                                          remainingVertices_.end(),
-                                          vertex);
-            }
-
-            std::size_t isolatedVertexCount(void) const HTD_OVERRIDE
-            {
-                std::size_t ret = 0;
-
-                for (htd::vertex_t vertex : remainingVertices_)
-                {
-                    if (baseGraph_.neighborhood(vertex).empty())
-                    {
-                        ret++;
-                    }
-                }
-
-                return ret;
-            }
-
-            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE
-            {
-                htd::VectorAdapter<htd::vertex_t> ret;
-
-                auto & result = ret.container();
-
-                for (htd::vertex_t vertex : remainingVertices_)
-                {
-                    if (baseGraph_.neighborhood(vertex).empty())
-                    {
-                        result.push_back(vertex);
-                    }
-                }
-
-                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
-            }
-
-            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
-
-                HTD_ASSERT(index < isolatedVertexCollection.size())
-
-                htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
-
-                std::advance(it, index);
-
-                return *it;
-            }
-
-            bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.isIsolatedVertex(vertex);
-            }
-
-            std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighborCount(vertex);
-            }
-
-            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighbors(vertex);
-            }
-
-            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                baseGraph_.copyNeighborsTo(vertex, target);
-            }
-
-            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighborAtPosition(vertex, index);
-            }
-
-            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
-
-                return baseGraph_.isNeighbor(vertex, neighbor);
-            }
-
-            bool isConnected(void) const HTD_OVERRIDE
-            {
-                return true;
-            }
-
-            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE
-            {
-                HTD_UNUSED(vertex1)
-                HTD_UNUSED(vertex2)
-
-                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
-
-                return true;
-            }
-
-            const std::vector<htd::vertex_t> & vertexNames(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.vertexNames();
-            }
-
-            htd::vertex_t vertexName(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.vertexName(vertex);
-            }
-
-            const std::vector<std::vector<htd::vertex_t>> & neighborhood(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return baseGraph_.neighborhood();
-            }
-
-            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return baseGraph_.neighborhood(vertex);
-            }
-
-            const std::vector<htd::vertex_t> & eliminationSequence(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return eliminationSequence_;
-            }
-
-            const std::vector<htd::vertex_t> & remainingVertices(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return remainingVertices_;
-            }
-
-            std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return minTreeWidth_;
-            }
-
-    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            PreprocessedGraphComponent * clone(void) const HTD_OVERRIDE
-            {
-                return new htd::PreprocessedGraphComponent(*this);
-            }
-    #else
-            /**
-             *  Create a deep copy of the current preprocessed graph component.
-             *
-             *  @return A new PreprocessedGraphComponent object identical to the current preprocessed graph component.
-             */
-            PreprocessedGraphComponent * clone(void) const
-            {
-                return new htd::PreprocessedGraphComponent(*this);
-            }
-
-            htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE
-            {
-                return clone();
-            }
-    #endif
-
-        private:
-            /**
-             *  The base graph containing the component represented by this graph component data structure.
-             */
-            const htd::IPreprocessedGraph & baseGraph_;
-
-            /**
-             *  The set of vertices which were not eliminated during the preprocessing phase.
-             */
-            std::vector<htd::vertex_t> remainingVertices_;
-
-            /**
-             *  A partial vertex elimination ordering computed during the preprocessing phase.
-             */
-            std::vector<htd::vertex_t> eliminationSequence_;
-
-            /**
-             *  The lower bound of the treewidth of the input graph.
-             */
-            std::size_t minTreeWidth_;
-
-            /**
-             *  The number of edges in the preprocessed graph.
-             */
-            std::size_t edgeCount_;
-
-            /**
-             *  Recompute the number of edges in the graph to update the result of the function edgeCount().
-             */
-            void updateEdgeCount(void)
-            {
-                edgeCount_ = 0;
-
-                for (htd::vertex_t vertex : remainingVertices_)
-                {
-                    edgeCount_ += baseGraph_.neighborhood(vertex).size();
-                }
-
-                edgeCount_ = edgeCount_ >> 1;
-            }
-    };
-}
 
 /**
  *  Private implementation details of class htd::GraphPreprocessor.
@@ -355,6 +61,8 @@ struct htd::GraphPreprocessor::Implementation
                                                                  applyPreprocessing4_(false),
                                                                  iterationCount_(1),
                                                                  nonImprovementLimit_(0),
+                                                                 threadCount_(1),
+                                                                 cliqueSeparatorVertexLimit_(1024),
                                                                  orderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager))
     {
 
@@ -410,7 +118,19 @@ struct htd::GraphPreprocessor::Implementation
     std::size_t nonImprovementLimit_;
 
     /**
-     *  The base ordering algorithm which shall be used to eliminate all but the largest biconnected component.
+     *  The number of worker threads which shall be used for ordering the atoms of the input graph.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The maximum number of remaining vertices for which the clique minimal separators are computed.
+     *
+     *  Each computation of a clique minimal separator takes quadratic time, hence larger graphs are only split along their articulation points.
+     */
+    std::size_t cliqueSeparatorVertexLimit_;
+
+    /**
+     *  The base ordering algorithm which shall be used to order the atoms which are split off from the input graph.
      */
     htd::IWidthLimitableOrderingAlgorithm * orderingAlgorithm_;
 
@@ -573,331 +293,594 @@ struct htd::GraphPreprocessor::Implementation
     };
 
     /**
-     *  Eliminate all vertices of degree less than 2 from the graph.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  Structure holding the state of the reduction rules which are applied to the remaining graph.
      *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
+     *  The remaining vertices are kept in flat degree buckets, i.e., intrusive doubly-linked lists indexed by the
+     *  degree of the vertices. Each vertex whose neighborhood changed is put on a worklist, so that the reduction
+     *  rules only have to re-check these vertices instead of sweeping over all remaining vertices in each round.
      */
-    static bool eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                     std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                     std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                     std::vector<htd::vertex_t> & ordering);
+    struct ReductionState
+    {
+        /**
+         *  Contructor for the ReductionState data structure.
+         *
+         *  @param[in] graphNeighborhood    The neighborhood relation of the graph which shall be reduced.
+         *  @param[in] partialOrdering      The vector to which the eliminated vertices shall be appended.
+         */
+        ReductionState(std::vector<std::vector<htd::vertex_t>> & graphNeighborhood,
+                       std::vector<htd::vertex_t> & partialOrdering) : neighborhood(graphNeighborhood),
+                                                                       ordering(partialOrdering),
+                                                                       eliminated(graphNeighborhood.size(), false),
+                                                                       queued(graphNeighborhood.size(), false),
+                                                                       bucketHead(),
+                                                                       bucketDegree(graphNeighborhood.size()),
+                                                                       nextInBucket(graphNeighborhood.size()),
+                                                                       previousInBucket(graphNeighborhood.size()),
+                                                                       worklist(),
+                                                                       remainingVertexCount(graphNeighborhood.size()),
+                                                                       minTreeWidth(0)
+        {
+            for (htd::vertex_t vertex = graphNeighborhood.size(); vertex > 0; --vertex)
+            {
+                insertIntoBucket(vertex - 1);
+            }
+        }
 
-    /**
-     *  Eliminate all vertices of degree 2 from the graph.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                              std::vector<htd::vertex_t> & ordering);
+        /**
+         *  Contructor for the ReductionState data structure which is restricted to a subset of the vertices.
+         *
+         *  @param[in] graphNeighborhood    The neighborhood relation of the graph which shall be reduced.
+         *  @param[in] partialOrdering      The vector to which the eliminated vertices shall be appended.
+         *  @param[in] vertices             The vertices which shall be considered. The neighbors of these vertices must be contained in the vector as well.
+         */
+        ReductionState(std::vector<std::vector<htd::vertex_t>> & graphNeighborhood,
+                       std::vector<htd::vertex_t> & partialOrdering,
+                       const std::vector<htd::vertex_t> & vertices) : neighborhood(graphNeighborhood),
+                                                                      ordering(partialOrdering),
+                                                                      eliminated(graphNeighborhood.size(), true),
+                                                                      queued(graphNeighborhood.size(), false),
+                                                                      bucketHead(),
+                                                                      bucketDegree(graphNeighborhood.size()),
+                                                                      nextInBucket(graphNeighborhood.size()),
+                                                                      previousInBucket(graphNeighborhood.size()),
+                                                                      worklist(),
+                                                                      remainingVertexCount(vertices.size()),
+                                                                      minTreeWidth(0)
+        {
+            for (auto it = vertices.rbegin(); it != vertices.rend(); ++it)
+            {
+                eliminated[*it] = false;
 
-    /**
-     *  Eliminate all vertices of degree 3 from the graph in
-     *  case that at least two of its neighbors are adjacent.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                std::vector<htd::vertex_t> & ordering);
+                insertIntoBucket(*it);
+            }
+        }
 
-    /**
-     *  If two vertices of degree 3 have exactly the same neighbors,
-     *  eliminate both of them and connect the three neighbors so
-     *  that they form a triangle.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                              std::vector<htd::vertex_t> & ordering);
+        ~ReductionState()
+        {
 
-    /**
-     *  Eliminate all vertices from the graph for which
-     *  it holds that all its neighbors form a clique.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *  @param[in] maxDegree        The degree up to which a vertex shall be considered for this preprocessing.
-     *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                            std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                            std::vector<htd::vertex_t> & ordering,
-                                            std::size_t maxDegree,
-                                            std::size_t & minTreeWidth);
+        }
 
-    /**
-     *  Eliminate all vertices from the graph for which it
-     *  holds that at least all but one of its neighbors
-     *  form a clique.
-     *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
-     *  @param[in] ordering         The resulting, partial vertex elimination ordering.
-     *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
-     *
-     *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
-     */
-    static bool eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                  std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                  std::vector<htd::vertex_t> & ordering,
-                                                  std::size_t & minTreeWidth);
+        /**
+         *  Insert a vertex into the degree bucket corresponding to its current degree.
+         *
+         *  @param[in] vertex   The vertex which shall be inserted.
+         */
+        void insertIntoBucket(htd::vertex_t vertex)
+        {
+            std::size_t degree = neighborhood[vertex].size();
 
-    /**
-     *  Update the group to which the given vertex belongs.
-     *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     *  @param[in] oldDegree        The old degree of the vertex.
-     */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree,
-                                    std::size_t oldDegree);
+            if (degree >= bucketHead.size())
+            {
+                bucketHead.resize(degree + 1, (htd::vertex_t)-1);
+            }
 
-    /**
-     *  Update the group to which the given vertex belongs.
-     *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree);
+            htd::vertex_t head = bucketHead[degree];
 
-    /**
-     *  Decompose two sets of vertices into vertices only in the first set and vertices in both sets.
-     *
-     *  @param[in] set1                 The first set of vertices, sorted in ascending order.
-     *  @param[in] set2                 The second set of vertices, sorted in ascending order.
-     *  @param[out] resultOnlySet1      The set of vertices which are found only in the first set, sorted in ascending order.
-     *  @param[out] resultIntersection  The set of vertices which are found in both sets, sorted in ascending order.
-     */
-    void splitSets(const std::vector<htd::vertex_t> & set1,
-                   const std::vector<htd::vertex_t> & set2,
-                   std::vector<htd::vertex_t> & resultOnlySet1,
-                   std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT;
+            nextInBucket[vertex] = head;
 
-    /**
-     *  Compute largest biconnected component of the given graph and eliminate all vertices contained in the remainder.
-     *
-     *  @param[in] graph                The graph which shall be preprocessed.
-     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
-     */
-    void applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                htd::PreprocessedGraph & preprocessedGraph,
-                                                std::unordered_set<htd::vertex_t> & vertices) const;
+            previousInBucket[vertex] = (htd::vertex_t)-1;
 
-    /**
-     *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
-     *
-     *  @param[in] graph                The graph underlying the operation.
-     *  @param[in] vertices             The vertices which shall be eliminated.
-     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
-     */
-    void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
-                           htd::PreprocessedGraph & preprocessedGraph,
-                           std::size_t & minTreeWidth) const;
+            if (head != (htd::vertex_t)-1)
+            {
+                previousInBucket[head] = vertex;
+            }
 
-    /**
-     *  Iteratively compute the clique minimal separators of the given graph and remove them from the graph.
-     *
-     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
-     */
-    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                           std::unordered_set<htd::vertex_t> & vertices) const;
-};
+            bucketHead[degree] = vertex;
 
-htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
+            bucketDegree[vertex] = degree;
+        }
 
-}
+        /**
+         *  Remove a vertex from the degree bucket it is currently assigned to.
+         *
+         *  @param[in] vertex   The vertex which shall be removed.
+         */
+        void removeFromBucket(htd::vertex_t vertex)
+        {
+            htd::vertex_t next = nextInBucket[vertex];
+            htd::vertex_t previous = previousInBucket[vertex];
 
-htd::GraphPreprocessor::~GraphPreprocessor()
-{
+            if (previous != (htd::vertex_t)-1)
+            {
+                nextInBucket[previous] = next;
+            }
+            else
+            {
+                bucketHead[bucketDegree[vertex]] = next;
+            }
 
-}
+            if (next != (htd::vertex_t)-1)
+            {
+                previousInBucket[next] = previous;
+            }
+        }
 
-htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
-{
-    htd::PreprocessedGraph * ret = nullptr;
+        /**
+         *  Put a vertex on the worklist unless it is already queued or eliminated.
+         *
+         *  @param[in] vertex   The vertex which shall be re-checked.
+         */
+        void markDirty(htd::vertex_t vertex)
+        {
+            if (!queued[vertex] && !eliminated[vertex])
+            {
+                queued[vertex] = true;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+                worklist.push_back(vertex);
+            }
+        }
 
-    htd::GraphPreprocessor::Implementation::PreparedInput input(managementInstance, graph);
+        /**
+         *  Exclude a vertex from the reduction rules.
+         *
+         *  The vertex is flagged as queued without being put on the worklist, hence it is never re-checked. It does not
+         *  count as a remaining vertex, so the reduction phases stop as soon as all other vertices are eliminated.
+         *
+         *  @param[in] vertex   The vertex which shall be protected. It must not be on the worklist yet.
+         */
+        void protectVertex(htd::vertex_t vertex)
+        {
+            if (!queued[vertex] && !eliminated[vertex])
+            {
+                queued[vertex] = true;
 
-    std::size_t size = input.vertexNames.size();
-
-    std::vector<htd::vertex_t> vertexNames(input.vertexNames.begin(), input.vertexNames.end());
-
-    std::vector<std::vector<htd::vertex_t>> neighborhood(input.neighborhood.begin(), input.neighborhood.end());
-
-    if (implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_)
-    {
-        std::unordered_set<htd::vertex_t> vertices(size);
-
-        std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
-
-        std::vector<htd::vertex_t> ordering;
-        ordering.reserve(size);
-
-        std::size_t minTreeWidth = 0;
+                --remainingVertexCount;
+            }
+        }
 
-        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        /**
+         *  Put all remaining vertices of the given degree range on the worklist.
+         *
+         *  @param[in] minDegree    The minimum degree of the vertices which shall be re-checked.
+         *  @param[in] maxDegree    The maximum degree of the vertices which shall be re-checked.
+         */
+        void markDegreesDirty(std::size_t minDegree, std::size_t maxDegree)
         {
-            vertices.insert(vertex);
-
-            implementation_->assignVertexToGroup(vertex, verticesByDegree, neighborhood[vertex].size());
+            for (std::size_t degree = minDegree; degree <= maxDegree && degree < bucketHead.size(); ++degree)
+            {
+                for (htd::vertex_t vertex = bucketHead[degree]; vertex != (htd::vertex_t)-1; vertex = nextInBucket[vertex])
+                {
+                    markDirty(vertex);
+                }
+            }
         }
 
-        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+        /**
+         *  Move a vertex whose neighborhood changed to its new degree bucket and put it on the worklist.
+         *
+         *  @param[in] vertex   The vertex whose neighborhood changed.
+         */
+        void updateVertex(htd::vertex_t vertex)
         {
+            if (bucketDegree[vertex] != neighborhood[vertex].size())
+            {
+                removeFromBucket(vertex);
 
-        }
+                insertIntoBucket(vertex);
+            }
 
-        bool ok = false;
+            markDirty(vertex);
+        }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing2_)
+        /**
+         *  Eliminate a vertex from the remaining graph and append it to the partial elimination ordering.
+         *
+         *  @param[in] vertex   The vertex which shall be eliminated.
+         */
+        void eliminateVertex(htd::vertex_t vertex)
         {
-            minTreeWidth = 2;
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-            while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+            for (htd::vertex_t neighbor : currentNeighborhood)
             {
-                ok = true;
-            }
+                std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
 
-            if (ok)
-            {
-                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                {
+                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
+                // coverity[use_iterator]
+                otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                }
+                updateVertex(neighbor);
             }
+
+            removeFromBucket(vertex);
+
+            std::vector<htd::vertex_t>().swap(currentNeighborhood);
+
+            eliminated[vertex] = true;
+
+            --remainingVertexCount;
+
+            ordering.push_back(vertex);
         }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing3_)
+        /**
+         *  Add an edge between two vertices of the remaining graph if they are not adjacent yet.
+         *
+         *  @param[in] vertex1  The first endpoint of the edge.
+         *  @param[in] vertex2  The second endpoint of the edge.
+         */
+        void addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
         {
-            minTreeWidth = 3;
+            std::vector<htd::vertex_t> & neighborhood1 = neighborhood[vertex1];
+            std::vector<htd::vertex_t> & neighborhood2 = neighborhood[vertex2];
+
+            auto position = std::lower_bound(neighborhood1.begin(), neighborhood1.end(), vertex2);
 
-            while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+            if (position == neighborhood1.end() || *position != vertex2)
             {
-                ok = false;
+                neighborhood1.insert(position, vertex2);
+                neighborhood2.insert(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1), vertex1);
 
-                while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-                {
-                    ok = true;
-                }
+                updateVertex(vertex1);
+                updateVertex(vertex2);
+
+                /* The neighborhoods of the common neighbors of both vertices are now more densely connected, hence the common neighbors have to be re-checked as well. */
+                auto first1 = neighborhood1.begin();
+                auto first2 = neighborhood2.begin();
+
+                auto last1 = neighborhood1.end();
+                auto last2 = neighborhood2.end();
 
-                if (ok)
+                while (first1 != last1 && first2 != last2)
                 {
-                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                    if (*first1 < *first2)
                     {
+                        ++first1;
+                    }
+                    else if (*first2 < *first1)
+                    {
+                        ++first2;
+                    }
+                    else
+                    {
+                        markDirty(*first1);
 
+                        ++first1;
+                        ++first2;
                     }
                 }
             }
         }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing4_)
-        {
-            if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
-            {
-                while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
-                {
-                    ok = false;
+        /**
+         *  The neighborhood relation of the remaining graph.
+         */
+        std::vector<std::vector<htd::vertex_t>> & neighborhood;
 
-                    while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-                    {
-                        ok = true;
-                    }
+        /**
+         *  The resulting, partial vertex elimination ordering.
+         */
+        std::vector<htd::vertex_t> & ordering;
 
-                    if (ok)
-                    {
-                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                        {
+        /**
+         *  A flag for each vertex indicating whether the vertex was eliminated.
+         */
+        std::vector<bool> eliminated;
 
-                        }
-                    }
-                }
+        /**
+         *  A flag for each vertex indicating whether the vertex is currently on the worklist.
+         */
+        std::vector<bool> queued;
 
-                while (implementation_->eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth))
-                {
-                    while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
-                    {
-                        ok = false;
+        /**
+         *  The first vertex of each degree bucket, or (htd::vertex_t)-1 if the bucket is empty.
+         */
+        std::vector<htd::vertex_t> bucketHead;
 
-                        while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
-                        {
-                            ok = true;
-                        }
+        /**
+         *  The degree bucket to which each vertex is currently assigned.
+         */
+        std::vector<std::size_t> bucketDegree;
 
-                        if (ok)
-                        {
-                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
-                            {
+        /**
+         *  The successor of each vertex within its degree bucket.
+         */
+        std::vector<htd::vertex_t> nextInBucket;
 
-                            }
-                        }
-                    }
-                }
-            }
+        /**
+         *  The predecessor of each vertex within its degree bucket.
+         */
+        std::vector<htd::vertex_t> previousInBucket;
+
+        /**
+         *  The vertices which have to be re-checked by the reduction rules.
+         */
+        std::deque<htd::vertex_t> worklist;
+
+        /**
+         *  The number of vertices which were not eliminated yet.
+         */
+        std::size_t remainingVertexCount;
+
+        /**
+         *  The lower bound for the treewidth of the given graph.
+         */
+        std::size_t minTreeWidth;
+    };
+
+    /**
+     *  Reduce the graph by applying the reduction rules in phases of increasing strength.
+     *
+     *  Each phase puts the vertices of the relevant degrees on the worklist and applies the rules until no further
+     *  vertex can be eliminated. The lower bound for the treewidth is raised to 2 (3) before the contraction of paths
+     *  (the shrinking of triangles) starts, provided that the graph was not fully eliminated by the previous phases.
+     *
+     *  @param[in] state        The state of the reduction.
+     *  @param[in] ruleCount    The number of reduction rules which shall be applied.
+     */
+    static void reduce(ReductionState & state, std::size_t ruleCount);
+
+    /**
+     *  Apply the reduction rules to the vertices on the worklist until the worklist is empty.
+     *
+     *  Vertices of degree less than 2 are always eliminated. Depending on the given number of active rules, the
+     *  vertices of degree 2 are contracted (2), the vertices of degree 3 whose neighborhood contains at least one
+     *  edge are eliminated (3) and simplicial as well as almost simplicial vertices are eliminated (4).
+     *
+     *  @param[in] state        The state of the reduction.
+     *  @param[in] ruleCount    The number of active reduction rules.
+     */
+    static void applyReductionRules(ReductionState & state, std::size_t ruleCount);
+
+    /**
+     *  Eliminate a vertex of degree 2 from the graph and connect its two neighbors.
+     *
+     *  @param[in] state    The state of the reduction.
+     *  @param[in] vertex   The vertex of degree 2 which shall be eliminated.
+     */
+    static void contractPath(ReductionState & state, htd::vertex_t vertex);
+
+    /**
+     *  Eliminate a vertex of degree 3 from the graph in
+     *  case that at least two of its neighbors are adjacent.
+     *
+     *  @param[in] state    The state of the reduction.
+     *  @param[in] vertex   The vertex of degree 3 which shall be checked.
+     *
+     *  @return True if the vertex was eliminated, false otherwise.
+     */
+    static bool shrinkTriangle(ReductionState & state, htd::vertex_t vertex);
+
+    /**
+     *  Eliminate a vertex from the graph in case that all its neighbors form a clique.
+     *
+     *  @param[in] state    The state of the reduction.
+     *  @param[in] vertex   The vertex which shall be checked.
+     *
+     *  @return True if the vertex was eliminated, false otherwise.
+     */
+    static bool eliminateSimplicialVertex(ReductionState & state, htd::vertex_t vertex);
+
+    /**
+     *  Eliminate a vertex from the graph in case that at
+     *  least all but one of its neighbors form a clique.
+     *
+     *  @param[in] state    The state of the reduction.
+     *  @param[in] vertex   The vertex which shall be checked.
+     *
+     *  @return True if the vertex was eliminated, false otherwise.
+     */
+    static bool eliminateAlmostSimplicialVertex(ReductionState & state, htd::vertex_t vertex);
+
+    /**
+     *  Structure representing an atom of the input graph, i.e., a part of the graph which is split off along a separator.
+     */
+    struct Atom
+    {
+        /**
+         *  The vertices of the atom which are not contained in the separator, sorted in ascending order.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The vertices of the separator which are adjacent to the atom, sorted in ascending order.
+         */
+        std::vector<htd::vertex_t> separator;
+    };
+
+    /**
+     *  Split the remaining graph into atoms along its articulation points and clique minimal separators, order the
+     *  atoms and reduce the remainder of the graph.
+     *
+     *  The largest part of the remaining graph is retained, all other atoms are ordered independently and their
+     *  vertices are eliminated before any vertex of their separator is eliminated.
+     *
+     *  @param[in] graph                The graph which shall be preprocessed.
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     */
+    void applyAtomPreprocessing(const htd::IMultiHypergraph & graph, htd::PreprocessedGraph & preprocessedGraph) const;
+
+    /**
+     *  Split off all parts of the remaining graph which are attached to the largest biconnected component via an articulation point.
+     *
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in,out] split            A flag for each vertex indicating whether the vertex is part of an atom.
+     *  @param[out] atoms               The vector to which the new atoms shall be appended.
+     */
+    void applyBiconnectedComponentPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                                std::vector<bool> & split,
+                                                std::vector<Atom> & atoms) const;
+
+    /**
+     *  Iteratively compute the clique minimal separators of the remaining graph and split off all but the largest component they separate.
+     *
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in,out] split            A flag for each vertex indicating whether the vertex is part of an atom.
+     *  @param[out] atoms               The vector to which the new atoms shall be appended.
+     */
+    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                           std::vector<bool> & split,
+                                           std::vector<Atom> & atoms) const;
+
+    /**
+     *  Collect all vertices reachable from the given vertex without passing a vertex which is already marked as visited.
+     *
+     *  @param[in] neighborhood     The neighborhood relation of the graph.
+     *  @param[in] start            The vertex at which the search shall start.
+     *  @param[in,out] visited      A flag for each vertex indicating whether the vertex was already visited.
+     *  @param[out] component       The vector to which the reached vertices shall be appended, sorted in ascending order.
+     */
+    static void determineComponent(const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                   htd::vertex_t start,
+                                   std::vector<bool> & visited,
+                                   std::vector<htd::vertex_t> & component);
+
+    /**
+     *  Split a component off the remaining graph by removing the edges between the component and its separator.
+     *
+     *  The neighborhoods of the vertices of the component are left untouched so that the atom can be reconstructed later on.
+     *
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in] component            The vertices of the component, sorted in ascending order.
+     *  @param[in,out] split            A flag for each vertex indicating whether the vertex is part of an atom.
+     *  @param[out] atoms               The vector to which the new atom shall be appended.
+     */
+    static void splitAtom(htd::PreprocessedGraph & preprocessedGraph,
+                          std::vector<htd::vertex_t> && component,
+                          std::vector<bool> & split,
+                          std::vector<Atom> & atoms);
+
+    /**
+     *  Remove all vertices which are part of an atom from the set of remaining vertices.
+     *
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in] split                A flag for each vertex indicating whether the vertex is part of an atom.
+     */
+    static void updateRemainingVertices(htd::PreprocessedGraph & preprocessedGraph, const std::vector<bool> & split);
+
+    /**
+     *  Compute the elimination orderings of the given atoms in parallel and append them to the elimination sequence of the preprocessed graph.
+     *
+     *  The vertices of the separators are part of the graph which is ordered for each atom, but they are not part of
+     *  the resulting ordering because they are eliminated together with the remainder of the graph. Each atom graph
+     *  is reduced before it is ordered, the reduction rules never eliminate a vertex of the separator. The width of
+     *  an atom is measured for the ordering without the separator, because dropping a separator vertex which the
+     *  ordering algorithm placed early changes the bags of the atom vertices eliminated after it.
+     *
+     *  @param[in] graph                The graph underlying the operation.
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in] atoms                The atoms which shall be ordered.
+     */
+    void orderAtoms(const htd::IMultiHypergraph & graph,
+                    htd::PreprocessedGraph & preprocessedGraph,
+                    const std::vector<Atom> & atoms) const;
+
+    /**
+     *  Eliminate the given vertices from a graph and determine the width of the elimination.
+     *
+     *  @param[in,out] neighborhood The neighborhood relation of the graph, sorted in ascending order. After the call, it represents the graph remaining after the elimination including all fill edges.
+     *  @param[in] ordering         The vertices which shall be eliminated, in the order of their elimination.
+     *
+     *  @return The maximum number of neighbors of one of the given vertices at the time it is eliminated.
+     */
+    static std::size_t eliminateVertices(std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::vertex_t> & ordering);
+
+    /**
+     *  Compute the best vertex elimination ordering of the given graph which can be found within the configured number of iterations.
+     *
+     *  @param[in] graph                The graph underlying the operation.
+     *  @param[in] preprocessedGraph    The preprocessed graph which shall be ordered.
+     *  @param[in] algorithm            The ordering algorithm which shall be used.
+     *
+     *  @return The best vertex elimination ordering which was found or nullptr if the algorithm was terminated.
+     */
+    htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph,
+                                                       const htd::IPreprocessedGraph & preprocessedGraph,
+                                                       const htd::IWidthLimitableOrderingAlgorithm & algorithm) const;
+};
+
+htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::GraphPreprocessor::~GraphPreprocessor()
+{
+
+}
+
+htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    htd::PreprocessedGraph * ret = nullptr;
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    htd::GraphPreprocessor::Implementation::PreparedInput input(managementInstance, graph);
+
+    std::size_t size = input.vertexNames.size();
+
+    std::vector<htd::vertex_t> vertexNames(input.vertexNames.begin(), input.vertexNames.end());
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(input.neighborhood.begin(), input.neighborhood.end());
+
+    if (implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_)
+    {
+        std::vector<htd::vertex_t> ordering;
+        ordering.reserve(size);
+
+        htd::GraphPreprocessor::Implementation::ReductionState state(neighborhood, ordering);
+
+        std::size_t ruleCount = 1;
+
+        if (implementation_->applyPreprocessing4_)
+        {
+            ruleCount = 4;
+        }
+        else if (implementation_->applyPreprocessing3_)
+        {
+            ruleCount = 3;
+        }
+        else if (implementation_->applyPreprocessing2_)
+        {
+            ruleCount = 2;
         }
 
+        implementation_->reduce(state, ruleCount);
+
+        std::size_t minTreeWidth = state.minTreeWidth;
+
         for (htd::index_t index = 0; index < ordering.size(); ++index)
         {
             ordering[index] = vertexNames[ordering[index]];
         }
 
-        std::vector<htd::vertex_t> remainingVertices(vertices.begin(), vertices.end());
+        std::vector<htd::vertex_t> remainingVertices;
 
-        std::sort(remainingVertices.begin(), remainingVertices.end());
+        remainingVertices.reserve(state.remainingVertexCount);
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (!state.eliminated[vertex])
+            {
+                remainingVertices.push_back(vertex);
+            }
+        }
 
         ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(ordering), std::move(remainingVertices), graph.edgeCount(), minTreeWidth);
 
-        if (implementation_->applyPreprocessing4_)
+        if (implementation_->applyPreprocessing4_ && ret->vertexCount() > 0)
         {
-            //TODO
-            //implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
-
-            //TODO
-            //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
+            implementation_->applyAtomPreprocessing(graph, *ret);
         }
     }
     else
@@ -985,890 +968,823 @@ void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAl
     implementation_->orderingAlgorithm_ = algorithm;
 }
 
-htd::GraphPreprocessor * htd::GraphPreprocessor::clone(void) const
+std::size_t htd::GraphPreprocessor::threadCount(void) const
 {
-    return new htd::GraphPreprocessor(implementation_->managementInstance_);
+    return implementation_->threadCount_;
 }
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree)
+void htd::GraphPreprocessor::setThreadCount(std::size_t threadCount)
 {
-    if (newDegree < verticesByDegree.size())
-    {
-        verticesByDegree[newDegree].insert(vertex);
-    }
+    implementation_->threadCount_ = threadCount;
 }
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree,
-                                                                 std::size_t oldDegree)
+std::size_t htd::GraphPreprocessor::cliqueSeparatorVertexLimit(void) const
 {
-    if (oldDegree < verticesByDegree.size())
-    {
-        verticesByDegree[oldDegree].erase(vertex);
-    }
+    return implementation_->cliqueSeparatorVertexLimit_;
+}
 
-    assignVertexToGroup(vertex, verticesByDegree, newDegree);
+void htd::GraphPreprocessor::setCliqueSeparatorVertexLimit(std::size_t cliqueSeparatorVertexLimit)
+{
+    implementation_->cliqueSeparatorVertexLimit_ = cliqueSeparatorVertexLimit;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                                  std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                                                  std::vector<htd::vertex_t> & ordering)
+htd::GraphPreprocessor * htd::GraphPreprocessor::clone(void) const
 {
-    std::size_t oldOrderingSize = ordering.size();
+    htd::GraphPreprocessor * ret = new htd::GraphPreprocessor(implementation_->managementInstance_);
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
+    ret->implementation_->applyPreprocessing1_ = implementation_->applyPreprocessing1_;
+    ret->implementation_->applyPreprocessing2_ = implementation_->applyPreprocessing2_;
+    ret->implementation_->applyPreprocessing3_ = implementation_->applyPreprocessing3_;
+    ret->implementation_->applyPreprocessing4_ = implementation_->applyPreprocessing4_;
 
-    for (htd::vertex_t vertex : verticesDegree0)
-    {
-        ordering.push_back(vertex);
-    }
+    ret->setIterationCount(implementation_->iterationCount_);
+    ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
+    ret->setCliqueSeparatorVertexLimit(implementation_->cliqueSeparatorVertexLimit_);
+    ret->setOrderingAlgorithm(implementation_->orderingAlgorithm_->clone());
 
-    verticesDegree0.clear();
+    return ret;
+}
 
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
+void htd::GraphPreprocessor::Implementation::reduce(ReductionState & state, std::size_t ruleCount)
+{
+    state.markDegreesDirty(0, 1);
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree1.begin(), verticesDegree1.end());
+    applyReductionRules(state, 1);
 
-    for (htd::vertex_t vertex : relevantVertices)
+    if (state.remainingVertexCount > 0 && ruleCount >= 2)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
-
-        if (currentNeighborhood.size() == 1)
-        {
-            htd::vertex_t neighbor = currentNeighborhood[0];
+        state.minTreeWidth = std::max(state.minTreeWidth, (std::size_t)2);
 
-            std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+        state.markDegreesDirty(0, 2);
 
-            /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-            // coverity[use_iterator]
-            otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
+        applyReductionRules(state, 2);
+    }
 
-            assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+    if (state.remainingVertexCount > 0 && ruleCount >= 3)
+    {
+        state.minTreeWidth = std::max(state.minTreeWidth, (std::size_t)3);
 
-            std::vector<htd::vertex_t>().swap(currentNeighborhood);
+        state.markDegreesDirty(0, 3);
 
-            verticesDegree1.erase(vertex);
-        }
-        else
-        {
-            verticesDegree0.erase(vertex);
-        }
-
-        ordering.push_back(vertex);
+        applyReductionRules(state, 3);
     }
 
-    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
+    if (state.remainingVertexCount > 0 && ruleCount >= 4)
     {
-        vertices.erase(*it);
-    }
+        state.markDegreesDirty(0, std::max(state.minTreeWidth, (std::size_t)64));
 
-    return ordering.size() > oldOrderingSize;
+        applyReductionRules(state, 4);
+    }
 }
 
-bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                           std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                           std::vector<htd::vertex_t> & ordering)
+void htd::GraphPreprocessor::Implementation::applyReductionRules(ReductionState & state, std::size_t ruleCount)
 {
-    std::size_t oldOrderingSize = ordering.size();
-
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree2.begin(), verticesDegree2.end());
-
-    for (htd::vertex_t vertex : relevantVertices)
+    while (!state.worklist.empty())
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+        htd::vertex_t vertex = state.worklist.front();
 
-        if (currentNeighborhood.size() == 2)
-        {
-            htd::vertex_t neighbor1 = currentNeighborhood[0];
-            htd::vertex_t neighbor2 = currentNeighborhood[1];
+        state.worklist.pop_front();
 
-            std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
-            std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
+        state.queued[vertex] = false;
 
-            /* Because 'neighbor1' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood1'. */
-            // coverity[use_iterator]
-            otherNeighborhood1.erase(std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), vertex));
-
-            /* Because 'neighbor2' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood2'. */
-            // coverity[use_iterator]
-            otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
-
-            auto position = std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor2);
+        if (!state.eliminated[vertex])
+        {
+            std::size_t degree = state.neighborhood[vertex].size();
 
-            if (position != otherNeighborhood1.end() && *position == neighbor2)
+            if (degree < 2)
             {
-                assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), otherNeighborhood1.size() + 1);
-                assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                state.eliminateVertex(vertex);
             }
-            else
+            else if (degree == 2 && ruleCount >= 2)
             {
-                otherNeighborhood1.insert(position, neighbor2);
-                otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor1), neighbor1);
+                contractPath(state, vertex);
             }
+            else if (degree == 3 && ruleCount >= 3)
+            {
+                /* A vertex of degree 3 is (almost) simplicial if and only if at least two of its neighbors are adjacent. */
+                shrinkTriangle(state, vertex);
+            }
+            else if (ruleCount >= 4)
+            {
+                std::size_t oldMinTreeWidth = state.minTreeWidth;
 
-            std::vector<htd::vertex_t>().swap(currentNeighborhood);
-
-            verticesDegree2.erase(vertex);
-
-            ordering.push_back(vertex);
+                if (!(degree <= 64 && eliminateSimplicialVertex(state, vertex)) && degree <= state.minTreeWidth)
+                {
+                    eliminateAlmostSimplicialVertex(state, vertex);
+                }
 
-            vertices.erase(vertex);
+                /* Vertices whose degree is within the new lower bound may now be almost simplicial vertices. */
+                if (state.minTreeWidth > oldMinTreeWidth)
+                {
+                    state.markDegreesDirty(oldMinTreeWidth + 1, state.minTreeWidth);
+                }
+            }
         }
     }
+}
+
+void htd::GraphPreprocessor::Implementation::contractPath(ReductionState & state, htd::vertex_t vertex)
+{
+    const std::vector<htd::vertex_t> & currentNeighborhood = state.neighborhood[vertex];
 
-    return ordering.size() > oldOrderingSize;
+    htd::vertex_t neighbor1 = currentNeighborhood[0];
+    htd::vertex_t neighbor2 = currentNeighborhood[1];
+
+    state.eliminateVertex(vertex);
+
+    state.addEdge(neighbor1, neighbor2);
 }
 
-bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                                             std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                             std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                             std::vector<htd::vertex_t> & ordering)
+bool htd::GraphPreprocessor::Implementation::shrinkTriangle(ReductionState & state, htd::vertex_t vertex)
 {
-    std::size_t oldOrderingSize = ordering.size();
+    bool ret = false;
+
+    const std::vector<htd::vertex_t> & currentNeighborhood = state.neighborhood[vertex];
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    htd::vertex_t neighbor1 = currentNeighborhood[0];
+    htd::vertex_t neighbor2 = currentNeighborhood[1];
+    htd::vertex_t neighbor3 = currentNeighborhood[2];
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    const std::vector<htd::vertex_t> & otherNeighborhood1 = state.neighborhood[neighbor1];
+    const std::vector<htd::vertex_t> & otherNeighborhood2 = state.neighborhood[neighbor2];
 
-    for (htd::vertex_t vertex : relevantVertices)
+    if (std::binary_search(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor2) ||
+        std::binary_search(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor3) ||
+        std::binary_search(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor3))
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+        state.eliminateVertex(vertex);
 
-        if (currentNeighborhood.size() == 3)
-        {
-            htd::vertex_t neighbor1 = currentNeighborhood[0];
-            htd::vertex_t neighbor2 = currentNeighborhood[1];
-            htd::vertex_t neighbor3 = currentNeighborhood[2];
+        state.addEdge(neighbor1, neighbor2);
+        state.addEdge(neighbor1, neighbor3);
+        state.addEdge(neighbor2, neighbor3);
 
-            std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
-            std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
-            std::vector<htd::vertex_t> & otherNeighborhood3 = neighborhood[neighbor3];
+        ret = true;
+    }
 
-            std::size_t neighborDegree1 = otherNeighborhood1.size();
-            std::size_t neighborDegree2 = otherNeighborhood2.size();
-            std::size_t neighborDegree3 = otherNeighborhood3.size();
+    return ret;
+}
 
-            bool preprocessingApplicable = false;
+bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertex(ReductionState & state, htd::vertex_t vertex)
+{
+    const std::vector<htd::vertex_t> & currentNeighborhood = state.neighborhood[vertex];
 
-            if (std::binary_search(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor2))
-            {
-                auto position1 = std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor3);
+    bool ret = true;
 
-                if (position1 == otherNeighborhood1.end() || *position1 != neighbor3)
-                {
-                    otherNeighborhood1.insert(position1, neighbor3);
-                    otherNeighborhood3.insert(std::lower_bound(otherNeighborhood3.begin(), otherNeighborhood3.end(), neighbor1), neighbor1);
-                }
+    for (auto it = currentNeighborhood.begin(); ret && it != currentNeighborhood.end(); ++it)
+    {
+        const std::vector<htd::vertex_t> & otherNeighborhood = state.neighborhood[*it];
 
-                auto position2 = std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor3);
+        ret = htd::set_intersection_size(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end()) == currentNeighborhood.size() - 1;
+    }
 
-                if (position2 == otherNeighborhood2.end() || *position2 != neighbor3)
-                {
-                    otherNeighborhood2.insert(position2, neighbor3);
-                    otherNeighborhood3.insert(std::lower_bound(otherNeighborhood3.begin(), otherNeighborhood3.end(), neighbor2), neighbor2);
-                }
+    if (ret)
+    {
+        state.minTreeWidth = std::max(state.minTreeWidth, currentNeighborhood.size());
 
-                preprocessingApplicable = true;
-            }
-            else if (std::binary_search(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor3))
-            {
-                auto position1 = std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor2);
+        state.eliminateVertex(vertex);
+    }
 
-                if (position1 == otherNeighborhood1.end() || *position1 != neighbor2)
-                {
-                    otherNeighborhood1.insert(position1, neighbor2);
-                    otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor1), neighbor1);
-                }
+    return ret;
+}
 
-                auto position2 = std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor3);
+bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertex(ReductionState & state, htd::vertex_t vertex)
+{
+    bool ret = false;
 
-                if (position2 == otherNeighborhood2.end() || *position2 != neighbor3)
-                {
-                    otherNeighborhood2.insert(position2, neighbor3);
-                    otherNeighborhood3.insert(std::lower_bound(otherNeighborhood3.begin(), otherNeighborhood3.end(), neighbor2), neighbor2);
-                }
+    const std::vector<htd::vertex_t> & currentNeighborhood = state.neighborhood[vertex];
 
-                preprocessingApplicable = true;
-            }
-            else if (std::binary_search(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor3))
-            {
-                auto position1 = std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor2);
+    std::size_t oldMissingVertexCount = 0;
 
-                if (position1 == otherNeighborhood1.end() || *position1 != neighbor2)
-                {
-                    otherNeighborhood1.insert(position1, neighbor2);
-                    otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor1), neighbor1);
-                }
+    std::vector<htd::vertex_t> missingVertices;
 
-                auto position2 = std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), neighbor3);
+    for (htd::vertex_t neighbor : currentNeighborhood)
+    {
+        const std::vector<htd::vertex_t> & otherNeighborhood = state.neighborhood[neighbor];
 
-                if (position2 == otherNeighborhood1.end() || *position2 != neighbor3)
-                {
-                    otherNeighborhood1.insert(position2, neighbor3);
-                    otherNeighborhood3.insert(std::lower_bound(otherNeighborhood3.begin(), otherNeighborhood3.end(), neighbor1), neighbor1);
-                }
+        std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(), std::back_inserter(missingVertices));
 
-                preprocessingApplicable = true;
-            }
+        missingVertices.erase(std::lower_bound(missingVertices.begin() + oldMissingVertexCount, missingVertices.end(), neighbor));
 
-            if (preprocessingApplicable)
-            {
-                /* Because 'neighbor1' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood1'. */
-                // coverity[use_iterator]
-                otherNeighborhood1.erase(std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), vertex));
+        std::inplace_merge(missingVertices.begin(), missingVertices.begin() + oldMissingVertexCount, missingVertices.end());
 
-                /* Because 'neighbor2' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood2'. */
-                // coverity[use_iterator]
-                otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
+        oldMissingVertexCount = missingVertices.size();
+    }
 
-                /* Because 'neighbor3' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood3'. */
-                // coverity[use_iterator]
-                otherNeighborhood3.erase(std::lower_bound(otherNeighborhood3.begin(), otherNeighborhood3.end(), vertex));
+    if (missingVertices.empty())
+    {
+        state.minTreeWidth = std::max(state.minTreeWidth, currentNeighborhood.size());
 
-                if (neighborDegree1 != otherNeighborhood1.size())
-                {
-                    assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), neighborDegree1);
-                }
+        state.eliminateVertex(vertex);
 
-                if (neighborDegree2 != otherNeighborhood2.size())
-                {
-                    assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), neighborDegree2);
-                }
+        ret = true;
+    }
+    else
+    {
+        auto duplicate = std::adjacent_find(missingVertices.begin(), missingVertices.end());
 
-                if (neighborDegree3 != otherNeighborhood3.size())
-                {
-                    assignVertexToGroup(neighbor3, verticesByDegree, otherNeighborhood3.size(), neighborDegree3);
-                }
+        if (duplicate != missingVertices.end())
+        {
+            htd::vertex_t culprit = *duplicate;
+
+            missingVertices.erase(duplicate, std::upper_bound(duplicate, missingVertices.end(), culprit));
+
+            if (htd::is_sorted_and_duplicate_free(missingVertices.begin(), missingVertices.end()))
+            {
+                const std::vector<htd::vertex_t> & otherNeighborhood = state.neighborhood[culprit];
+
+                std::vector<htd::vertex_t> missingVertices2;
 
-                std::vector<htd::vertex_t>().swap(currentNeighborhood);
+                std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(), std::back_inserter(missingVertices2));
 
-                verticesDegree3.erase(vertex);
+                missingVertices2.erase(std::lower_bound(missingVertices2.begin(), missingVertices2.end(), culprit));
 
-                ordering.push_back(vertex);
+                if (htd::set_difference_size(missingVertices.begin(), missingVertices.end(), missingVertices2.begin(), missingVertices2.end()) == 0)
+                {
+                    state.eliminateVertex(vertex);
+
+                    for (htd::vertex_t neighbor : missingVertices2)
+                    {
+                        state.addEdge(culprit, neighbor);
+                    }
 
-                vertices.erase(vertex);
+                    ret = true;
+                }
             }
         }
     }
 
-    return ordering.size() > oldOrderingSize;
+    return ret;
 }
 
-bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                           std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                           std::vector<htd::vertex_t> & ordering)
+void htd::GraphPreprocessor::Implementation::applyAtomPreprocessing(const htd::IMultiHypergraph & graph, htd::PreprocessedGraph & preprocessedGraph) const
 {
-    std::size_t oldOrderingSize = ordering.size();
+    std::vector<bool> split(preprocessedGraph.inputGraphVertexCount(), false);
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    std::vector<Atom> atoms;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    applyBiconnectedComponentPreprocessing(preprocessedGraph, split, atoms);
 
-    if (relevantVertices.size() > 1)
+    if (preprocessedGraph.vertexCount() > 0 && preprocessedGraph.vertexCount() <= cliqueSeparatorVertexLimit_ && !managementInstance_->isTerminated())
     {
-        for (auto it1 = relevantVertices.begin(); it1 != relevantVertices.end() - 1;)
-        {
-            /* Because 'relevantVertices' has more than one element, 'it1' will always point to a valid element. */
-            // coverity[deref_iterator]
-            htd::vertex_t vertex1 = *it1;
+        applyCliqueSeparatorPreprocessing(preprocessedGraph, split, atoms);
+    }
 
-            std::vector<htd::vertex_t> & currentNeighborhood1 = neighborhood[vertex1];
+    if (!atoms.empty() && !managementInstance_->isTerminated())
+    {
+        std::size_t oldMinTreeWidth = preprocessedGraph.minTreeWidth();
 
-            ++it1;
+        orderAtoms(graph, preprocessedGraph, atoms);
 
-            if (currentNeighborhood1.size() == 3)
-            {
-                bool matchFound = false;
+        /* The separator vertices lost the neighbors within their atoms, hence the remainder of the graph may be reducible again. */
+        std::vector<htd::vertex_t> ordering;
 
-                for (auto it2 = it1; !matchFound && it2 != relevantVertices.end(); ++it2)
-                {
-                    htd::vertex_t vertex2 = *it2;
+        std::vector<htd::vertex_t> vertices(preprocessedGraph.remainingVertices());
 
-                    std::vector<htd::vertex_t> & currentNeighborhood2 = neighborhood[vertex2];
+        ReductionState state(preprocessedGraph.neighborhood(), ordering, vertices);
 
-                    if (currentNeighborhood2.size() == 3)
-                    {
-                        if (currentNeighborhood1 == currentNeighborhood2)
-                        {
-                            htd::vertex_t neighbor1 = currentNeighborhood1[0];
-                            htd::vertex_t neighbor2 = currentNeighborhood1[1];
-                            htd::vertex_t neighbor3 = currentNeighborhood1[2];
+        state.minTreeWidth = preprocessedGraph.minTreeWidth();
 
-                            std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
-                            std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
-                            std::vector<htd::vertex_t> & otherNeighborhood3 = neighborhood[neighbor3];
+        for (const Atom & atom : atoms)
+        {
+            for (htd::vertex_t vertex : atom.separator)
+            {
+                state.markDirty(vertex);
+            }
+        }
 
-                            std::size_t neighborDegree1 = otherNeighborhood1.size();
-                            std::size_t neighborDegree2 = otherNeighborhood2.size();
-                            std::size_t neighborDegree3 = otherNeighborhood3.size();
+        state.markDegreesDirty(oldMinTreeWidth + 1, state.minTreeWidth);
 
-                            for (htd::vertex_t vertex : currentNeighborhood1)
-                            {
-                                std::vector<htd::vertex_t> & currentNeighborhood3 = neighborhood[vertex];
+        applyReductionRules(state, 4);
 
-                                /* Because 'vertex' is a neighbor of 'vertex1', std::lower_bound will always find 'vertex1' in 'currentNeighborhood3'. */
-                                // coverity[use_iterator]
-                                currentNeighborhood3.erase(std::lower_bound(currentNeighborhood3.begin(), currentNeighborhood3.end(), vertex1));
+        std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
 
-                                /* Because 'vertex' is a neighbor of 'vertex2', std::lower_bound will always find 'vertex2' in 'currentNeighborhood3'. */
-                                // coverity[use_iterator]
-                                currentNeighborhood3.erase(std::lower_bound(currentNeighborhood3.begin(), currentNeighborhood3.end(), vertex2));
-                            }
+        for (htd::vertex_t vertex : ordering)
+        {
+            eliminationSequence.push_back(preprocessedGraph.vertexName(vertex));
+        }
 
-                            for (auto it3 = currentNeighborhood1.begin(); it3 != currentNeighborhood1.end() - 1; ++it3)
-                            {
-                                htd::vertex_t neighbor1 = *it3;
+        std::vector<htd::vertex_t> remainingVertices;
 
-                                std::vector<htd::vertex_t> & currentNeighborhood3 = neighborhood[neighbor1];
+        remainingVertices.reserve(state.remainingVertexCount);
 
-                                for (auto it4 = it3 + 1; it4 != currentNeighborhood1.end(); ++it4)
-                                {
-                                    htd::vertex_t neighbor2 = *it4;
+        for (htd::vertex_t vertex : vertices)
+        {
+            if (!state.eliminated[vertex])
+            {
+                remainingVertices.push_back(vertex);
+            }
+        }
+
+        preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
 
-                                    std::vector<htd::vertex_t> & currentNeighborhood4 = neighborhood[neighbor2];
+        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), state.minTreeWidth);
 
-                                    auto position1 = std::lower_bound(currentNeighborhood3.begin(), currentNeighborhood3.end(), neighbor2);
+        preprocessedGraph.updateEdgeCount();
+    }
+}
 
-                                    if (position1 == currentNeighborhood3.end() || *position1 != neighbor2)
-                                    {
-                                        currentNeighborhood3.insert(position1, neighbor2);
+void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                                                                    std::vector<bool> & split,
+                                                                                    std::vector<Atom> & atoms) const
+{
+    htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
 
-                                        auto position2 = std::lower_bound(currentNeighborhood4.begin(), currentNeighborhood4.end(), neighbor1);
+    std::vector<htd::vertex_t> articulationPoints;
 
-                                        currentNeighborhood4.insert(position2, neighbor1);
-                                    }
-                                }
-                            }
+    std::vector<std::vector<htd::vertex_t>> components;
 
-                            assignVertexToGroup(neighbor1, verticesByDegree, neighborhood[neighbor1].size(), neighborDegree1);
-                            assignVertexToGroup(neighbor2, verticesByDegree, neighborhood[neighbor2].size(), neighborDegree2);
-                            assignVertexToGroup(neighbor3, verticesByDegree, neighborhood[neighbor3].size(), neighborDegree3);
+    biconnectedComponentAlgorithm.determineComponents(preprocessedGraph, components, articulationPoints);
 
-                            std::vector<htd::vertex_t>().swap(currentNeighborhood1);
-                            std::vector<htd::vertex_t>().swap(currentNeighborhood2);
+    if (components.size() > 1 && !articulationPoints.empty())
+    {
+        std::vector<htd::index_t> pool;
+        htd::index_t index = 0;
+        std::size_t max = 0;
+        for (const std::vector<htd::vertex_t> & component : components)
+        {
+            std::size_t size = component.size();
 
-                            ordering.push_back(vertex1);
-                            ordering.push_back(vertex2);
+            if (size >= max)
+            {
+                if (size > max)
+                {
+                    max = size;
 
-                            matchFound = true;
-                        }
-                    }
+                    pool.clear();
                 }
+
+                pool.push_back(index);
             }
+
+            ++index;
         }
 
-        for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
-        {
-            vertices.erase(*it);
+        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
 
-            verticesDegree3.erase(*it);
-        }
-    }
+        std::sort(articulationPoints.begin(), articulationPoints.end());
 
-    return ordering.size() > oldOrderingSize;
-}
+        articulationPoints.erase(std::unique(articulationPoints.begin(), articulationPoints.end()), articulationPoints.end());
 
-bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                         std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                         std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                                         std::vector<htd::vertex_t> & ordering,
-                                                                         std::size_t maxDegree,
-                                                                         std::size_t & minTreewidth)
-{
-    std::size_t oldOrderingSize = ordering.size();
+        std::vector<htd::vertex_t> relevantArticulationPoints;
 
-    for (htd::vertex_t vertex : vertices)
-    {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+        std::set_intersection(selectedComponent.begin(), selectedComponent.end(),
+                              articulationPoints.begin(), articulationPoints.end(),
+                              std::back_inserter(relevantArticulationPoints));
+
+        std::vector<bool> visited(split.size(), false);
 
-        if (currentNeighborhood.size() <= maxDegree)
+        for (htd::vertex_t vertex : selectedComponent)
         {
-            bool ok = true;
-
-            for (auto it = currentNeighborhood.begin(); ok && it != currentNeighborhood.end(); ++it)
-            {
-                const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
+            visited[vertex] = true;
+        }
 
-                ok = htd::set_intersection_size(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end()) == currentNeighborhood.size() - 1;
-            }
+        /*
+         * Each part of the graph which is attached to the selected biconnected component is attached via exactly one
+         * articulation point, hence a search which does not enter the selected component yields exactly one atom.
+         */
+        for (htd::vertex_t vertex : relevantArticulationPoints)
+        {
+            std::vector<htd::vertex_t> neighbors(preprocessedGraph.neighborhood(vertex));
 
-            if (ok)
+            for (htd::vertex_t neighbor : neighbors)
             {
-                for (htd::vertex_t neighbor : currentNeighborhood)
+                if (!visited[neighbor])
                 {
-                    std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+                    std::vector<htd::vertex_t> component;
 
-                    /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-                    // coverity[use_iterator]
-                    otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
+                    determineComponent(preprocessedGraph.neighborhood(), neighbor, visited, component);
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    splitAtom(preprocessedGraph, std::move(component), split, atoms);
                 }
-
-                minTreewidth = std::max(minTreewidth, currentNeighborhood.size());
-
-                std::vector<htd::vertex_t>().swap(currentNeighborhood);
-
-                ordering.push_back(vertex);
             }
         }
-    }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
-    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
-    {
-        vertices.erase(*it);
-
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
+        updateRemainingVertices(preprocessedGraph, split);
     }
-
-    return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                               std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                                               std::vector<htd::vertex_t> & ordering,
-                                                                               std::size_t & minTreeWidth)
+void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
+                                                                               std::vector<bool> & split,
+                                                                               std::vector<Atom> & atoms) const
 {
-    std::size_t oldOrderingSize = ordering.size();
-
-    for (htd::vertex_t vertex : vertices)
-    {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
-
-        if (currentNeighborhood.size() > 1 && currentNeighborhood.size() <= minTreeWidth)
-        {
-            bool ok = true;
-
-            std::size_t oldMissingVertexCount = 0;
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
 
-            std::vector<htd::vertex_t> missingVertices;
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(preprocessedGraph));
 
-            for (auto it = currentNeighborhood.begin(); ok && it != currentNeighborhood.end(); ++it)
-            {
-                const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
+    std::vector<bool> visited(split.size(), false);
 
-                std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(), std::back_inserter(missingVertices));
+    while (separator != nullptr && !separator->empty() && !managementInstance_->isTerminated())
+    {
+        std::sort(separator->begin(), separator->end());
 
-                missingVertices.erase(std::lower_bound(missingVertices.begin() + oldMissingVertexCount, missingVertices.end(), *it));
+        for (htd::vertex_t vertex : *separator)
+        {
+            visited[vertex] = true;
+        }
 
-                std::inplace_merge(missingVertices.begin(), missingVertices.begin() + oldMissingVertexCount, missingVertices.end());
+        const htd::PreprocessedGraph & currentGraph = preprocessedGraph;
 
-                oldMissingVertexCount = missingVertices.size();
-            }
+        std::vector<std::vector<htd::vertex_t>> components;
 
-            if (missingVertices.empty())
+        for (htd::vertex_t vertex : *separator)
+        {
+            for (htd::vertex_t neighbor : currentGraph.neighborhood(vertex))
             {
-                for (htd::vertex_t neighbor : currentNeighborhood)
+                if (!visited[neighbor])
                 {
-                    std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+                    components.emplace_back();
 
-                    /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-                    // coverity[use_iterator]
-                    otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
-
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    determineComponent(currentGraph.neighborhood(), neighbor, visited, components.back());
                 }
+            }
+        }
 
-                minTreeWidth = std::max(minTreeWidth, currentNeighborhood.size());
+        for (const std::vector<htd::vertex_t> & component : components)
+        {
+            for (htd::vertex_t vertex : component)
+            {
+                visited[vertex] = false;
+            }
+        }
 
-                std::vector<htd::vertex_t>().swap(currentNeighborhood);
+        for (htd::vertex_t vertex : *separator)
+        {
+            visited[vertex] = false;
+        }
 
-                ordering.push_back(vertex);
-            }
-            else
+        if (components.size() > 1)
+        {
+            auto largestComponent = std::max_element(components.begin(), components.end(),
+                                                     [](const std::vector<htd::vertex_t> & component1, const std::vector<htd::vertex_t> & component2)
             {
-                auto it = missingVertices.begin();
-
-                auto duplicate =  missingVertices.end();
+                return component1.size() < component2.size();
+            });
 
-                for (auto next = it; ++next != missingVertices.end() && duplicate == missingVertices.end(); ++it)
+            for (auto it = components.begin(); it != components.end(); ++it)
+            {
+                if (it != largestComponent)
                 {
-                    if (*it == *next)
-                    {
-                        duplicate = it;
-                    }
+                    splitAtom(preprocessedGraph, std::move(*it), split, atoms);
                 }
+            }
 
-                if (duplicate != missingVertices.end())
-                {
-                    htd::vertex_t culprit = *it;
-
-                    missingVertices.erase(duplicate, std::upper_bound(duplicate, missingVertices.end(), culprit));
-
-                    if (htd::is_sorted_and_duplicate_free(missingVertices.begin(), missingVertices.end()))
-                    {
-                        std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[culprit];
-
-                        std::vector<htd::vertex_t> missingVertices2;
-
-                        std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(), std::back_inserter(missingVertices2));
-
-                        missingVertices2.erase(std::lower_bound(missingVertices2.begin(), missingVertices2.end(), culprit));
+            updateRemainingVertices(preprocessedGraph, split);
 
-                        if (htd::set_difference_size(missingVertices.begin(), missingVertices.end(), missingVertices2.begin(), missingVertices2.end()) == 0)
-                        {
-                            for (htd::vertex_t neighbor : missingVertices2)
-                            {
-                                std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor];
+            separator.reset(algorithm.computeSeparator(preprocessedGraph));
+        }
+        else
+        {
+            separator.reset();
+        }
+    }
+}
 
-                                otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), culprit), culprit);
+void htd::GraphPreprocessor::Implementation::determineComponent(const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                                                htd::vertex_t start,
+                                                                std::vector<bool> & visited,
+                                                                std::vector<htd::vertex_t> & component)
+{
+    std::size_t offset = component.size();
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() - 1);
-                            }
+    visited[start] = true;
 
-                            std::size_t middle = otherNeighborhood.size();
+    component.push_back(start);
 
-                            otherNeighborhood.insert(otherNeighborhood.end(), missingVertices2.begin(), missingVertices2.end());
+    for (htd::index_t index = offset; index < component.size(); ++index)
+    {
+        for (htd::vertex_t neighbor : neighborhood[component[index]])
+        {
+            if (!visited[neighbor])
+            {
+                visited[neighbor] = true;
 
-                            std::inplace_merge(otherNeighborhood.begin(), otherNeighborhood.begin() + middle, otherNeighborhood.end());
+                component.push_back(neighbor);
+            }
+        }
+    }
 
-                            assignVertexToGroup(culprit, verticesByDegree, otherNeighborhood.size(), middle);
+    std::sort(component.begin() + offset, component.end());
+}
 
-                            for (htd::vertex_t neighbor : currentNeighborhood)
-                            {
-                                std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor];
+void htd::GraphPreprocessor::Implementation::splitAtom(htd::PreprocessedGraph & preprocessedGraph,
+                                                       std::vector<htd::vertex_t> && component,
+                                                       std::vector<bool> & split,
+                                                       std::vector<Atom> & atoms)
+{
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
 
-                                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood2'. */
-                                // coverity[use_iterator]
-                                otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
+    Atom atom;
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
-                            }
+    atom.vertices = std::move(component);
 
-                            std::vector<htd::vertex_t>().swap(currentNeighborhood);
+    for (htd::vertex_t vertex : atom.vertices)
+    {
+        split[vertex] = true;
+    }
 
-                            ordering.push_back(vertex);
-                        }
-                    }
-                }
+    for (htd::vertex_t vertex : atom.vertices)
+    {
+        for (htd::vertex_t neighbor : neighborhood[vertex])
+        {
+            if (!split[neighbor])
+            {
+                atom.separator.push_back(neighbor);
             }
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    std::sort(atom.separator.begin(), atom.separator.end());
+
+    atom.separator.erase(std::unique(atom.separator.begin(), atom.separator.end()), atom.separator.end());
 
-    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
+    for (htd::vertex_t vertex : atom.separator)
     {
-        vertices.erase(*it);
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
+        currentNeighborhood.erase(std::remove_if(currentNeighborhood.begin(), currentNeighborhood.end(), [&](htd::vertex_t neighbor) { return split[neighbor]; }), currentNeighborhood.end());
     }
 
-    return ordering.size() > oldOrderingSize;
+    atoms.push_back(std::move(atom));
 }
 
-void htd::GraphPreprocessor::Implementation::splitSets(const std::vector<htd::vertex_t> & set1,
-                                                       const std::vector<htd::vertex_t> & set2,
-                                                       std::vector<htd::vertex_t> & resultOnlySet1,
-                                                       std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT
+void htd::GraphPreprocessor::Implementation::updateRemainingVertices(htd::PreprocessedGraph & preprocessedGraph, const std::vector<bool> & split)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::vector<htd::vertex_t> remainingVertices;
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    remainingVertices.reserve(preprocessedGraph.vertexCount());
 
-    while (first1 != last1 && first2 != last2)
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
     {
-        if (*first1 < *first2)
-        {
-            resultOnlySet1.push_back(*first1);
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
+        if (!split[vertex])
         {
-            ++first2;
-        }
-        else
-        {
-            resultIntersection.push_back(*first1);
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
+            remainingVertices.push_back(vertex);
         }
     }
 
-    if (first1 != last1)
-    {
-        resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
-    }
+    preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
+
+    preprocessedGraph.updateEdgeCount();
 }
 
-void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                                                    htd::PreprocessedGraph & preprocessedGraph,
-                                                                                    std::unordered_set<htd::vertex_t> & vertices) const
+void htd::GraphPreprocessor::Implementation::orderAtoms(const htd::IMultiHypergraph & graph,
+                                                        htd::PreprocessedGraph & preprocessedGraph,
+                                                        const std::vector<Atom> & atoms) const
 {
-    htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
+    const htd::PreprocessedGraph & baseGraph = preprocessedGraph;
 
-    std::vector<htd::vertex_t> articulationPoints;
+    std::vector<std::vector<htd::vertex_t>> atomOrderings(atoms.size());
 
-    std::vector<std::vector<htd::vertex_t>> components;
+    std::vector<std::size_t> atomWidths(atoms.size(), 0);
 
-    biconnectedComponentAlgorithm.determineComponents(preprocessedGraph, components, articulationPoints);
+    std::atomic<htd::index_t> nextAtom(0);
 
-    if (components.size() > 1)
+    /* Atoms are seeded by index and their orderings are concatenated in atom order, so the thread assignment does not affect the elimination sequence. */
+    std::uint_fast32_t randomSeed = htd::randomNumberGenerator()();
+
+    auto worker = [&]()
     {
-        std::vector<htd::index_t> pool;
-        htd::index_t index = 0;
-        std::size_t max = 0;
-        for (const std::vector<htd::vertex_t> & component : components)
-        {
-            std::size_t size = component.size();
+        std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> algorithm(orderingAlgorithm_->clone());
 
-            if (size >= max)
-            {
-                if (size > max)
-                {
-                    max = size;
+        for (htd::index_t atomIndex = nextAtom++; atomIndex < atoms.size() && !managementInstance_->isTerminated(); atomIndex = nextAtom++)
+        {
+            const Atom & atom = atoms[atomIndex];
 
-                    pool.clear();
-                }
+            std::vector<htd::vertex_t> atomVertices;
 
-                pool.push_back(index);
-            }
+            atomVertices.reserve(atom.vertices.size() + atom.separator.size());
 
-            ++index;
-        }
+            std::merge(atom.vertices.begin(), atom.vertices.end(), atom.separator.begin(), atom.separator.end(), std::back_inserter(atomVertices));
 
-        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
+            std::size_t atomSize = atomVertices.size();
 
-        std::vector<htd::vertex_t> relevantArticulationPoints;
+            std::vector<htd::vertex_t> names(atomSize);
 
-        std::set_intersection(selectedComponent.begin(), selectedComponent.end(),
-                              articulationPoints.begin(), articulationPoints.end(),
-                              std::back_inserter(relevantArticulationPoints));
+            std::vector<std::vector<htd::vertex_t>> neighborhood(atomSize);
 
-        for (htd::vertex_t vertex : relevantArticulationPoints)
-        {
-            std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+            std::size_t edgeCount = 0;
 
-            std::vector<htd::vertex_t> newNeighborhood;
-            std::vector<htd::vertex_t> otherNeighbors;
+            for (htd::index_t position = 0; position < atomSize; ++position)
+            {
+                htd::vertex_t vertex = atomVertices[position];
 
-            splitSets(currentNeighborhood, selectedComponent, otherNeighbors, newNeighborhood);
+                names[position] = baseGraph.vertexName(vertex);
 
-            currentNeighborhood.swap(newNeighborhood);
+                bool separatorVertex = std::binary_search(atom.separator.begin(), atom.separator.end(), vertex);
 
-            for (htd::vertex_t neighbor : otherNeighbors)
-            {
-                std::vector<htd::vertex_t> & otherNeighborhood = preprocessedGraph.neighborhood(neighbor);
+                for (htd::vertex_t neighbor : baseGraph.neighborhood(vertex))
+                {
+                    /* The edges between the atom and its separator were removed from the separator's neighborhood, hence they are added from the atom's side. */
+                    bool separatorNeighbor = std::binary_search(atom.separator.begin(), atom.separator.end(), neighbor);
 
-                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-                // coverity[use_iterator]
-                otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
-            }
-        }
+                    if (!separatorVertex || separatorNeighbor)
+                    {
+                        htd::index_t neighborPosition = std::lower_bound(atomVertices.begin(), atomVertices.end(), neighbor) - atomVertices.begin();
 
-        preprocessedGraph.updateEdgeCount();
+                        neighborhood[position].push_back(neighborPosition);
 
-        htd::IConnectedComponentAlgorithm * connectedComponentAlgorithm = managementInstance_->connectedComponentAlgorithmFactory().createInstance();
+                        if (separatorNeighbor && !separatorVertex)
+                        {
+                            neighborhood[neighborPosition].push_back(position);
 
-        std::vector<std::vector<htd::vertex_t>> connectedComponents;
+                            edgeCount += 2;
+                        }
+                        else
+                        {
+                            ++edgeCount;
+                        }
+                    }
+                }
+            }
 
-        connectedComponentAlgorithm->determineComponents(preprocessedGraph, connectedComponents);
+            std::vector<bool> separatorVertices(atomSize, false);
 
-        delete connectedComponentAlgorithm;
+            for (htd::vertex_t vertex : atom.separator)
+            {
+                htd::index_t position = std::lower_bound(atomVertices.begin(), atomVertices.end(), vertex) - atomVertices.begin();
 
-        auto position = std::find_if(connectedComponents.begin(), connectedComponents.end(),
-                                     [&](const std::vector<htd::vertex_t> & component)
-        {
-            return std::binary_search(component.begin(), component.end(), selectedComponent[0]);
-        });
+                std::sort(neighborhood[position].begin(), neighborhood[position].end());
 
-        HTD_ASSERT(position != connectedComponents.end())
+                separatorVertices[position] = true;
+            }
 
-        /*
-         * After separating the largest biconnected component from the remainder of the graph,
-         * it forms a connected component of the graph, i.e., the iterator 'position' always
-         * points to a valid position within the set of connected components.
-         */
-        // coverity[deref_iterator]
-        position->swap(*(connectedComponents.rbegin()));
+            std::vector<std::vector<htd::vertex_t>> atomNeighborhood(neighborhood);
 
-        std::sort(connectedComponents.begin(), connectedComponents.end() - 1,
-                  [](const std::vector<htd::vertex_t> & component1, const std::vector<htd::vertex_t> & component2)
-        {
-           return component1.size() < component2.size();
-        });
+            std::vector<htd::vertex_t> localVertices(atomSize);
 
-        for (const std::vector<htd::vertex_t> & component : connectedComponents)
-        {
-            std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+            std::iota(localVertices.begin(), localVertices.end(), 0);
 
-            std::size_t oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+            std::vector<htd::vertex_t> atomSequence;
 
-            std::unordered_set<htd::vertex_t> componentVertices(component.begin(), component.end());
+            ReductionState state(neighborhood, atomSequence, localVertices);
 
-            std::size_t minTreeWidth = 0;
+            state.minTreeWidth = baseGraph.minTreeWidth();
 
-            for (htd::vertex_t vertex : component)
+            for (htd::index_t position = 0; position < atomSize; ++position)
             {
-                assignVertexToGroup(vertex, verticesByDegree, preprocessedGraph.neighborhood(vertex).size());
+                if (separatorVertices[position])
+                {
+                    state.protectVertex(position);
+                }
             }
 
-            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-            {
-
-            }
+            reduce(state, 4);
 
-            bool ok = false;
+            bool ordered = true;
 
-            if (!componentVertices.empty())
+            if (state.remainingVertexCount > 0)
             {
-                minTreeWidth = 2;
+                std::vector<htd::vertex_t> eliminationSequence;
 
-                while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                eliminationSequence.reserve(atomSequence.size());
+
+                for (htd::vertex_t vertex : atomSequence)
                 {
-                    ok = true;
+                    eliminationSequence.push_back(names[vertex]);
                 }
 
-                if (ok)
+                std::vector<htd::vertex_t> remainingVertices;
+
+                for (htd::vertex_t vertex : localVertices)
                 {
-                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    if (!state.eliminated[vertex])
                     {
-
+                        remainingVertices.push_back(vertex);
                     }
                 }
-            }
 
-            if (!componentVertices.empty())
-            {
-                minTreeWidth = 3;
+                std::unordered_map<htd::vertex_t, htd::vertex_t> localPositions;
 
-                while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                for (htd::index_t position = 0; position < atomSize; ++position)
                 {
-                    ok = false;
+                    localPositions.emplace(names[position], position);
+                }
 
-                    while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = true;
-                    }
+                htd::PreprocessedGraph atomGraph(std::move(names),
+                                                 std::move(neighborhood),
+                                                 std::move(eliminationSequence),
+                                                 std::move(remainingVertices),
+                                                 edgeCount >> 1,
+                                                 std::min(state.minTreeWidth, atomSize - 1));
+
+                htd::seedRandomNumberGenerator(htd::deriveRandomSeed(randomSeed, atomIndex));
+
+                std::unique_ptr<htd::IWidthLimitedVertexOrdering> ordering(computeOrdering(graph, atomGraph, *algorithm));
+
+                ordered = ordering != nullptr;
+
+                if (ordered)
+                {
+                    atomSequence.clear();
 
-                    if (ok)
+                    for (htd::vertex_t vertex : ordering->sequence())
                     {
-                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
+                        htd::vertex_t position = localPositions.at(vertex);
 
+                        if (!separatorVertices[position])
+                        {
+                            atomSequence.push_back(position);
                         }
                     }
                 }
             }
 
-            if (!componentVertices.empty())
+            if (ordered)
             {
-                if (eliminateSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
-                {
-                    while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = false;
+                std::vector<htd::vertex_t> & atomOrdering = atomOrderings[atomIndex];
 
-                        while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = true;
-                        }
+                atomOrdering.reserve(atomSequence.size());
 
-                        if (ok)
-                        {
-                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
+                for (htd::vertex_t vertex : atomSequence)
+                {
+                    atomOrdering.push_back(baseGraph.vertexName(atomVertices[vertex]));
+                }
 
-                            }
-                        }
-                    }
+                atomWidths[atomIndex] = eliminateVertices(atomNeighborhood, atomSequence);
+            }
+        }
+    };
 
-                    while (eliminateAlmostSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
-                    {
-                        while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = false;
+    std::size_t threadCount = threadCount_;
 
-                            while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
-                                ok = true;
-                            }
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
 
-                            if (ok)
-                            {
-                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                                {
+    threadCount = std::max(std::min(threadCount, atoms.size()), (std::size_t)1);
 
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+    std::vector<std::thread> threads;
 
-            for (auto it = preprocessedGraph.eliminationSequence().begin() + oldOrderingSize; it != preprocessedGraph.eliminationSequence().end(); ++it)
-            {
-                vertices.erase(*it);
+    for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(worker);
+    }
 
-                *it = preprocessedGraph.vertexName(*it);
-            }
+    {
+        htd::RandomNumberGeneratorGuard randomNumberGeneratorGuard;
 
-            if (!std::binary_search(component.begin(), component.end(), selectedComponent[0]))
-            {
-                oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+        worker();
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+    std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
 
-                for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
-                {
-                    vertices.erase(*it);
-                }
-            }
-            else
-            {
-                std::vector<htd::vertex_t> remainingVertices(componentVertices.begin(), componentVertices.end());
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
 
-                std::sort(remainingVertices.begin(), remainingVertices.end());
+    for (htd::index_t atomIndex = 0; atomIndex < atoms.size(); ++atomIndex)
+    {
+        eliminationSequence.insert(eliminationSequence.end(), atomOrderings[atomIndex].begin(), atomOrderings[atomIndex].end());
 
-                preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
-            }
+        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), atomWidths[atomIndex]);
 
-            preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
+        for (htd::vertex_t vertex : atoms[atomIndex].vertices)
+        {
+            std::vector<htd::vertex_t>().swap(neighborhood[vertex]);
         }
     }
 }
 
-void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
-                                                               htd::PreprocessedGraph & preprocessedGraph,
-                                                               std::size_t & minTreeWidth) const
+std::size_t htd::GraphPreprocessor::Implementation::eliminateVertices(std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::vertex_t> & ordering)
 {
-    std::vector<htd::vertex_t> remainingComponentVertices(vertices.begin(), vertices.end());
+    std::size_t ret = 0;
+
+    std::vector<htd::vertex_t> newNeighborhood;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        ret = std::max(ret, currentNeighborhood.size());
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+            newNeighborhood.clear();
+
+            std::set_union(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end(), std::back_inserter(newNeighborhood));
+
+            newNeighborhood.erase(std::remove_if(newNeighborhood.begin(), newNeighborhood.end(), [&](htd::vertex_t otherVertex) { return otherVertex == vertex || otherVertex == neighbor; }), newNeighborhood.end());
 
-    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
+            otherNeighborhood.swap(newNeighborhood);
+        }
+
+        std::vector<htd::vertex_t>().swap(currentNeighborhood);
+    }
 
-    htd::PreprocessedGraphComponent component(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth);
+    return ret;
+}
 
-    htd::IWidthLimitedVertexOrdering * optimalOrdering = nullptr;
+htd::IWidthLimitedVertexOrdering * htd::GraphPreprocessor::Implementation::computeOrdering(const htd::IMultiHypergraph & graph,
+                                                                                          const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                          const htd::IWidthLimitableOrderingAlgorithm & algorithm) const
+{
+    htd::IWidthLimitedVertexOrdering * ret = nullptr;
 
     std::size_t bestMaxBagSize = 0;
 
@@ -1883,7 +1799,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             remainingIterations = std::min(remainingIterations, nonImprovementLimit_);
         }
 
-        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm_->computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
+        htd::IWidthLimitedVertexOrdering * currentOrdering = algorithm.computeOrdering(graph, preprocessedGraph, bestMaxBagSize - 1, remainingIterations);
 
         if (currentOrdering->requiredIterations() < nonImprovementLimit_)
         {
@@ -1896,23 +1812,13 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 
         std::size_t currentMaxBagSize = currentOrdering->maximumBagSize();
 
-        if (!managementInstance_->isTerminated())
+        if (!managementInstance_->isTerminated() && (ret == nullptr || currentMaxBagSize < bestMaxBagSize))
         {
-            if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
-            {
-                if (iteration > 1)
-                {
-                    delete optimalOrdering;
-                }
+            delete ret;
 
-                optimalOrdering = currentOrdering;
+            ret = currentOrdering;
 
-                bestMaxBagSize = currentMaxBagSize;
-            }
-            else
-            {
-                delete currentOrdering;
-            }
+            bestMaxBagSize = currentMaxBagSize;
         }
         else
         {
@@ -1920,41 +1826,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
         }
     }
 
-    if (optimalOrdering != nullptr)
-    {
-        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
-
-        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), optimalOrdering->maximumBagSize() - 1);
-
-        delete optimalOrdering;
-    }
-}
-
-void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                                                               std::unordered_set<htd::vertex_t> & vertices) const
-{
-    htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
-
-    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(preprocessedGraph);
-
-    while (separator != nullptr && !separator->empty())
-    {
-        for (htd::vertex_t vertex : *separator)
-        {
-            preprocessedGraph.removeVertex(vertex);
-
-            vertices.erase(vertex);
-        }
-
-        delete separator;
-
-        separator = algorithm.computeSeparator(preprocessedGraph);
-    }
-
-    if (separator != nullptr)
-    {
-        delete separator;
-    }
+    return ret;
 }
 
 #endif /* HTD_HTD_GRAPHPREPROCESSOR_CPP */
@@ -27,6 +27,299 @@
 
 #include <htd/Helpers.hpp>
 
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+
+    #define HTD_VECTORIZED_SET_OPERATIONS
+    #define HTD_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+    #define HTD_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <immintrin.h>
+    #include <intrin.h>
+
+    #define HTD_VECTORIZED_SET_OPERATIONS
+    #define HTD_TARGET_SSE42
+    #define HTD_TARGET_AVX2
+#endif
+
+namespace
+{
+    /**
+     *  If the larger of two sets has more than GALLOPING_FACTOR times the size of the smaller one, the elements
+     *  of the smaller set are located in the larger set via exponential search instead of a linear merge.
+     */
+    const std::size_t GALLOPING_FACTOR = 32;
+
+    /**
+     *  Find the position of the first element which is not less than the given value via exponential search.
+     *
+     *  @param[in] data     The sorted array which shall be searched.
+     *  @param[in] position The position at which the search shall start.
+     *  @param[in] size     The size of the array.
+     *  @param[in] value    The value to search for.
+     *
+     *  @return The position of the first element at or after the start position which is not less than the given value.
+     */
+    template < typename T >
+    std::size_t gallop(const T * data, std::size_t position, std::size_t size, T value)
+    {
+        std::size_t ret = position;
+
+        if (ret < size && data[ret] < value)
+        {
+            std::size_t low = ret;
+            std::size_t step = 1;
+            std::size_t high = low + step;
+
+            while (high < size && data[high] < value)
+            {
+                low = high;
+
+                step <<= 1;
+
+                high = low + step;
+            }
+
+            ret = static_cast<std::size_t>(std::lower_bound(data + low + 1, data + std::min(high, size), value) - data);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the size of the intersection of two sets via a branch-free linear merge.
+     */
+    template < typename T >
+    std::size_t intersectionSizeScalar(const T * set1, std::size_t size1, const T * set2, std::size_t size2)
+    {
+        std::size_t ret = 0;
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 < size1 && index2 < size2)
+        {
+            T value1 = set1[index1];
+            T value2 = set2[index2];
+
+            ret += value1 == value2;
+
+            index1 += value1 <= value2;
+            index2 += value2 <= value1;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the size of the intersection of two sets by locating each element of the smaller set in the larger set.
+     */
+    template < typename T >
+    std::size_t intersectionSizeGalloping(const T * smallSet, std::size_t smallSize, const T * largeSet, std::size_t largeSize)
+    {
+        std::size_t ret = 0;
+
+        std::size_t position = 0;
+
+        for (std::size_t index = 0; index < smallSize && position < largeSize; ++index)
+        {
+            position = gallop(largeSet, position, largeSize, smallSet[index]);
+
+            if (position < largeSize && largeSet[position] == smallSet[index])
+            {
+                ++ret;
+
+                ++position;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Decompose two sets of vertices by locating each element of the smaller set in the larger set.
+     *
+     *  @param[in] smallSet             The smaller set of vertices, sorted in ascending order.
+     *  @param[in] largeSet             The larger set of vertices, sorted in ascending order.
+     *  @param[out] resultOnlySmallSet  The set of vertices which are found only in the smaller set.
+     *  @param[out] resultOnlyLargeSet  The set of vertices which are found only in the larger set.
+     *  @param[out] resultIntersection  The set of vertices which are found in both sets.
+     */
+    void decomposeSetsGalloping(const std::vector<htd::vertex_t> & smallSet,
+                                const std::vector<htd::vertex_t> & largeSet,
+                                std::vector<htd::vertex_t> & resultOnlySmallSet,
+                                std::vector<htd::vertex_t> & resultOnlyLargeSet,
+                                std::vector<htd::vertex_t> & resultIntersection)
+    {
+        std::size_t position = 0;
+
+        std::size_t largeSize = largeSet.size();
+
+        for (htd::vertex_t vertex : smallSet)
+        {
+            std::size_t next = gallop(largeSet.data(), position, largeSize, vertex);
+
+            resultOnlyLargeSet.insert(resultOnlyLargeSet.end(), largeSet.begin() + position, largeSet.begin() + next);
+
+            if (next < largeSize && largeSet[next] == vertex)
+            {
+                resultIntersection.push_back(vertex);
+
+                ++next;
+            }
+            else
+            {
+                resultOnlySmallSet.push_back(vertex);
+            }
+
+            position = next;
+        }
+
+        resultOnlyLargeSet.insert(resultOnlyLargeSet.end(), largeSet.begin() + position, largeSet.end());
+    }
+
+#ifdef HTD_VECTORIZED_SET_OPERATIONS
+    /**
+     *  Compute the size of the intersection of two sets by comparing each block of four elements of the first
+     *  set with all rotations of the current block of the second set. The block with the smaller maximum is
+     *  replaced after each step; the remaining elements are handled by the scalar implementation.
+     */
+    HTD_TARGET_SSE42 std::size_t intersectionSizeSSE42(const std::uint32_t * set1, std::size_t size1, const std::uint32_t * set2, std::size_t size2)
+    {
+        std::size_t ret = 0;
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        std::size_t blockEnd1 = size1 & ~static_cast<std::size_t>(3);
+        std::size_t blockEnd2 = size2 & ~static_cast<std::size_t>(3);
+
+        while (index1 < blockEnd1 && index2 < blockEnd2)
+        {
+            __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set1 + index1));
+            __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set2 + index2));
+
+            __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(block1, block2),
+                                                        _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                           _mm_or_si128(_mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, _MM_SHUFFLE(1, 0, 3, 2))),
+                                                        _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, _MM_SHUFFLE(2, 1, 0, 3)))));
+
+            ret += static_cast<std::size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(matches)))));
+
+            std::uint32_t maximum1 = set1[index1 + 3];
+            std::uint32_t maximum2 = set2[index2 + 3];
+
+            index1 += maximum1 <= maximum2 ? 4 : 0;
+            index2 += maximum2 <= maximum1 ? 4 : 0;
+        }
+
+        return ret + intersectionSizeScalar(set1 + index1, size1 - index1, set2 + index2, size2 - index2);
+    }
+
+    /**
+     *  Compute the size of the intersection of two sets like intersectionSizeSSE42, but based on blocks of eight elements.
+     */
+    HTD_TARGET_AVX2 std::size_t intersectionSizeAVX2(const std::uint32_t * set1, std::size_t size1, const std::uint32_t * set2, std::size_t size2)
+    {
+        std::size_t ret = 0;
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        std::size_t blockEnd1 = size1 & ~static_cast<std::size_t>(7);
+        std::size_t blockEnd2 = size2 & ~static_cast<std::size_t>(7);
+
+        while (index1 < blockEnd1 && index2 < blockEnd2)
+        {
+            __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(set1 + index1));
+            __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(set2 + index2));
+
+            /* Compare with the rotations within each 128-bit lane, then with the rotations of the swapped lanes. */
+            __m256i swappedBlock2 = _mm256_permute2x128_si256(block2, block2, 1);
+
+            __m256i matches1 = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(block1, block2),
+                                                               _mm256_cmpeq_epi32(block1, _mm256_shuffle_epi32(block2, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                               _mm256_or_si256(_mm256_cmpeq_epi32(block1, _mm256_shuffle_epi32(block2, _MM_SHUFFLE(1, 0, 3, 2))),
+                                                               _mm256_cmpeq_epi32(block1, _mm256_shuffle_epi32(block2, _MM_SHUFFLE(2, 1, 0, 3)))));
+
+            __m256i matches2 = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(block1, swappedBlock2),
+                                                               _mm256_cmpeq_epi32(block1, _mm256_shuffle_epi32(swappedBlock2, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                               _mm256_or_si256(_mm256_cmpeq_epi32(block1, _mm256_shuffle_epi32(swappedBlock2, _MM_SHUFFLE(1, 0, 3, 2))),
+                                                               _mm256_cmpeq_epi32(block1, _mm256_shuffle_epi32(swappedBlock2, _MM_SHUFFLE(2, 1, 0, 3)))));
+
+            ret += static_cast<std::size_t>(_mm_popcnt_u32(static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(matches1, matches2))))));
+
+            std::uint32_t maximum1 = set1[index1 + 7];
+            std::uint32_t maximum2 = set2[index2 + 7];
+
+            index1 += maximum1 <= maximum2 ? 8 : 0;
+            index2 += maximum2 <= maximum1 ? 8 : 0;
+        }
+
+        return ret + intersectionSizeScalar(set1 + index1, size1 - index1, set2 + index2, size2 - index2);
+    }
+#endif
+
+    typedef std::size_t (*IntersectionSizeKernel)(const std::uint32_t *, std::size_t, const std::uint32_t *, std::size_t);
+
+    /**
+     *  Select the fastest implementation of the intersection size computation supported by the executing CPU.
+     *
+     *  @return The fastest implementation of the intersection size computation supported by the executing CPU.
+     */
+    IntersectionSizeKernel selectIntersectionSizeKernel(void)
+    {
+        IntersectionSizeKernel ret = &intersectionSizeScalar<std::uint32_t>;
+
+#if defined(HTD_VECTORIZED_SET_OPERATIONS) && defined(__GNUC__)
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+        {
+            ret = &intersectionSizeAVX2;
+        }
+        else if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+        {
+            ret = &intersectionSizeSSE42;
+        }
+#elif defined(HTD_VECTORIZED_SET_OPERATIONS)
+        int information[4];
+
+        __cpuid(information, 0);
+
+        int maximumFunction = information[0];
+
+        __cpuid(information, 1);
+
+        bool sse42 = (information[2] & (1 << 20)) != 0;
+        bool popcnt = (information[2] & (1 << 23)) != 0;
+        bool avx = (information[2] & (1 << 27)) != 0 && (information[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+
+        bool avx2 = false;
+
+        if (maximumFunction >= 7)
+        {
+            __cpuidex(information, 7, 0);
+
+            avx2 = avx && (information[1] & (1 << 5)) != 0;
+        }
+
+        if (avx2 && popcnt)
+        {
+            ret = &intersectionSizeAVX2;
+        }
+        else if (sse42 && popcnt)
+        {
+            ret = &intersectionSizeSSE42;
+        }
+#endif
+
+        return ret;
+    }
+}
+
 htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
     htd::LibraryInstance * ret = new htd::LibraryInstance(id);
@@ -36,6 +329,36 @@ htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
     return ret;
 }
 
+std::mt19937 & htd::randomNumberGenerator(void)
+{
+    static thread_local std::mt19937 generator;
+
+    return generator;
+}
+
+void htd::seedRandomNumberGenerator(std::uint_fast32_t seed)
+{
+    randomNumberGenerator().seed(static_cast<std::mt19937::result_type>(seed));
+}
+
+std::uint_fast32_t htd::deriveRandomSeed(std::uint_fast32_t seed, std::size_t streamIndex)
+{
+    /* Finalizer of SplitMix64, which maps consecutive stream indices to well-distributed seeds. */
+    std::uint64_t ret = (static_cast<std::uint64_t>(seed) << 32) + static_cast<std::uint64_t>(streamIndex) * 0x9E3779B97F4A7C15ULL;
+
+    ret = (ret ^ (ret >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    ret = (ret ^ (ret >> 27)) * 0x94D049BB133111EBULL;
+
+    return static_cast<std::uint_fast32_t>((ret ^ (ret >> 31)) & 0xFFFFFFFFULL);
+}
+
+std::size_t htd::selectRandomIndex(std::size_t size)
+{
+    HTD_ASSERT(size > 0)
+
+    return std::uniform_int_distribution<std::size_t>(0, size - 1)(randomNumberGenerator());
+}
+
 void htd::print(bool input)
 {
     print(input, std::cout);
@@ -150,109 +473,165 @@ void htd::set_difference(const std::vector<htd::vertex_t> & set1,
                          const std::vector<htd::vertex_t> & set2,
                          std::vector<htd::vertex_t> & result)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t size1 = set1.size();
+    std::size_t size2 = set2.size();
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    while (first1 != last1 && first2 != last2)
+    if (size1 * GALLOPING_FACTOR < size2)
     {
-        if (*first1 < *first2)
+        std::size_t position = 0;
+
+        for (htd::vertex_t vertex : set1)
         {
-            result.push_back(*first1);
+            position = gallop(set2.data(), position, size2, vertex);
 
-            ++first1;
+            if (position == size2 || set2[position] != vertex)
+            {
+                result.push_back(vertex);
+            }
         }
-        else if (*first2 < *first1)
+    }
+    else if (size2 * GALLOPING_FACTOR < size1)
+    {
+        std::size_t position = 0;
+
+        for (htd::vertex_t vertex : set2)
         {
-            ++first2;
+            std::size_t next = gallop(set1.data(), position, size1, vertex);
+
+            result.insert(result.end(), set1.begin() + position, set1.begin() + next);
+
+            position = next < size1 && set1[next] == vertex ? next + 1 : next;
         }
-        else
+
+        result.insert(result.end(), set1.begin() + position, set1.end());
+    }
+    else
+    {
+        auto first1 = set1.begin();
+        auto first2 = set2.begin();
+
+        auto last1 = set1.end();
+        auto last2 = set2.end();
+
+        while (first1 != last1 && first2 != last2)
         {
-            ++first1;
+            if (*first1 < *first2)
+            {
+                result.push_back(*first1);
 
-            //Skip common value in set 2.
-            ++first2;
+                ++first1;
+            }
+            else if (*first2 < *first1)
+            {
+                ++first2;
+            }
+            else
+            {
+                ++first1;
+
+                //Skip common value in set 2.
+                ++first2;
+            }
         }
-    }
 
-    result.insert(result.end(), first1, last1);
+        result.insert(result.end(), first1, last1);
+    }
 }
 
 void htd::set_intersection(const std::vector<htd::vertex_t> & set1,
                            const std::vector<htd::vertex_t> & set2,
                            std::vector<htd::vertex_t> & result)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    const std::vector<htd::vertex_t> & smallSet = set1.size() <= set2.size() ? set1 : set2;
+    const std::vector<htd::vertex_t> & largeSet = set1.size() <= set2.size() ? set2 : set1;
 
-    while (first1 != last1 && first2 != last2)
+    if (smallSet.size() * GALLOPING_FACTOR < largeSet.size())
     {
-        if (*first1 < *first2)
-        {
-            ++first1;
-        }
-        else if (*first2 < *first1)
+        std::size_t position = 0;
+
+        for (auto it = smallSet.begin(); it != smallSet.end() && position < largeSet.size(); ++it)
         {
-            ++first2;
+            position = gallop(largeSet.data(), position, largeSet.size(), *it);
+
+            if (position < largeSet.size() && largeSet[position] == *it)
+            {
+                result.push_back(*it);
+
+                ++position;
+            }
         }
-        else
+    }
+    else
+    {
+        auto first1 = set1.begin();
+        auto first2 = set2.begin();
+
+        auto last1 = set1.end();
+        auto last2 = set2.end();
+
+        while (first1 != last1 && first2 != last2)
         {
-            result.push_back(*first1);
+            if (*first1 < *first2)
+            {
+                ++first1;
+            }
+            else if (*first2 < *first1)
+            {
+                ++first2;
+            }
+            else
+            {
+                result.push_back(*first1);
 
-            ++first1;
+                ++first1;
 
-            //Skip common value in set 2.
-            ++first2;
+                //Skip common value in set 2.
+                ++first2;
+            }
         }
     }
 }
 
-std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+std::size_t htd::set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                       const htd::vertex_t * first2, const htd::vertex_t * last2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t ret = 0;
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    std::size_t size1 = static_cast<std::size_t>(last1 - first1);
+    std::size_t size2 = static_cast<std::size_t>(last2 - first2);
 
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
-    std::size_t overlap = 0;
+    if (size1 > size2)
+    {
+        std::swap(first1, first2);
+        std::swap(size1, size2);
+    }
 
-    while (first1 != last1 && first2 != last2)
+    if (size1 > 0)
     {
-        if (*first1 < *first2)
+        if (size1 * GALLOPING_FACTOR < size2)
         {
-            onlySet1++;
-
-            ++first1;
+            ret = intersectionSizeGalloping(first1, size1, first2, size2);
         }
-        else if (*first2 < *first1)
+        else if (sizeof(htd::vertex_t) == sizeof(std::uint32_t))
         {
-            onlySet2++;
+            static const IntersectionSizeKernel kernel = selectIntersectionSizeKernel();
 
-            ++first2;
+            ret = kernel(reinterpret_cast<const std::uint32_t *>(first1), size1, reinterpret_cast<const std::uint32_t *>(first2), size2);
         }
         else
         {
-            overlap++;
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
+            ret = intersectionSizeScalar(first1, size1, first2, size2);
         }
     }
 
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+    return ret;
+}
 
-    return std::tuple<std::size_t, std::size_t, std::size_t>(onlySet1, overlap, onlySet2);
+std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+{
+    std::size_t overlap = htd::set_intersection_size(set1.begin(), set1.end(), set2.begin(), set2.end());
+
+    return std::tuple<std::size_t, std::size_t, std::size_t>(set1.size() - overlap, overlap, set2.size() - overlap);
 }
 
 void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
@@ -261,85 +640,63 @@ void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
                          std::vector<htd::vertex_t> & resultOnlySet2,
                          std::vector<htd::vertex_t> & resultIntersection) HTD_NOEXCEPT
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    while (first1 != last1 && first2 != last2)
+    if (set1.size() * GALLOPING_FACTOR < set2.size())
     {
-        if (*first1 < *first2)
-        {
-            resultOnlySet1.push_back(*first1);
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            resultOnlySet2.push_back(*first2);
-
-            ++first2;
-        }
-        else
-        {
-            resultIntersection.push_back(*first1);
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
+        decomposeSetsGalloping(set1, set2, resultOnlySet1, resultOnlySet2, resultIntersection);
     }
-
-    if (first1 != last1)
+    else if (set2.size() * GALLOPING_FACTOR < set1.size())
     {
-        resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
+        decomposeSetsGalloping(set2, set1, resultOnlySet2, resultOnlySet1, resultIntersection);
     }
-    else if (first2 != last2)
+    else
     {
-        resultOnlySet2.insert(resultOnlySet2.end(), first2, last2);
-    }
-}
+        auto first1 = set1.begin();
+        auto first2 = set2.begin();
 
-std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
-{
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+        auto last1 = set1.end();
+        auto last2 = set2.end();
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+        while (first1 != last1 && first2 != last2)
+        {
+            if (*first1 < *first2)
+            {
+                resultOnlySet1.push_back(*first1);
 
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
+                ++first1;
+            }
+            else if (*first2 < *first1)
+            {
+                resultOnlySet2.push_back(*first2);
 
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
+                ++first2;
+            }
+            else
+            {
+                resultIntersection.push_back(*first1);
 
-            ++first1;
+                ++first1;
+
+                //Skip common value in set 2.
+                ++first2;
+            }
         }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
 
-            ++first2;
+        if (first1 != last1)
+        {
+            resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
         }
-        else
+        else if (first2 != last2)
         {
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
+            resultOnlySet2.insert(resultOnlySet2.end(), first2, last2);
         }
     }
+}
 
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+{
+    std::size_t overlap = htd::set_intersection_size(set1.begin(), set1.end(), set2.begin(), set2.end());
 
-    return std::pair<std::size_t, std::size_t>(onlySet1, onlySet2);
+    return std::pair<std::size_t, std::size_t>(set1.size() - overlap, set2.size() - overlap);
 }
 
 std::vector<htd::vertex_t> * htd::computeJoinVertices(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex)
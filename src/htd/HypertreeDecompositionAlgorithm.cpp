@@ -33,12 +33,17 @@
 #include <htd/IMutableHypertreeDecomposition.hpp>
 #include <htd/HypertreeDecompositionFactory.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
+#include <htd/IndexedGreedySetCoverAlgorithm.hpp>
+#include <htd/MaximalSetFilter.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
+#include <atomic>
 #include <cstdarg>
+#include <memory>
 #include <stdexcept>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -52,7 +57,7 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -90,6 +95,11 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The number of worker threads which shall be used to compute the set covers of the bags.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Set the hyperedges covering the bags of the hypertree decomposition.
      *
@@ -97,6 +107,41 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      *  @param[in] decomposition    The hypertree decomposition which shall be updated.
      */
     void setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const;
+
+    /**
+     *  Set the hyperedges covering the bags of the hypertree decomposition by computing the set covers of all bags
+     *  concurrently. Each worker thread uses its own copy of the set-cover algorithm. As the covers of different
+     *  bags are independent, the resulting covering edges are assigned afterwards in a sequential pass.
+     *
+     *  @param[in] decomposition        The hypertree decomposition which shall be updated.
+     *  @param[in] setCoverAlgorithm    The set-cover algorithm which shall be used. If it is an IndexedGreedySetCoverAlgorithm, its containers must be set to the given relevant containers.
+     *  @param[in] relevantHyperedges   The maximal hyperedges of the decomposed graph.
+     *  @param[in] relevantContainers   The sorted elements of the maximal hyperedges of the decomposed graph.
+     *  @param[in] threadCount          The number of worker threads which shall be used.
+     */
+    void setCoveringEdges(htd::IMutableHypertreeDecomposition & decomposition,
+                          const htd::ISetCoverAlgorithm & setCoverAlgorithm,
+                          const std::vector<htd::Hyperedge> & relevantHyperedges,
+                          const std::vector<std::vector<htd::id_t>> & relevantContainers,
+                          std::size_t threadCount) const;
+
+    /**
+     *  Set the hyperedges covering the bags of the hypertree decomposition in a sequential post-order traversal.
+     *
+     *  Unless the indexed set-cover algorithm is used, hyperedges which only consist of vertices forgotten in
+     *  the part of the decomposition traversed so far are discarded before covering the remaining bags.
+     *
+     *  @param[in] decomposition            The hypertree decomposition which shall be updated.
+     *  @param[in] setCoverAlgorithm        The set-cover algorithm which shall be used.
+     *  @param[in] indexedSetCoverAlgorithm The set-cover algorithm if it is an IndexedGreedySetCoverAlgorithm whose containers are set to the given relevant containers, nullptr otherwise.
+     *  @param[in] relevantHyperedges       The maximal hyperedges of the decomposed graph.
+     *  @param[in] relevantContainers       The sorted elements of the maximal hyperedges of the decomposed graph.
+     */
+    void setCoveringEdges(htd::IMutableHypertreeDecomposition & decomposition,
+                          htd::ISetCoverAlgorithm * setCoverAlgorithm,
+                          htd::IndexedGreedySetCoverAlgorithm * indexedSetCoverAlgorithm,
+                          std::vector<htd::Hyperedge> & relevantHyperedges,
+                          std::vector<std::vector<htd::id_t>> & relevantContainers) const;
 };
 
 htd::HypertreeDecompositionAlgorithm::HypertreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -337,6 +382,16 @@ void htd::HypertreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool co
     implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
 }
 
+std::size_t htd::HypertreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::HypertreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::HypertreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -371,6 +426,8 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 #endif
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     ret->setManagementInstance(managementInstance());
 
     return ret;
@@ -380,51 +437,141 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 {
     std::vector<htd::Hyperedge> relevantHyperedges;
 
-    std::vector<htd::Hyperedge> newRelevantHyperedges;
-
     std::vector<std::vector<htd::id_t>> relevantContainers;
 
-    std::vector<std::vector<htd::id_t>> newRelevantContainers;
-
     const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
 
-    std::size_t edgeCount = graph.edgeCount();
+    std::vector<std::vector<htd::id_t>> containers;
+
+    containers.reserve(graph.edgeCount());
+
+    for (const htd::Hyperedge & hyperedge : hyperedges)
+    {
+        containers.push_back(hyperedge.sortedElements());
+    }
+
+    std::vector<htd::index_t> maximalHyperedges;
+
+    htd::MaximalSetFilter().computeMaximalSets(containers, maximalHyperedges);
+
+    auto it = hyperedges.begin();
+
+    htd::index_t index = 0;
+
+    for (htd::index_t maximalHyperedge : maximalHyperedges)
+    {
+        std::advance(it, maximalHyperedge - index);
+
+        index = maximalHyperedge;
+
+        relevantHyperedges.push_back(*it);
+
+        relevantContainers.push_back(std::move(containers[maximalHyperedge]));
+    }
+
+    htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
+
+    htd::IndexedGreedySetCoverAlgorithm * indexedSetCoverAlgorithm = dynamic_cast<htd::IndexedGreedySetCoverAlgorithm *>(setCoverAlgorithm);
+
+    /* The inverted index restricts each set cover to the hyperedges touching the bag, hence it is built only once
+     * and there is no need to discard the hyperedges which are covered by forgotten vertices. */
+    if (indexedSetCoverAlgorithm != nullptr)
+    {
+        indexedSetCoverAlgorithm->setContainers(relevantContainers);
+    }
+
+    std::size_t threadCount = threadCount_;
 
-    auto it1 = hyperedges.begin();
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
 
-    for (htd::index_t index1 = 0; index1 < edgeCount; ++index1)
+    if (threadCount > 1)
     {
-        const std::vector<htd::vertex_t> & elements1 = it1->sortedElements();
+        setCoveringEdges(decomposition, *setCoverAlgorithm, relevantHyperedges, relevantContainers, threadCount);
+    }
+    else
+    {
+        setCoveringEdges(decomposition, setCoverAlgorithm, indexedSetCoverAlgorithm, relevantHyperedges, relevantContainers);
+    }
+
+    delete setCoverAlgorithm;
+}
+
+void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(htd::IMutableHypertreeDecomposition & decomposition,
+                                                                            const htd::ISetCoverAlgorithm & setCoverAlgorithm,
+                                                                            const std::vector<htd::Hyperedge> & relevantHyperedges,
+                                                                            const std::vector<std::vector<htd::id_t>> & relevantContainers,
+                                                                            std::size_t threadCount) const
+{
+    std::vector<htd::vertex_t> nodes;
 
-        bool maximal = true;
+    decomposition.copyVerticesTo(nodes);
 
-        auto it2 = it1;
+    std::vector<std::vector<htd::index_t>> covers(nodes.size());
 
-        ++it2;
+    std::atomic<htd::index_t> nextNode(0);
 
-        for (htd::index_t index2 = index1 + 1; index2 < edgeCount; ++index2)
+    auto worker = [&]()
+    {
+        std::unique_ptr<htd::ISetCoverAlgorithm> algorithm(setCoverAlgorithm.clone());
+
+        htd::IndexedGreedySetCoverAlgorithm * indexedAlgorithm = dynamic_cast<htd::IndexedGreedySetCoverAlgorithm *>(algorithm.get());
+
+        for (htd::index_t index = nextNode++; index < nodes.size(); index = nextNode++)
         {
-            const std::vector<htd::vertex_t> & elements2 = it2->sortedElements();
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(nodes[index]);
 
-            if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
+            if (indexedAlgorithm != nullptr)
             {
-                maximal = false;
+                indexedAlgorithm->computeSetCover(bag, covers[index]);
+            }
+            else
+            {
+                algorithm->computeSetCover(bag, relevantContainers, covers[index]);
             }
-
-            ++it2;
         }
+    };
 
-        if (maximal)
-        {
-            relevantHyperedges.push_back(*it1);
+    threadCount = std::max(std::min(threadCount, nodes.size()), (std::size_t)1);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(worker);
+    }
 
-            relevantContainers.push_back(elements1);
+    worker();
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (htd::index_t index = 0; index < nodes.size(); ++index)
+    {
+        std::vector<htd::Hyperedge> selectedHyperedges;
+
+        for (htd::index_t selectedHyperedgeIndex : covers[index])
+        {
+            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
         }
 
-        ++it1;
+        decomposition.setCoveringEdges(nodes[index], selectedHyperedges);
     }
+}
 
-    htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
+void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(htd::IMutableHypertreeDecomposition & decomposition,
+                                                                            htd::ISetCoverAlgorithm * setCoverAlgorithm,
+                                                                            htd::IndexedGreedySetCoverAlgorithm * indexedSetCoverAlgorithm,
+                                                                            std::vector<htd::Hyperedge> & relevantHyperedges,
+                                                                            std::vector<std::vector<htd::id_t>> & relevantContainers) const
+{
+    std::vector<htd::Hyperedge> newRelevantHyperedges;
+
+    std::vector<std::vector<htd::id_t>> newRelevantContainers;
 
     htd::PostOrderTreeTraversal traversal;
 
@@ -436,7 +583,14 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 
         std::vector<htd::index_t> selectedIndices;
 
-        setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+        if (indexedSetCoverAlgorithm != nullptr)
+        {
+            indexedSetCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), selectedIndices);
+        }
+        else
+        {
+            setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+        }
 
         std::vector<htd::Hyperedge> selectedHyperedges;
 
@@ -447,7 +601,7 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 
         decomposition.setCoveringEdges(vertex, selectedHyperedges);
 
-        if (parent != htd::Vertex::UNKNOWN)
+        if (parent != htd::Vertex::UNKNOWN && indexedSetCoverAlgorithm == nullptr)
         {
             std::size_t forgottenVertexCount = forgottenVertices.size();
 
@@ -478,8 +632,6 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
             }
         }
     });
-
-    delete setCoverAlgorithm;
 }
 
 #endif /* HTD_HTD_HYPERTREEDECOMPOSITIONALGORITHM_CPP */
@@ -0,0 +1,397 @@
+/*
+ * File:   IndexedGreedySetCoverAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_INDEXEDGREEDYSETCOVERALGORITHM_CPP
+#define HTD_HTD_INDEXEDGREEDYSETCOVERALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/IndexedGreedySetCoverAlgorithm.hpp>
+
+#include <algorithm>
+#include <functional>
+
+/**
+ *  Private implementation details of class htd::IndexedGreedySetCoverAlgorithm.
+ */
+struct htd::IndexedGreedySetCoverAlgorithm::Implementation
+{
+    /**
+     *  Inverted index mapping each element to the indices of the containers including it.
+     */
+    struct InvertedIndex
+    {
+        /**
+         *  Constructor for an empty inverted index.
+         */
+        InvertedIndex(void) : offsets_(1, 0), postings_()
+        {
+
+        }
+
+        /**
+         *  Build the inverted index of the given collection of containers.
+         *
+         *  @param[in] containers   The collection of containers.
+         */
+        void build(const std::vector<std::vector<htd::id_t>> & containers)
+        {
+            htd::id_t elementBound = 0;
+
+            std::size_t postingCount = 0;
+
+            for (const std::vector<htd::id_t> & container : containers)
+            {
+                if (!container.empty())
+                {
+                    elementBound = std::max(elementBound, container.back() + 1);
+                }
+
+                postingCount += container.size();
+            }
+
+            offsets_.assign(elementBound + 1, 0);
+
+            for (const std::vector<htd::id_t> & container : containers)
+            {
+                for (htd::id_t element : container)
+                {
+                    ++offsets_[element + 1];
+                }
+            }
+
+            for (htd::index_t index = 1; index <= elementBound; ++index)
+            {
+                offsets_[index] += offsets_[index - 1];
+            }
+
+            postings_.resize(postingCount);
+
+            std::vector<htd::index_t> positions(offsets_.begin(), offsets_.end() - 1);
+
+            /* The containers are visited in ascending order, hence the postings of each element are sorted. */
+            for (htd::index_t containerIndex = 0; containerIndex < containers.size(); ++containerIndex)
+            {
+                for (htd::id_t element : containers[containerIndex])
+                {
+                    postings_[positions[element]++] = containerIndex;
+                }
+            }
+        }
+
+        /**
+         *  Getter for the exclusive upper bound of the elements included in at least one container.
+         *
+         *  @return The exclusive upper bound of the elements included in at least one container.
+         */
+        htd::id_t elementBound(void) const
+        {
+            return offsets_.size() - 1;
+        }
+
+        /**
+         *  The position of the first posting of each element, followed by the total number of postings.
+         */
+        std::vector<htd::index_t> offsets_;
+
+        /**
+         *  The indices of the containers including each element, grouped by element.
+         */
+        std::vector<htd::index_t> postings_;
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), containers_(), index_(), overlaps_(), touchedContainers_(), uncovered_(), buckets_()
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), containers_(original.containers_), index_(original.index_), overlaps_(), touchedContainers_(), uncovered_(), buckets_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The collection of containers set via setContainers().
+     */
+    std::vector<std::vector<htd::id_t>> containers_;
+
+    /**
+     *  The inverted index of the collection of containers set via setContainers().
+     */
+    InvertedIndex index_;
+
+    /**
+     *  Scratch buffer holding the number of uncovered elements of each container.
+     */
+    mutable std::vector<std::size_t> overlaps_;
+
+    /**
+     *  Scratch buffer holding the indices of the containers with a non-zero overlap.
+     */
+    mutable std::vector<htd::index_t> touchedContainers_;
+
+    /**
+     *  Scratch buffer indicating for each element whether it still needs to be covered.
+     */
+    mutable std::vector<bool> uncovered_;
+
+    /**
+     *  Scratch buffer holding the bucket queue. Bucket i is a min-heap of the indices of the containers with overlap i.
+     *
+     *  Containers are not removed from their previous bucket when their overlap decreases. Such outdated entries are
+     *  detected and skipped as soon as they reach the top of their heap.
+     */
+    mutable std::vector<std::vector<htd::index_t>> buckets_;
+
+    /**
+     *  Compute a set cover of the given elements.
+     *
+     *  @param[in] elements     The set of elements which must be covered.
+     *  @param[in] containers   The collection of containers which are available for covering the given elements.
+     *  @param[in] index        The inverted index of the collection of containers.
+     *  @param[out] target      The target vector to which the indices of the covering containers shall be appended.
+     */
+    void computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, const InvertedIndex & index, std::vector<htd::index_t> & target) const;
+};
+
+htd::IndexedGreedySetCoverAlgorithm::IndexedGreedySetCoverAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::IndexedGreedySetCoverAlgorithm::IndexedGreedySetCoverAlgorithm(const htd::IndexedGreedySetCoverAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::IndexedGreedySetCoverAlgorithm::~IndexedGreedySetCoverAlgorithm()
+{
+
+}
+
+void htd::IndexedGreedySetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
+{
+    if (!elements.empty())
+    {
+        Implementation::InvertedIndex index;
+
+        index.build(containers);
+
+        implementation_->computeSetCover(elements, containers, index, target);
+    }
+}
+
+void htd::IndexedGreedySetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
+{
+    if (!elements.empty())
+    {
+        computeSetCover(std::vector<htd::id_t>(elements.begin(), elements.end()), std::vector<std::vector<htd::id_t>>(containers.begin(), containers.end()), target);
+    }
+}
+
+void htd::IndexedGreedySetCoverAlgorithm::setContainers(const std::vector<std::vector<htd::id_t>> & containers)
+{
+    implementation_->containers_ = containers;
+
+    implementation_->index_.build(containers);
+}
+
+void htd::IndexedGreedySetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elements, std::vector<htd::index_t> & target) const
+{
+    if (!elements.empty())
+    {
+        implementation_->computeSetCover(elements, implementation_->containers_, implementation_->index_, target);
+    }
+}
+
+const htd::LibraryInstance * htd::IndexedGreedySetCoverAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::IndexedGreedySetCoverAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::IndexedGreedySetCoverAlgorithm * htd::IndexedGreedySetCoverAlgorithm::clone(void) const
+{
+    return new htd::IndexedGreedySetCoverAlgorithm(*this);
+}
+
+void htd::IndexedGreedySetCoverAlgorithm::Implementation::computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, const InvertedIndex & index, std::vector<htd::index_t> & target) const
+{
+    htd::id_t elementBound = index.elementBound();
+
+    bool coverable = true;
+
+    for (auto it = elements.begin(); coverable && it != elements.end(); ++it)
+    {
+        coverable = *it < elementBound && index.offsets_[*it] < index.offsets_[*it + 1];
+    }
+
+    /* Elements which are not included in any container cannot be covered, hence there is no set cover. */
+    if (coverable)
+    {
+        if (overlaps_.size() < containers.size())
+        {
+            overlaps_.resize(containers.size(), 0);
+        }
+
+        if (uncovered_.size() < elementBound)
+        {
+            uncovered_.resize(elementBound, false);
+        }
+
+        std::size_t maximumOverlap = 0;
+
+        for (htd::id_t element : elements)
+        {
+            uncovered_[element] = true;
+
+            for (htd::index_t position = index.offsets_[element]; position < index.offsets_[element + 1]; ++position)
+            {
+                htd::index_t containerIndex = index.postings_[position];
+
+                if (overlaps_[containerIndex] == 0)
+                {
+                    touchedContainers_.push_back(containerIndex);
+                }
+
+                maximumOverlap = std::max(maximumOverlap, ++overlaps_[containerIndex]);
+            }
+        }
+
+        if (buckets_.size() <= maximumOverlap)
+        {
+            buckets_.resize(maximumOverlap + 1);
+        }
+
+        /* The touched containers are pushed in ascending order, hence each bucket already satisfies the heap property. */
+        std::sort(touchedContainers_.begin(), touchedContainers_.end());
+
+        for (htd::index_t containerIndex : touchedContainers_)
+        {
+            buckets_[overlaps_[containerIndex]].push_back(containerIndex);
+        }
+
+        std::vector<htd::index_t> result;
+
+        std::size_t remainingElements = elements.size();
+
+        std::size_t currentOverlap = maximumOverlap;
+
+        while (remainingElements > 0)
+        {
+            std::vector<htd::index_t> & bucket = buckets_[currentOverlap];
+
+            if (bucket.empty())
+            {
+                --currentOverlap;
+            }
+            else
+            {
+                htd::index_t selectedContainer = bucket.front();
+
+                std::pop_heap(bucket.begin(), bucket.end(), std::greater<htd::index_t>());
+
+                bucket.pop_back();
+
+                /* Among the containers with maximum overlap, the one with the smallest index is selected, just like in htd::GreedySetCoverAlgorithm. */
+                if (overlaps_[selectedContainer] == currentOverlap)
+                {
+                    result.push_back(selectedContainer);
+
+                    overlaps_[selectedContainer] = 0;
+
+                    for (htd::id_t element : containers[selectedContainer])
+                    {
+                        if (element < elementBound && uncovered_[element])
+                        {
+                            uncovered_[element] = false;
+
+                            --remainingElements;
+
+                            for (htd::index_t position = index.offsets_[element]; position < index.offsets_[element + 1]; ++position)
+                            {
+                                htd::index_t containerIndex = index.postings_[position];
+
+                                if (overlaps_[containerIndex] > 0)
+                                {
+                                    std::size_t overlap = --overlaps_[containerIndex];
+
+                                    if (overlap > 0)
+                                    {
+                                        buckets_[overlap].push_back(containerIndex);
+
+                                        std::push_heap(buckets_[overlap].begin(), buckets_[overlap].end(), std::greater<htd::index_t>());
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        for (htd::index_t containerIndex : touchedContainers_)
+        {
+            overlaps_[containerIndex] = 0;
+        }
+
+        touchedContainers_.clear();
+
+        for (htd::index_t overlap = 0; overlap <= maximumOverlap; ++overlap)
+        {
+            buckets_[overlap].clear();
+        }
+
+        std::sort(result.begin(), result.end());
+
+        target.insert(target.end(), result.begin(), result.end());
+    }
+}
+
+#endif /* HTD_HTD_INDEXEDGREEDYSETCOVERALGORITHM_CPP */
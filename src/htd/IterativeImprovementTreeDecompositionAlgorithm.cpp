@@ -29,8 +29,16 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/Helpers.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::IterativeImprovementTreeDecompositionAlgorithm.
@@ -45,7 +53,7 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @param[in] fitnessFunction  The fitness function which will be used to evaluate the constructed tree decompositions.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction)
-        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
+        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
     {
 
     }
@@ -82,6 +90,11 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of worker threads which shall be used to perform the iterations.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The decomposition algorithm which will be called repeatedly.
      */
@@ -110,6 +123,249 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @return A mutable tree decompostion of the given graph.
      */
     htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Apply the given manipulation operations and labeling functions to a decomposition.
+     *
+     *  @param[in] graph                    The graph from which the decomposition was computed.
+     *  @param[in] decomposition            The decomposition which shall be post-processed.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied in the given order.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied in the given order.
+     */
+    static void postProcessDecomposition(const htd::IMultiHypergraph & graph,
+                                         htd::IMutableTreeDecomposition & decomposition,
+                                         const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                         const std::vector<htd::ILabelingFunction *> & labelingFunctions)
+    {
+        for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+        {
+            operation->apply(graph, decomposition);
+        }
+
+        for (const htd::ILabelingFunction * labelingFunction : labelingFunctions)
+        {
+            for (htd::vertex_t vertex : decomposition.vertices())
+            {
+                htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+    }
+
+    /**
+     *  Perform the iterations on multiple worker threads and return the best decomposition found.
+     *
+     *  The results of the iterations are committed in the order of their indices, so ties are resolved in favor of
+     *  the lowest iteration index and the non-improvement limit stops the search at the same iteration as if the
+     *  iterations were performed one after another.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] postProcessingOperations The manipulation operations which were provided for the current call.
+     *  @param[in] labelingFunctions        The labeling functions which were provided for the current call.
+     *  @param[in] progressCallback         A callback function which is invoked for each improved decomposition.
+     *  @param[in] threadCount              The number of worker threads which shall be used.
+     *
+     *  @return The best decomposition found by one of the workers.
+     */
+    htd::ITreeDecomposition * computeDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                             const htd::IPreprocessedGraph & preprocessedGraph,
+                                                             const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                             const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                             const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                             std::size_t threadCount) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        std::atomic<htd::index_t> nextIteration(0);
+
+        std::atomic<htd::index_t> iterationLimit(iterationCount_ == 0 ? (htd::index_t)-1 : std::max(iterationCount_, (std::size_t)1));
+
+        std::mutex resultMutex;
+
+        std::condition_variable resultCondition;
+
+        std::map<htd::index_t, std::pair<htd::ITreeDecomposition *, htd::FitnessEvaluation *>> pendingResults;
+
+        htd::index_t nextCommittedIteration = 0;
+
+        std::size_t nonImprovementCount = 0;
+
+        htd::ITreeDecomposition * ret = nullptr;
+
+        htd::FitnessEvaluation * bestEvaluation = nullptr;
+
+        /* Each iteration re-seeds the random number generator of its thread with a seed derived from its index, so its result does not depend on the thread performing it. */
+        std::uint_fast32_t randomSeed = htd::randomNumberGenerator()();
+
+        auto worker = [&]()
+        {
+            std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+            std::unique_ptr<htd::ITreeDecompositionFitnessFunction> fitnessFunction(fitnessFunction_->clone());
+
+            std::vector<htd::ITreeDecompositionManipulationOperation *> clonedPostProcessingOperations;
+
+            std::vector<htd::ILabelingFunction *> clonedLabelingFunctions;
+
+            for (const std::vector<htd::ITreeDecompositionManipulationOperation *> * operations : { &postProcessingOperations_, &postProcessingOperations })
+            {
+                for (const htd::ITreeDecompositionManipulationOperation * operation : *operations)
+                {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                    clonedPostProcessingOperations.push_back(operation->clone());
+#else
+                    clonedPostProcessingOperations.push_back(operation->cloneTreeDecompositionManipulationOperation());
+#endif
+                }
+            }
+
+            for (const std::vector<htd::ILabelingFunction *> * functions : { &labelingFunctions_, &labelingFunctions })
+            {
+                for (const htd::ILabelingFunction * labelingFunction : *functions)
+                {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                    clonedLabelingFunctions.push_back(labelingFunction->clone());
+#else
+                    clonedLabelingFunctions.push_back(labelingFunction->cloneLabelingFunction());
+#endif
+                }
+            }
+
+            for (htd::index_t iteration = nextIteration++; iteration < iterationLimit.load() && !managementInstance.isTerminated(); iteration = nextIteration++)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(resultMutex);
+
+                    /* A worker may not run more than threadCount iterations ahead of the committed prefix, so at most threadCount decompositions are parked at any time. */
+                    resultCondition.wait(lock, [&]() { return iteration < nextCommittedIteration + threadCount || iteration >= iterationLimit.load() || managementInstance.isTerminated(); });
+                }
+
+                if (iteration >= iterationLimit.load() || managementInstance.isTerminated())
+                {
+                    break;
+                }
+
+                htd::seedRandomNumberGenerator(htd::deriveRandomSeed(randomSeed, iteration));
+
+                htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm->computeDecomposition(graph, preprocessedGraph));
+
+                htd::FitnessEvaluation * currentEvaluation = nullptr;
+
+                if (currentDecomposition != nullptr)
+                {
+                    postProcessDecomposition(graph, *currentDecomposition, clonedPostProcessingOperations, clonedLabelingFunctions);
+
+                    if (!managementInstance.isTerminated())
+                    {
+                        currentEvaluation = fitnessFunction->fitness(graph, *currentDecomposition);
+                    }
+                }
+
+                if (managementInstance.isTerminated())
+                {
+                    delete currentDecomposition;
+
+                    delete currentEvaluation;
+
+                    break;
+                }
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+
+                pendingResults[iteration] = std::make_pair(currentDecomposition, currentEvaluation);
+
+                for (auto position = pendingResults.begin();
+                     position != pendingResults.end() && position->first == nextCommittedIteration && nextCommittedIteration < iterationLimit.load();
+                     position = pendingResults.erase(position))
+                {
+                    htd::ITreeDecomposition * committedDecomposition = position->second.first;
+
+                    htd::FitnessEvaluation * committedEvaluation = position->second.second;
+
+                    if (committedDecomposition != nullptr && (bestEvaluation == nullptr || *committedEvaluation > *bestEvaluation))
+                    {
+                        progressCallback(graph, *committedDecomposition, *committedEvaluation);
+
+                        delete ret;
+
+                        delete bestEvaluation;
+
+                        ret = committedDecomposition;
+
+                        bestEvaluation = committedEvaluation;
+
+                        nonImprovementCount = 0;
+                    }
+                    else
+                    {
+                        delete committedDecomposition;
+
+                        delete committedEvaluation;
+
+                        ++nonImprovementCount;
+                    }
+
+                    ++nextCommittedIteration;
+
+                    if (nonImprovementCount > nonImprovementLimit_)
+                    {
+                        iterationLimit = nextCommittedIteration;
+                    }
+                }
+
+                resultCondition.notify_all();
+            }
+
+            for (htd::ITreeDecompositionManipulationOperation * operation : clonedPostProcessingOperations)
+            {
+                delete operation;
+            }
+
+            for (htd::ILabelingFunction * labelingFunction : clonedLabelingFunctions)
+            {
+                delete labelingFunction;
+            }
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+
+            resultCondition.notify_all();
+        };
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(worker);
+        }
+
+        {
+            htd::RandomNumberGeneratorGuard randomNumberGeneratorGuard;
+
+            worker();
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+
+        for (auto & pendingResult : pendingResults)
+        {
+            delete pendingResult.second.first;
+
+            delete pendingResult.second.second;
+        }
+
+        delete bestEvaluation;
+
+        return ret;
+    }
 };
 
 htd::IterativeImprovementTreeDecompositionAlgorithm::IterativeImprovementTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction) : implementation_(new Implementation(manager, algorithm, fitnessFunction))
@@ -207,57 +463,53 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         }
     }
 
-    htd::ITreeDecomposition * ret = nullptr;
-
-    htd::FitnessEvaluation * bestEvaluation = nullptr;
+    std::size_t threadCount = implementation_->threadCount_;
 
-    std::size_t nonImprovementCount = 0;
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    if (implementation_->iterationCount_ > 0)
+    {
+        threadCount = std::min(threadCount, implementation_->iterationCount_);
+    }
 
-    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    if (threadCount > 1)
     {
-        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
+        htd::ITreeDecomposition * ret = implementation_->computeDecompositionInParallel(graph, preprocessedGraph, postProcessingOperations, labelingFunctions, progressCallback, threadCount);
 
-        if (currentDecomposition != nullptr)
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
         {
-            for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+            delete operation;
+        }
 
-            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+        return ret;
+    }
 
-            for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+    std::vector<htd::ITreeDecompositionManipulationOperation *> allPostProcessingOperations(implementation_->postProcessingOperations_);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+    allPostProcessingOperations.insert(allPostProcessingOperations.end(), postProcessingOperations.begin(), postProcessingOperations.end());
 
-                    delete labelCollection;
+    std::vector<htd::ILabelingFunction *> allLabelingFunctions(implementation_->labelingFunctions_);
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+    allLabelingFunctions.insert(allLabelingFunctions.end(), labelingFunctions.begin(), labelingFunctions.end());
 
-            for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+    htd::ITreeDecomposition * ret = nullptr;
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+    htd::FitnessEvaluation * bestEvaluation = nullptr;
 
-                    delete labelCollection;
+    std::size_t nonImprovementCount = 0;
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    {
+        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
+
+        if (currentDecomposition != nullptr)
+        {
+            Implementation::postProcessDecomposition(graph, *currentDecomposition, allPostProcessingOperations, allLabelingFunctions);
 
             if (!managementInstance.isTerminated())
             {
@@ -437,6 +689,16 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setNonImprovementLimit
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::IterativeImprovementTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::IterativeImprovementTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -473,6 +735,7 @@ htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementT
 
     ret->setIterationCount(implementation_->iterationCount_);
     ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
 
     return ret;
 }
@@ -0,0 +1,207 @@
+/*
+ * File:   MaximalSetFilter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_MAXIMALSETFILTER_CPP
+#define HTD_HTD_MAXIMALSETFILTER_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/MaximalSetFilter.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+/**
+ *  Private implementation details of class htd::MaximalSetFilter.
+ */
+struct htd::MaximalSetFilter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : signatureCheckEnabled_(true)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : signatureCheckEnabled_(original.signatureCheckEnabled_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  A boolean flag indicating whether the signature-based rejection of candidates is enabled.
+     */
+    bool signatureCheckEnabled_;
+
+    /**
+     *  Compute the signature of a set. The signature of a subset is a subset of the signature of the superset.
+     *
+     *  @param[in] set  The set of elements.
+     *
+     *  @return The signature of the given set.
+     */
+    static std::uint64_t signature(const std::vector<htd::id_t> & set)
+    {
+        std::uint64_t ret = 0;
+
+        for (htd::id_t element : set)
+        {
+            ret |= static_cast<std::uint64_t>(1) << (element & 63);
+        }
+
+        return ret;
+    }
+};
+
+htd::MaximalSetFilter::MaximalSetFilter(void) : implementation_(new Implementation())
+{
+
+}
+
+htd::MaximalSetFilter::MaximalSetFilter(const htd::MaximalSetFilter & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::MaximalSetFilter::~MaximalSetFilter()
+{
+
+}
+
+void htd::MaximalSetFilter::computeMaximalSets(const std::vector<std::vector<htd::id_t>> & sets, std::vector<htd::index_t> & target) const
+{
+    bool signatureCheckEnabled = implementation_->signatureCheckEnabled_;
+
+    std::vector<htd::index_t> order(sets.size());
+
+    std::iota(order.begin(), order.end(), 0);
+
+    /* Larger sets are visited first, hence a set can only be contained in sets which were visited before. Among sets
+     * of equal size, the one with the larger index is visited first so that it is kept in case of identical sets. */
+    std::sort(order.begin(), order.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return sets[index1].size() > sets[index2].size() || (sets[index1].size() == sets[index2].size() && index1 > index2);
+    });
+
+    htd::id_t elementBound = 0;
+
+    for (const std::vector<htd::id_t> & set : sets)
+    {
+        if (!set.empty())
+        {
+            elementBound = std::max(elementBound, set.back() + 1);
+        }
+    }
+
+    /* For each element, the indices of the maximal sets found so far which contain it. As containment is transitive,
+     * it suffices to compare each set against the maximal sets. */
+    std::vector<std::vector<htd::index_t>> postings(elementBound);
+
+    std::vector<std::uint64_t> signatures(sets.size(), 0);
+
+    std::vector<htd::index_t> maximalSets;
+
+    for (htd::index_t index : order)
+    {
+        const std::vector<htd::id_t> & set = sets[index];
+
+        bool maximal = true;
+
+        if (set.empty())
+        {
+            maximal = maximalSets.empty();
+        }
+        else
+        {
+            const std::vector<htd::index_t> * candidates = &(postings[set[0]]);
+
+            for (auto it = set.begin() + 1; !candidates->empty() && it != set.end(); ++it)
+            {
+                if (postings[*it].size() < candidates->size())
+                {
+                    candidates = &(postings[*it]);
+                }
+            }
+
+            std::uint64_t signature = Implementation::signature(set);
+
+            for (auto it = candidates->begin(); maximal && it != candidates->end(); ++it)
+            {
+                const std::vector<htd::id_t> & candidate = sets[*it];
+
+                if (!signatureCheckEnabled || (signature & ~signatures[*it]) == 0)
+                {
+                    maximal = !std::includes(candidate.begin(), candidate.end(), set.begin(), set.end());
+                }
+            }
+
+            if (maximal)
+            {
+                signatures[index] = signature;
+
+                for (htd::id_t element : set)
+                {
+                    postings[element].push_back(index);
+                }
+            }
+        }
+
+        if (maximal)
+        {
+            maximalSets.push_back(index);
+        }
+    }
+
+    std::sort(maximalSets.begin(), maximalSets.end());
+
+    target.insert(target.end(), maximalSets.begin(), maximalSets.end());
+}
+
+bool htd::MaximalSetFilter::isSignatureCheckEnabled(void) const
+{
+    return implementation_->signatureCheckEnabled_;
+}
+
+void htd::MaximalSetFilter::setSignatureCheckEnabled(bool signatureCheckEnabled)
+{
+    implementation_->signatureCheckEnabled_ = signatureCheckEnabled;
+}
+
+htd::MaximalSetFilter * htd::MaximalSetFilter::clone(void) const
+{
+    return new htd::MaximalSetFilter(*this);
+}
+
+#endif /* HTD_HTD_MAXIMALSETFILTER_CPP */
@@ -96,7 +96,11 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    std::shared_ptr<const htd::AdjacencyArray> adjacencyArrayPointer = preprocessedGraph.adjacencyArray();
+
+    const htd::AdjacencyArray & adjacencyArray = *adjacencyArrayPointer;
+
+    std::vector<bool> numbered(preprocessedGraph.inputGraphVertexCount(), false);
 
     htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
 
@@ -122,25 +126,22 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        numbered[selectedVertex] = true;
 
-        for (htd::vertex_t neighbor : selectedNeighborhood)
+        for (const htd::vertex_t * it = adjacencyArray.begin(selectedVertex); it != adjacencyArray.end(selectedVertex); ++it)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+            htd::vertex_t neighbor = *it;
 
-            /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
-            // coverity[use_iterator]
-            currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+            if (!numbered[neighbor])
+            {
+                std::size_t & currentWeight = weights[neighbor];
 
-            std::size_t & currentWeight = weights[neighbor];
+                priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
 
-            priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
-
-            ++currentWeight;
+                ++currentWeight;
+            }
         }
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
-
         vertices.erase(selectedVertex);
 
         --size;
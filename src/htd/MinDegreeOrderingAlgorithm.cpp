@@ -32,6 +32,8 @@
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
+#include <htd/NeighborhoodWorkingSet.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -46,7 +48,7 @@ struct htd::MinDegreeOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), bucketPriorityQueueEnabled_(false)
     {
 
     }
@@ -61,16 +63,34 @@ struct htd::MinDegreeOrderingAlgorithm::Implementation
      */
     const htd::LibraryInstance * managementInstance_;
 
+    /**
+     *  A boolean flag indicating whether a bucket priority queue shall be used for selecting the vertex which is eliminated next.
+     */
+    bool bucketPriorityQueueEnabled_;
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           A function returning the current upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize) const HTD_NOEXCEPT;
+
     /**
      *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
      *
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
-     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in] maxBagSize           A function returning the current upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in] priorityQueue        The empty priority queue which shall be used for selecting the vertex which is eliminated next.
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
-    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+    template < typename PriorityQueueType >
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize, PriorityQueueType & priorityQueue) const HTD_NOEXCEPT;
 };
 
 htd::MinDegreeOrderingAlgorithm::MinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -108,6 +128,11 @@ htd::IVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const ht
 }
 
 htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, [maxBagSize]() { return maxBagSize; }, maxIterationCount);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -126,9 +151,9 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
 
         ++iterations;
     }
-    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+    while (currentMaxBagSize > maxBagSize() && iterations < maxIterationCount && !managementInstance.isTerminated());
 
-    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize())
     {
         ordering.clear();
 
@@ -138,7 +163,28 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
-std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t ret = 0;
+
+    if (bucketPriorityQueueEnabled_)
+    {
+        htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(preprocessedGraph.inputGraphVertexCount());
+
+        ret = writeOrderingTo(preprocessedGraph, target, maxBagSize, priorityQueue);
+    }
+    else
+    {
+        htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+        ret = writeOrderingTo(preprocessedGraph, target, maxBagSize, priorityQueue);
+    }
+
+    return ret;
+}
+
+template < typename PriorityQueueType >
+std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize, PriorityQueueType & priorityQueue) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
@@ -148,11 +194,11 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    std::shared_ptr<const htd::AdjacencyArray> adjacencyArray = preprocessedGraph.adjacencyArray();
 
-    std::vector<htd::vertex_t> difference;
+    htd::NeighborhoodWorkingSet neighborhood(*adjacencyArray);
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    std::vector<htd::vertex_t> difference;
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
@@ -169,7 +215,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
         priorityQueue.push(vertex, currentNeighborhood.size());
     }
 
-    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    while (size > 0 && ret <= maxBagSize() && !managementInstance_->isTerminated())
     {
         htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
 
@@ -220,6 +266,16 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
     return ret;
 }
 
+bool htd::MinDegreeOrderingAlgorithm::isBucketPriorityQueueEnabled(void) const
+{
+    return implementation_->bucketPriorityQueueEnabled_;
+}
+
+void htd::MinDegreeOrderingAlgorithm::setBucketPriorityQueueEnabled(bool bucketPriorityQueueEnabled)
+{
+    implementation_->bucketPriorityQueueEnabled_ = bucketPriorityQueueEnabled;
+}
+
 const htd::LibraryInstance * htd::MinDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -234,18 +290,22 @@ void htd::MinDegreeOrderingAlgorithm::setManagementInstance(const htd::LibraryIn
 
 htd::MinDegreeOrderingAlgorithm * htd::MinDegreeOrderingAlgorithm::clone(void) const
 {
-    return new htd::MinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+    htd::MinDegreeOrderingAlgorithm * ret = new htd::MinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+
+    ret->setBucketPriorityQueueEnabled(implementation_->bucketPriorityQueueEnabled_);
+
+    return ret;
 }
 
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 htd::IOrderingAlgorithm * htd::MinDegreeOrderingAlgorithm::cloneOrderingAlgorithm(void) const
 {
-    return new htd::MinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 
 htd::IWidthLimitableOrderingAlgorithm * htd::MinDegreeOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
 {
-    return new htd::MinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 #endif
 
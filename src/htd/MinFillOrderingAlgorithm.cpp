@@ -32,9 +32,10 @@
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
+#include <htd/NeighborhoodWorkingSet.hpp>
 
 #include <algorithm>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::AdvancedMinFillOrderingAlgorithm.
@@ -46,7 +47,7 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), bucketPriorityQueueEnabled_(false)
     {
 
     }
@@ -61,6 +62,11 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      */
     const htd::LibraryInstance * managementInstance_;
 
+    /**
+     *  A boolean flag indicating whether a bucket priority queue shall be used for selecting the vertex which is eliminated next.
+     */
+    bool bucketPriorityQueueEnabled_;
+
     /**
      *  Structure representing the preprocessed input for the algorithm.
      *
@@ -74,25 +80,24 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *  Compute the number of edges between a set of vertices.
          *
          *  @param[in] availableNeighborhoods   The neighborhoods of the provided vertices.
-         *  @param[in] vertices                 The vertices for which the number of edges shall be returned.
+         *  @param[in] begin                    The beginning of the sorted range of vertices for which the number of edges shall be returned.
+         *  @param[in] end                      The end of the sorted range of vertices for which the number of edges shall be returned.
          *
          *  @return The number of edges between the provided vertices.
          */
-        std::size_t computeEdgeCount(const std::vector<std::vector<htd::vertex_t>> & availableNeighborhoods, const std::vector<htd::vertex_t> & vertices)
+        std::size_t computeEdgeCount(const htd::AdjacencyArray & availableNeighborhoods, const htd::vertex_t * begin, const htd::vertex_t * end)
         {
             std::size_t ret = 0;
 
-            std::size_t remainder = vertices.size();
-
-            for (auto it = vertices.begin(); remainder > 0; --remainder)
+            for (const htd::vertex_t * it = begin; it != end;)
             {
                 htd::vertex_t vertex = *it;
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = availableNeighborhoods[vertex];
+                const htd::vertex_t * neighborhoodEnd = availableNeighborhoods.end(vertex);
 
                 ++it;
 
-                ret += htd::set_intersection_size(it, vertices.end(), std::upper_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), currentNeighborhood.end());
+                ret += htd::set_intersection_size(it, end, std::upper_bound(availableNeighborhoods.begin(vertex), neighborhoodEnd, vertex), neighborhoodEnd);
             }
 
             return ret;
@@ -112,11 +117,15 @@ struct htd::MinFillOrderingAlgorithm::Implementation
 
             fillValue.resize(size, 0);
 
+            std::shared_ptr<const htd::AdjacencyArray> adjacencyArrayPointer = preprocessedGraph.adjacencyArray();
+
+            const htd::AdjacencyArray & adjacencyArray = *adjacencyArrayPointer;
+
             for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
             {
-                const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+                std::size_t neighborCount = adjacencyArray.neighborCount(vertex);
 
-                std::size_t currentFillValue = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood);
+                std::size_t currentFillValue = ((neighborCount * (neighborCount - 1)) / 2) - computeEdgeCount(adjacencyArray, adjacencyArray.begin(vertex), adjacencyArray.end(vertex));
 
                 fillValue[vertex] = currentFillValue;
 
@@ -151,11 +160,25 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[in] input                The preprocessed, algorithm-specific input data.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
-     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in] maxBagSize           A function returning the current upper bound for the maximum bag size of a decomposition based on the resulting ordering.
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
-    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize) const HTD_NOEXCEPT;
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] input                The preprocessed, algorithm-specific input data.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           A function returning the current upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *  @param[in] priorityQueue        The empty priority queue which shall be used for selecting the vertex which is eliminated next.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    template < typename PriorityQueueType >
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize, PriorityQueueType & priorityQueue) const HTD_NOEXCEPT;
 };
 
 htd::MinFillOrderingAlgorithm::MinFillOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -193,6 +216,11 @@ htd::IVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd:
 }
 
 htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, [maxBagSize]() { return maxBagSize; }, maxIterationCount);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::function<std::size_t(void)> & maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -213,9 +241,9 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
 
         ++iterations;
     }
-    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+    while (currentMaxBagSize > maxBagSize() && iterations < maxIterationCount && !managementInstance.isTerminated());
 
-    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize())
     {
         ordering.clear();
 
@@ -225,21 +253,59 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
-std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t ret = 0;
+
+    if (bucketPriorityQueueEnabled_)
+    {
+        htd::BucketPriorityQueue<htd::vertex_t> priorityQueue(preprocessedGraph.inputGraphVertexCount());
+
+        ret = writeOrderingTo(preprocessedGraph, input, target, maxBagSize, priorityQueue);
+    }
+    else
+    {
+        htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+        ret = writeOrderingTo(preprocessedGraph, input, target, maxBagSize, priorityQueue);
+    }
+
+    return ret;
+}
+
+template < typename PriorityQueueType >
+std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, const std::function<std::size_t(void)> & maxBagSize, PriorityQueueType & priorityQueue) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
     std::size_t size = preprocessedGraph.inputGraphVertexCount();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    /* The remaining vertices are stored in a vector together with their positions so that both the removal of a vertex and the selection of a random vertex take constant time. */
+    std::vector<htd::vertex_t> vertices(preprocessedGraph.remainingVertices().begin(), preprocessedGraph.remainingVertices().end());
+
+    std::vector<htd::index_t> vertexPositions(size);
+
+    for (htd::index_t index = 0; index < vertices.size(); ++index)
+    {
+        vertexPositions[vertices[index]] = index;
+    }
+
+    auto removeVertex = [&](htd::vertex_t vertex)
+    {
+        htd::index_t position = vertexPositions[vertex];
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+        vertices[position] = vertices.back();
+
+        vertexPositions[vertices[position]] = position;
+
+        vertices.pop_back();
+    };
 
     std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    std::shared_ptr<const htd::AdjacencyArray> adjacencyArray = preprocessedGraph.adjacencyArray();
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    htd::NeighborhoodWorkingSet neighborhood(*adjacencyArray);
 
     std::size_t totalFill = input.totalFill;
 
@@ -269,7 +335,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
         priorityQueue.push(vertex, fillValue[vertex]);
     }
 
-    while (totalFill > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    while (totalFill > 0 && ret <= maxBagSize() && !managementInstance_->isTerminated())
     {
         htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
 
@@ -282,7 +348,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
             ret = selectedNeighborhood.size();
         }
 
-        vertices.erase(selectedVertex);
+        removeVertex(selectedVertex);
 
         affectedVertices.clear();
 
@@ -639,11 +705,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 #endif
     }
 
-    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    while (size > 0 && ret <= maxBagSize() && !managementInstance_->isTerminated())
     {
         htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices);
 
-        std::size_t neighborhoodSize = neighborhood[vertex].size();
+        std::size_t neighborhoodSize = neighborhood.size(vertex);
 
         if (neighborhoodSize > ret)
         {
@@ -652,7 +718,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         target.push_back(preprocessedGraph.vertexName(vertex));
 
-        vertices.erase(vertex);
+        removeVertex(vertex);
 
         --size;
 
@@ -662,6 +728,16 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     return ret;
 }
 
+bool htd::MinFillOrderingAlgorithm::isBucketPriorityQueueEnabled(void) const
+{
+    return implementation_->bucketPriorityQueueEnabled_;
+}
+
+void htd::MinFillOrderingAlgorithm::setBucketPriorityQueueEnabled(bool bucketPriorityQueueEnabled)
+{
+    implementation_->bucketPriorityQueueEnabled_ = bucketPriorityQueueEnabled;
+}
+
 const htd::LibraryInstance * htd::MinFillOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -676,18 +752,22 @@ void htd::MinFillOrderingAlgorithm::setManagementInstance(const htd::LibraryInst
 
 htd::MinFillOrderingAlgorithm * htd::MinFillOrderingAlgorithm::clone(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    htd::MinFillOrderingAlgorithm * ret = new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+
+    ret->setBucketPriorityQueueEnabled(implementation_->bucketPriorityQueueEnabled_);
+
+    return ret;
 }
 
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 htd::IOrderingAlgorithm * htd::MinFillOrderingAlgorithm::cloneOrderingAlgorithm(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 
 htd::IWidthLimitableOrderingAlgorithm * htd::MinFillOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 #endif
 
@@ -31,8 +31,11 @@
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::MinimumSeparatorAlgorithm.
@@ -44,7 +47,17 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), balancedSeparatorModeEnabled_(false), threadCount_(1)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), balancedSeparatorModeEnabled_(original.balancedSeparatorModeEnabled_), threadCount_(original.threadCount_)
     {
 
     }
@@ -58,6 +71,145 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  A boolean flag indicating whether the balanced separator mode is enabled.
+     */
+    bool balancedSeparatorModeEnabled_;
+
+    /**
+     *  The number of worker threads which shall be used to evaluate the source/sink pairs.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The best separating vertex set found during a call of computeSeparator(), shared between all worker threads.
+     *
+     *  Each source/sink pair is identified by its ordinal, i.e., its position in the sequence in which the pairs are
+     *  visited by a single thread. Separators of equal score are ranked by the ordinal of the pair which produced
+     *  them, so that the result is independent of the order in which the worker threads finish their work.
+     */
+    struct SearchState
+    {
+        /**
+         *  Constructor for a search state.
+         *
+         *  @param[in] separator    The initial separating vertex set. It is ranked before all source/sink pairs.
+         *  @param[in] score        The score of the initial separating vertex set.
+         */
+        SearchState(std::vector<htd::index_t> && separator, std::size_t score) : mutex_(), bestSeparator_(std::move(separator)), bestScore_(score), bestOrdinal_(0)
+        {
+
+        }
+
+        /**
+         *  Get the exclusive upper bound for the score of a separating vertex set produced by the given source/sink pair
+         *  such that it would replace the best known separating vertex set.
+         *
+         *  @param[in] ordinal  The ordinal of the source/sink pair.
+         *
+         *  @return The exclusive upper bound for the score of a separating vertex set produced by the given source/sink pair.
+         */
+        std::size_t scoreBound(std::size_t ordinal)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            return ordinal < bestOrdinal_ ? bestScore_.load() + 1 : bestScore_.load();
+        }
+
+        /**
+         *  Replace the best known separating vertex set by the given one if the latter is better.
+         *
+         *  @param[in] separator    The separating vertex set.
+         *  @param[in] score        The score of the separating vertex set.
+         *  @param[in] ordinal      The ordinal of the source/sink pair which produced the separating vertex set.
+         */
+        void update(std::vector<htd::index_t> & separator, std::size_t score, std::size_t ordinal)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (score < bestScore_.load() || (score == bestScore_.load() && ordinal < bestOrdinal_))
+            {
+                bestSeparator_.swap(separator);
+
+                bestScore_ = score;
+
+                bestOrdinal_ = ordinal;
+            }
+        }
+
+        /**
+         *  The mutex protecting the best known separating vertex set and the ordinal of its source/sink pair.
+         */
+        std::mutex mutex_;
+
+        /**
+         *  The best known separating vertex set.
+         */
+        std::vector<htd::index_t> bestSeparator_;
+
+        /**
+         *  The score of the best known separating vertex set. It may be read without holding the mutex.
+         */
+        std::atomic<std::size_t> bestScore_;
+
+        /**
+         *  The ordinal of the source/sink pair which produced the best known separating vertex set.
+         */
+        std::size_t bestOrdinal_;
+    };
+
+    /**
+     *  Compute the score of a separating vertex set. Smaller scores are better.
+     *
+     *  @param[in] neighborhood The neighborhood of each vertex, given by the vertex indices.
+     *  @param[in] separator    The separating vertex set, given by the vertex indices.
+     *
+     *  @return The size of the separating vertex set or, in balanced separator mode, the size of the separating vertex set plus the size of the largest connected component remaining after its removal.
+     */
+    std::size_t computeScore(const std::vector<std::vector<htd::index_t>> & neighborhood, const std::vector<htd::index_t> & separator) const;
+
+    /**
+     *  Compute the distance of each vertex from the given vertex.
+     *
+     *  @param[in] neighborhood The neighborhood of each vertex, given by the vertex indices.
+     *  @param[in] origin       The index of the vertex from which the distances shall be computed.
+     *
+     *  @return The distance of each vertex from the given vertex or (std::size_t)-1 for unreachable vertices.
+     */
+    std::vector<std::size_t> computeDistances(const std::vector<std::vector<htd::index_t>> & neighborhood, htd::index_t origin) const;
+
+    /**
+     *  Extract the minimum separating vertex set from a maximum flow within the flow network constructed by computeSeparator().
+     *
+     *  The separating vertex set consists of all vertices whose incoming copy is reachable from the source in the
+     *  residual network while their outgoing copy is not.
+     *
+     *  @param[in] neighborhood The neighborhood of each vertex, given by the vertex indices.
+     *  @param[in] flow         The maximum flow.
+     *  @param[in] sourceSet    The indices of the vertices whose outgoing copies are connected to the source of the flow.
+     *
+     *  @return The indices of the vertices of the separating vertex set in ascending order.
+     */
+    std::vector<htd::index_t> extractSeparator(const std::vector<std::vector<htd::index_t>> & neighborhood, const htd::IFlow & flow, const std::vector<htd::index_t> & sourceSet) const;
+
+    /**
+     *  Sweep through the minimum separating vertex sets between a growing set of source vertices and the given sink
+     *  vertex and update the best known separating vertex set accordingly.
+     *
+     *  Starting with the given source vertex, the source set is repeatedly extended by a vertex of the most recent
+     *  minimum separating vertex set, so that the separating vertex sets move from the source towards the sink. As
+     *  extending the source set keeps the current flow valid, each step continues from the flow of the previous step.
+     *
+     *  @param[in] neighborhood     The neighborhood of each vertex, given by the vertex indices.
+     *  @param[in] flowNetwork      The flow network constructed by computeSeparator(). It is restored before the function returns.
+     *  @param[in] maxFlowAlgorithm The algorithm used to compute the maximum flows.
+     *  @param[in] source           The index of the source vertex.
+     *  @param[in] sink             The index of the sink vertex.
+     *  @param[in] ordinal          The ordinal of the source/sink pair.
+     *  @param[in,out] state        The state of the separator search.
+     */
+    void sweepSeparators(const std::vector<std::vector<htd::index_t>> & neighborhood, htd::FlowNetworkStructure & flowNetwork, const htd::DinitzMaxFlowAlgorithm & maxFlowAlgorithm, htd::index_t source, htd::index_t sink, std::size_t ordinal, SearchState & state) const;
 };
 
 htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -65,6 +217,11 @@ htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::LibraryInst
 
 }
 
+htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::MinimumSeparatorAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
 htd::MinimumSeparatorAlgorithm::~MinimumSeparatorAlgorithm(void)
 {
 
@@ -87,7 +244,11 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
         ++index;
     }
 
-    htd::FlowNetworkStructure flowNetwork(n * 2);
+    std::vector<std::vector<htd::index_t>> neighborhood(n);
+
+    /* Vertex i of the flow network is the incoming copy and vertex i + n the outgoing copy of the i-th vertex.
+     * The last two vertices serve as super source and super sink in balanced separator mode. */
+    htd::FlowNetworkStructure flowNetwork(n * 2 + 2);
 
     for (htd::vertex_t vertex : graph.vertices())
     {
@@ -97,61 +258,178 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
 
         for (htd::vertex_t neighbor : graph.neighbors(vertex))
         {
-            htd::index_t neighborIndex = indices.at(neighbor);
+            if (neighbor != vertex)
+            {
+                htd::index_t neighborIndex = indices.at(neighbor);
+
+                neighborhood[vertexIndex].push_back(neighborIndex);
 
-            flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
-            flowNetwork.updateCapacity(neighborIndex + n, vertexIndex, (std::size_t)-1);
+                flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
+            }
         }
+
+        std::sort(neighborhood[vertexIndex].begin(), neighborhood[vertexIndex].end());
     }
 
     graph.copyVerticesTo(*ret);
 
-    for (htd::index_t i = 0; i < n; ++i)
+    std::vector<htd::index_t> bestSeparator(n);
+
+    std::iota(bestSeparator.begin(), bestSeparator.end(), 0);
+
+    std::size_t bestScore = implementation_->computeScore(neighborhood, bestSeparator);
+
+    std::vector<htd::index_t> sources(n);
+
+    std::iota(sources.begin(), sources.end(), 0);
+
+    std::stable_sort(sources.begin(), sources.end(), [&](htd::index_t vertex1, htd::index_t vertex2)
+    {
+        return neighborhood[vertex1].size() < neighborhood[vertex2].size();
+    });
+
+    /* The neighborhood of a vertex of minimum degree separates it from all non-adjacent vertices and serves as initial bound. */
+    if (n > 0 && neighborhood[sources[0]].size() + 1 < n)
     {
-        htd::vertex_t vertex1 = graph.vertexAtPosition(i);
+        std::size_t score = implementation_->computeScore(neighborhood, neighborhood[sources[0]]);
 
-        for (htd::index_t j = i + 1; j < n; ++j)
+        if (score < bestScore)
         {
-            htd::vertex_t vertex2 = graph.vertexAtPosition(j);
+            bestSeparator = neighborhood[sources[0]];
+
+            bestScore = score;
+        }
+    }
+
+    Implementation::SearchState state(std::move(bestSeparator), bestScore);
+
+    std::size_t threadCount = implementation_->threadCount_;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
 
-            if (!graph.isNeighbor(vertex1, vertex2))
+    /* Each additional worker thread gets its own copy of the flow network because the balanced separator mode temporarily modifies it. */
+    std::vector<htd::FlowNetworkStructure> additionalFlowNetworks(std::min(threadCount, std::max(n, (std::size_t)1)) - 1, flowNetwork);
+
+    /* At least one of any bestSeparator.size() + 1 vertices is not contained in a minimum separator, hence it
+     * suffices to use that many vertices as sources in order to find a minimum separator (Even's algorithm). */
+    for (htd::index_t sourceIndex = 0; sourceIndex < n && sourceIndex <= state.bestSeparator_.size() && state.bestScore_.load() > 0 && !implementation_->managementInstance_->isTerminated(); ++sourceIndex)
+    {
+        htd::index_t source = sources[sourceIndex];
+
+        const std::vector<htd::index_t> & sourceNeighborhood = neighborhood[source];
+
+        std::vector<std::size_t> distances = implementation_->computeDistances(neighborhood, source);
+
+        std::vector<htd::index_t> sinks;
+
+        for (htd::index_t sink = 0; sink < n; ++sink)
+        {
+            if (sink != source && !std::binary_search(sourceNeighborhood.begin(), sourceNeighborhood.end(), sink))
             {
-                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(implementation_->managementInstance_);
+                sinks.push_back(sink);
+            }
+        }
+
+        /* Distant sinks are likely to be separated from the source by small separators, so they are visited first
+         * in order to tighten the bound early. Unreachable vertices have maximum distance and are visited first. */
+        std::stable_sort(sinks.begin(), sinks.end(), [&](htd::index_t vertex1, htd::index_t vertex2)
+        {
+            return distances[vertex1] > distances[vertex2];
+        });
+
+        std::atomic<htd::index_t> nextSink(0);
 
-                htd::IFlow * flow = maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j);
+        auto worker = [&](htd::FlowNetworkStructure & network)
+        {
+            htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(implementation_->managementInstance_);
+
+            for (htd::index_t position = nextSink++;
+                 position < sinks.size() && state.bestScore_.load() > 0 && !implementation_->managementInstance_->isTerminated();
+                 position = nextSink++)
+            {
+                htd::index_t sink = sinks[position];
 
-                std::unordered_set<htd::vertex_t> candidate;
+                std::size_t ordinal = sourceIndex * n + position + 1;
 
-                for(htd::index_t k = 0; k < n; ++k)
+                if (implementation_->balancedSeparatorModeEnabled_)
                 {
-                    if (k != i && k != j)
+                    implementation_->sweepSeparators(neighborhood, network, maxFlowAlgorithm, source, sink, ordinal, state);
+                }
+                else
+                {
+                    std::vector<htd::index_t> sourceSet { source };
+
+                    std::size_t limit = state.scoreBound(ordinal);
+
+                    htd::IFlow * flow = maxFlowAlgorithm.determineMaximumFlow(network, source + n, sink, limit);
+
+                    if (flow->value() < limit && !implementation_->managementInstance_->isTerminated())
                     {
-                        std::size_t capacity = flowNetwork.capacity(k, k + n);
+                        std::vector<htd::index_t> separator = implementation_->extractSeparator(neighborhood, *flow, sourceSet);
 
-                        if (static_cast<std::size_t>(flow->flow(k, k + n)) == capacity && capacity > 0 && capacity < (std::size_t)-1)
-                        {
-                            candidate.insert(graph.vertexAtPosition(k));
-                        }
+                        state.update(separator, separator.size(), ordinal);
                     }
+
+                    delete flow;
                 }
+            }
+        };
 
-                if (candidate.size() < ret->size())
-                {
-                    ret->clear();
+        std::vector<std::thread> threads;
 
-                    ret->insert(ret->end(), candidate.begin(), candidate.end());
+        for (std::size_t threadIndex = 1; threadIndex < threadCount && threadIndex < sinks.size(); ++threadIndex)
+        {
+            threads.emplace_back(worker, std::ref(additionalFlowNetworks[threadIndex - 1]));
+        }
 
-                    std::sort(ret->begin(), ret->end());
-                }
+        worker(flowNetwork);
 
-                delete flow;
-            }
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    bestSeparator.swap(state.bestSeparator_);
+
+    if (bestSeparator.size() < n)
+    {
+        ret->clear();
+
+        for (htd::index_t separatorVertex : bestSeparator)
+        {
+            ret->push_back(graph.vertexAtPosition(separatorVertex));
         }
+
+        std::sort(ret->begin(), ret->end());
     }
 
     return ret;
 }
 
+bool htd::MinimumSeparatorAlgorithm::isBalancedSeparatorModeEnabled(void) const
+{
+    return implementation_->balancedSeparatorModeEnabled_;
+}
+
+void htd::MinimumSeparatorAlgorithm::setBalancedSeparatorModeEnabled(bool balancedSeparatorModeEnabled)
+{
+    implementation_->balancedSeparatorModeEnabled_ = balancedSeparatorModeEnabled;
+}
+
+std::size_t htd::MinimumSeparatorAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::MinimumSeparatorAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::MinimumSeparatorAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -166,7 +444,231 @@ void htd::MinimumSeparatorAlgorithm::setManagementInstance(const htd::LibraryIns
 
 htd::MinimumSeparatorAlgorithm * htd::MinimumSeparatorAlgorithm::clone(void) const
 {
-    return new htd::MinimumSeparatorAlgorithm(managementInstance());
+    return new htd::MinimumSeparatorAlgorithm(*this);
+}
+
+std::size_t htd::MinimumSeparatorAlgorithm::Implementation::computeScore(const std::vector<std::vector<htd::index_t>> & neighborhood, const std::vector<htd::index_t> & separator) const
+{
+    std::size_t ret = separator.size();
+
+    if (balancedSeparatorModeEnabled_)
+    {
+        std::size_t largestComponentSize = 0;
+
+        std::vector<bool> visited(neighborhood.size(), false);
+
+        for (htd::index_t separatorVertex : separator)
+        {
+            visited[separatorVertex] = true;
+        }
+
+        std::vector<htd::index_t> stack;
+
+        for (htd::index_t vertex = 0; vertex < neighborhood.size(); ++vertex)
+        {
+            if (!visited[vertex])
+            {
+                std::size_t componentSize = 0;
+
+                visited[vertex] = true;
+
+                stack.push_back(vertex);
+
+                while (!stack.empty())
+                {
+                    htd::index_t currentVertex = stack.back();
+
+                    stack.pop_back();
+
+                    ++componentSize;
+
+                    for (htd::index_t neighbor : neighborhood[currentVertex])
+                    {
+                        if (!visited[neighbor])
+                        {
+                            visited[neighbor] = true;
+
+                            stack.push_back(neighbor);
+                        }
+                    }
+                }
+
+                largestComponentSize = std::max(largestComponentSize, componentSize);
+            }
+        }
+
+        ret += largestComponentSize;
+    }
+
+    return ret;
+}
+
+std::vector<std::size_t> htd::MinimumSeparatorAlgorithm::Implementation::computeDistances(const std::vector<std::vector<htd::index_t>> & neighborhood, htd::index_t origin) const
+{
+    std::vector<std::size_t> ret(neighborhood.size(), (std::size_t)-1);
+
+    std::vector<htd::index_t> queue;
+
+    queue.reserve(neighborhood.size());
+
+    ret[origin] = 0;
+
+    queue.push_back(origin);
+
+    for (htd::index_t index = 0; index < queue.size(); ++index)
+    {
+        htd::index_t vertex = queue[index];
+
+        for (htd::index_t neighbor : neighborhood[vertex])
+        {
+            if (ret[neighbor] == (std::size_t)-1)
+            {
+                ret[neighbor] = ret[vertex] + 1;
+
+                queue.push_back(neighbor);
+            }
+        }
+    }
+
+    return ret;
+}
+
+void htd::MinimumSeparatorAlgorithm::Implementation::sweepSeparators(const std::vector<std::vector<htd::index_t>> & neighborhood, htd::FlowNetworkStructure & flowNetwork, const htd::DinitzMaxFlowAlgorithm & maxFlowAlgorithm, htd::index_t source, htd::index_t sink, std::size_t ordinal, SearchState & state) const
+{
+    std::size_t n = neighborhood.size();
+
+    htd::vertex_t superSource = 2 * n;
+    htd::vertex_t superSink = 2 * n + 1;
+
+    std::vector<htd::index_t> sourceSet { source };
+
+    flowNetwork.updateCapacity(superSource, source + n, (std::size_t)-1);
+
+    flowNetwork.updateCapacity(sink, superSink, (std::size_t)-1);
+
+    htd::IFlow * flow = nullptr;
+
+    bool finished = false;
+
+    while (!finished && !managementInstance_->isTerminated())
+    {
+        /* The score of a separator in balanced separator mode exceeds its size by at least one. */
+        std::size_t limit = state.scoreBound(ordinal) - 1;
+
+        htd::IFlow * improvedFlow = maxFlowAlgorithm.determineMaximumFlow(flowNetwork, superSource, superSink, limit, flow);
+
+        delete flow;
+
+        flow = improvedFlow;
+
+        if (flow->value() >= limit || managementInstance_->isTerminated())
+        {
+            finished = true;
+        }
+        else
+        {
+            std::vector<htd::index_t> separator = extractSeparator(neighborhood, *flow, sourceSet);
+
+            if (separator.empty())
+            {
+                finished = true;
+            }
+            else
+            {
+                sourceSet.push_back(separator[0]);
+
+                flowNetwork.updateCapacity(superSource, separator[0] + n, (std::size_t)-1);
+            }
+
+            state.update(separator, computeScore(neighborhood, separator), ordinal);
+        }
+    }
+
+    delete flow;
+
+    for (htd::index_t vertex : sourceSet)
+    {
+        flowNetwork.updateCapacity(superSource, vertex + n, 0);
+    }
+
+    flowNetwork.updateCapacity(sink, superSink, 0);
+}
+
+std::vector<htd::index_t> htd::MinimumSeparatorAlgorithm::Implementation::extractSeparator(const std::vector<std::vector<htd::index_t>> & neighborhood, const htd::IFlow & flow, const std::vector<htd::index_t> & sourceSet) const
+{
+    std::vector<htd::index_t> ret;
+
+    std::size_t n = neighborhood.size();
+
+    /* Vertex i of the flow network is the incoming copy and vertex i + n the outgoing copy of the i-th vertex. */
+    std::vector<bool> reachable(2 * n, false);
+
+    std::vector<htd::vertex_t> stack;
+
+    for (htd::index_t vertex : sourceSet)
+    {
+        reachable[vertex + n] = true;
+
+        stack.push_back(vertex + n);
+    }
+
+    while (!stack.empty())
+    {
+        htd::vertex_t vertex = stack.back();
+
+        stack.pop_back();
+
+        if (vertex < n)
+        {
+            if (!reachable[vertex + n] && flow.flow(vertex, vertex + n) == 0)
+            {
+                reachable[vertex + n] = true;
+
+                stack.push_back(vertex + n);
+            }
+
+            for (htd::index_t neighbor : neighborhood[vertex])
+            {
+                if (!reachable[neighbor + n] && flow.flow(neighbor + n, vertex) > 0)
+                {
+                    reachable[neighbor + n] = true;
+
+                    stack.push_back(neighbor + n);
+                }
+            }
+        }
+        else
+        {
+            htd::index_t vertexIndex = vertex - n;
+
+            if (!reachable[vertexIndex] && flow.flow(vertexIndex, vertex) > 0)
+            {
+                reachable[vertexIndex] = true;
+
+                stack.push_back(vertexIndex);
+            }
+
+            for (htd::index_t neighbor : neighborhood[vertexIndex])
+            {
+                if (!reachable[neighbor])
+                {
+                    reachable[neighbor] = true;
+
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    for (htd::index_t vertex = 0; vertex < n; ++vertex)
+    {
+        if (reachable[vertex] && !reachable[vertex + n])
+        {
+            ret.push_back(vertex);
+        }
+    }
+
+    return ret;
 }
 
 #endif /* HTD_HTD_MINIMUMSEPARATORALGORITHM_CPP */
@@ -32,6 +32,7 @@
 #include <htd/VectorAdapter.hpp>
 
 #include <algorithm>
+#include <mutex>
 #include <stack>
 #include <unordered_set>
 #include <vector>
@@ -57,7 +58,7 @@ struct htd::PreprocessedGraph::Implementation
                    std::vector<htd::vertex_t> && remainingVertices,
                    std::size_t inputGraphEdgeCount,
                    std::size_t minTreeWidth)
-        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
+        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount), adjacencyArray_(), adjacencyArrayMutex_()
     {
         updateEdgeCount();
     }
@@ -68,9 +69,11 @@ struct htd::PreprocessedGraph::Implementation
      *  @param[in] original  The original implementation details structure.
      */
     Implementation(const Implementation & original)
-        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
+        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_), adjacencyArray_(), adjacencyArrayMutex_()
     {
+        std::lock_guard<std::mutex> lock(original.adjacencyArrayMutex_);
 
+        adjacencyArray_ = original.adjacencyArray_;
     }
 
     virtual ~Implementation()
@@ -113,6 +116,26 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::size_t inputGraphEdgeCount_;
 
+    /**
+     *  The immutable adjacency array built from the neighborhood of each of the vertices or nullptr if it was not built yet.
+     */
+    mutable std::shared_ptr<const htd::AdjacencyArray> adjacencyArray_;
+
+    /**
+     *  The mutex protecting the lazy construction of the adjacency array.
+     */
+    mutable std::mutex adjacencyArrayMutex_;
+
+    /**
+     *  Release the share of the adjacency array because the neighborhoods are about to be modified.
+     */
+    void invalidateAdjacencyArray(void)
+    {
+        std::lock_guard<std::mutex> lock(adjacencyArrayMutex_);
+
+        adjacencyArray_.reset();
+    }
+
     /**
      *  Recompute the number of edges in the graph to update the result of the function edgeCount().
      */
@@ -407,6 +430,8 @@ void htd::PreprocessedGraph::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex));
 
+    implementation_->invalidateAdjacencyArray();
+
     std::vector<htd::vertex_t> & selectedNeighborhood = implementation_->neighborhood_[vertex];
 
     implementation_->edgeCount_ -= selectedNeighborhood.size();
@@ -439,8 +464,22 @@ htd::vertex_t htd::PreprocessedGraph::vertexName(htd::vertex_t vertex) const
     return implementation_->names_[vertex];
 }
 
+std::shared_ptr<const htd::AdjacencyArray> htd::PreprocessedGraph::adjacencyArray(void) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->adjacencyArrayMutex_);
+
+    if (!implementation_->adjacencyArray_)
+    {
+        implementation_->adjacencyArray_ = std::make_shared<const htd::AdjacencyArray>(implementation_->neighborhood_);
+    }
+
+    return implementation_->adjacencyArray_;
+}
+
 std::vector<std::vector<htd::vertex_t>> & htd::PreprocessedGraph::neighborhood(void) HTD_NOEXCEPT
 {
+    implementation_->invalidateAdjacencyArray();
+
     return implementation_->neighborhood_;
 }
 
@@ -453,6 +492,8 @@ std::vector<htd::vertex_t> & htd::PreprocessedGraph::neighborhood(htd::vertex_t
 {
     HTD_ASSERT(vertex < implementation_->names_.size());
 
+    implementation_->invalidateAdjacencyArray();
+
     return implementation_->neighborhood_[vertex];
 }
 
@@ -27,9 +27,9 @@
 
 #include <htd/Globals.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
-#include <htd/GreedySetCoverAlgorithm.hpp>
+#include <htd/IndexedGreedySetCoverAlgorithm.hpp>
 
-htd::SetCoverAlgorithmFactory::SetCoverAlgorithmFactory(const htd::LibraryInstance * const manager) : htd::AlgorithmFactory<htd::ISetCoverAlgorithm>(new htd::GreedySetCoverAlgorithm(manager))
+htd::SetCoverAlgorithmFactory::SetCoverAlgorithmFactory(const htd::LibraryInstance * const manager) : htd::AlgorithmFactory<htd::ISetCoverAlgorithm>(new htd::IndexedGreedySetCoverAlgorithm(manager))
 {
 
 }
@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 
 #include <htd/SingleNeighborVertexSelectionStrategy.hpp>
+#include <htd/Helpers.hpp>
 
 #include <algorithm>
 #include <random>
@@ -61,7 +62,7 @@ void htd::SingleNeighborVertexSelectionStrategy::selectVertices(const htd::IMult
 
     if (vertices.size() > limit_)
     {
-        std::shuffle(vertices.begin(), vertices.end(), std::default_random_engine());
+        std::shuffle(vertices.begin(), vertices.end(), htd::randomNumberGenerator());
 
         vertices.erase(vertices.begin() + limit_, vertices.end());
     }
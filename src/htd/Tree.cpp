@@ -32,6 +32,7 @@
 #include <htd/PreOrderTreeTraversal.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/HyperedgePointerDeque.hpp>
+#include <htd/DenseIdentifierMap.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
 
 #include <htd/Algorithm.hpp>
@@ -41,7 +42,6 @@
 #include <iterator>
 #include <memory>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 
 /**
@@ -74,6 +74,14 @@ struct htd::Tree::Implementation
          */
         std::vector<htd::vertex_t> children;
 
+        /**
+         *  Constructor for an unused tree node.
+         */
+        Node(void) : id(htd::Vertex::UNKNOWN), parent(htd::Vertex::UNKNOWN), edges(), children()
+        {
+
+        }
+
         /**
          *  Constructor for a tree node.
          *
@@ -104,6 +112,20 @@ struct htd::Tree::Implementation
         {
 
         }
+
+        /**
+         *  Copy assignment operator for a tree node.
+         *
+         *  @param[in] original  The original tree node.
+         */
+        Node & operator=(const Node & original) = default;
+
+        /**
+         *  Move assignment operator for a tree node.
+         *
+         *  @param[in] original  The original tree node.
+         */
+        Node & operator=(Node && original) = default;
     };
 
     /**
@@ -118,11 +140,6 @@ struct htd::Tree::Implementation
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         for (htd::Hyperedge * edge : *edges_)
         {
             delete edge;
@@ -141,16 +158,9 @@ struct htd::Tree::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
+          nodes_(original.nodes_),
           edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
-        nodes_.reserve(original.nodes_.size());
-
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
-
         for (const htd::Hyperedge * edge : *(original.edges_))
         {
             edges_->emplace_back(new htd::Hyperedge(*edge));
@@ -162,11 +172,6 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         nodes_.clear();
 
         for (htd::Hyperedge * edge : *edges_)
@@ -218,9 +223,9 @@ struct htd::Tree::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  The map of all tree nodes. It maps vertex IDs to the corresponding node information.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    htd::DenseIdentifierMap<Node> nodes_;
 
     /**
      *  The collection of all hyperedges which exist in the tree.
@@ -230,9 +235,9 @@ struct htd::Tree::Implementation
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
-     *  @param[in] node The node of the tree which shall be removed.
+     *  @param[in] vertex   The vertex of the tree which shall be removed.
      */
-    void deleteNode(Node * node);
+    void deleteNode(htd::vertex_t vertex);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
@@ -397,7 +402,7 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodes_.at(vertex);
 
     const auto & children = node.children;
 
@@ -445,7 +450,7 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodes_.at(vertex);
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
@@ -472,7 +477,7 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodes_.at(vertex);
 
     const auto & children = node.children;
 
@@ -665,7 +670,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->nodes_.at(vertex).parent;
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,28 +682,28 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->nodes_.at(vertex).parent == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->nodes_.at(vertex).children.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex).children);
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex).children;
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
@@ -707,7 +712,7 @@ htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->nodes_.at(vertex).children;
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +724,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->nodes_.at(vertex).children;
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +762,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex).parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->nodes_.at(currentVertex).parent;
     }
 
     return ret;
@@ -783,7 +788,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->nodes_.at(vertex);
 
     auto end = implementation_->edges_->end();
 
@@ -795,7 +800,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex).edges;
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -814,7 +819,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        Implementation::Node & parentNode = implementation_->nodes_.at(node.parent);
 
         auto & siblings = parentNode.children;
 
@@ -828,7 +833,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 htd::vertex_t child = children[0];
 
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                Implementation::Node & childNode = implementation_->nodes_.at(child);
 
                 childNode.parent = node.parent;
 
@@ -860,7 +865,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 for (htd::vertex_t child : children)
                 {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->nodes_.at(child);
 
                     childNode.parent = node.parent;
 
@@ -891,7 +896,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(vertex);
     }
     else
     {
@@ -914,9 +919,9 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+                implementation_->nodes_.at(implementation_->root_).parent = htd::Vertex::UNKNOWN;
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -924,7 +929,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                Implementation::Node & rootNode = implementation_->nodes_.at(implementation_->root_);
 
                 rootNode.parent = htd::Vertex::UNKNOWN;
 
@@ -934,7 +939,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                 {
                     htd::vertex_t child = *it;
 
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->nodes_.at(child);
 
                     childNode.parent = implementation_->root_;
 
@@ -961,7 +966,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                     implementation_->next_edge_++;
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -995,7 +1000,7 @@ htd::vertex_t htd::Tree::insertRoot(void)
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
         implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->nodes_.emplace(implementation_->root_, implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1018,7 +1023,7 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 
         while (vertex != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & node = *(implementation_->nodes_[vertex]);
+            Implementation::Node & node = implementation_->nodes_.at(vertex);
 
             nextVertex = node.parent;
 
@@ -1049,15 +1054,15 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->nodes_.at(vertex);
 
     ret = implementation_->next_vertex_;
 
     node.children.emplace_back(ret);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    implementation_->nodes_.emplace(ret, ret, vertex);
 
-    implementation_->nodes_.emplace(ret, newNode);
+    Implementation::Node & newNode = implementation_->nodes_.at(ret);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -1069,7 +1074,7 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     node.edges.push_back(implementation_->next_edge_);
 
-    newNode->edges.push_back(implementation_->next_edge_);
+    newNode.edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1081,7 +1086,7 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodes_.at(vertex);
 
     auto & children = node.children;
 
@@ -1116,13 +1121,11 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         ret = implementation_->next_vertex_;
 
-        node->parent = ret;
-
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        node.parent = ret;
 
-        newRootNode->children.emplace_back(vertex);
+        implementation_->nodes_.emplace(ret, ret, htd::Vertex::UNKNOWN);
 
-        implementation_->nodes_.emplace(ret, newRootNode);
+        implementation_->nodes_.at(ret).children.emplace_back(vertex);
 
         implementation_->vertices_.emplace_back(ret);
 
@@ -1136,8 +1139,8 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
+        Implementation::Node & parentNode = implementation_->nodes_.at(parentVertex);
+        Implementation::Node & selectedNode = implementation_->nodes_.at(vertex);
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
@@ -1170,7 +1173,7 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
+        auto & intermediateNode = implementation_->nodes_.at(ret);
 
         intermediateNode.parent = parentVertex;
 
@@ -1188,8 +1191,8 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
+    implementation_->nodes_.at(vertex).edges.push_back(implementation_->next_edge_);
+    implementation_->nodes_.at(ret).edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1202,17 +1205,17 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodes_.at(vertex);
 
     htd::vertex_t oldParent = node.parent;
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
+        auto & newParentNode = implementation_->nodes_.at(newParent);
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            auto & oldParentNode = implementation_->nodes_.at(oldParent);
 
             oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
 
@@ -1249,16 +1252,16 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->nodes_.at(relevantVertex).parent != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->nodes_.at(relevantVertex).parent;
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            auto & relevantNode = implementation_->nodes_.at(relevantVertex);
 
             relevantNode.parent = htd::Vertex::UNKNOWN;
 
@@ -1321,9 +1324,9 @@ std::size_t htd::Tree::leafCount(void) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->children.empty())
+        if (implementation_->nodes_.at(vertex).children.empty())
         {
             ret++;
         }
@@ -1343,11 +1346,11 @@ htd::ConstCollection<htd::vertex_t> htd::Tree::leaves(void) const
 
 void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->children.empty())
+        if (implementation_->nodes_.at(vertex).children.empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(vertex);
         }
     }
 
@@ -1371,20 +1374,20 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->nodes_.at(vertex).children.empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->nodes_.at(vertex);
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = implementation_->nodes_.at(parent);
 
     node.parent = parentNode.parent;
 
@@ -1402,7 +1405,7 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = implementation_->nodes_.at(grandParent);
 
         implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
 
@@ -1412,17 +1415,13 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     }
 }
 
-void htd::Tree::Implementation::deleteNode(Node * node)
+void htd::Tree::Implementation::deleteNode(htd::vertex_t vertex)
 {
-    HTD_ASSERT(node != nullptr)
-
-    auto & parent = node->parent;
-
-    htd::vertex_t vertex = node->id;
+    htd::vertex_t parent = nodes_.at(vertex).parent;
 
     if (parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        auto & children = nodes_.at(parent).children;
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
@@ -1431,8 +1430,6 @@ void htd::Tree::Implementation::deleteNode(Node * node)
 
     nodes_.erase(vertex);
 
-    delete node;
-
     size_--;
 }
 
@@ -1496,12 +1493,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->nodes_ = original.implementation_->nodes_;
 
         implementation_->root_ = original.implementation_->root_;
 
@@ -1551,22 +1543,18 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    implementation_->nodes_.emplace(vertex, vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    implementation_->nodes_.emplace(vertex, vertex, original.parent(vertex));
                 }
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
-                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
-
-                implementation_->nodes_.emplace(vertex, newNode);
+                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(implementation_->nodes_.at(vertex).children));
 
                 if (vertex > maximumVertex)
                 {
@@ -30,9 +30,14 @@
 #include <htd/TreeDecompositionOptimizationOperation.hpp>
 #include <htd/ExhaustiveVertexSelectionStrategy.hpp>
 #include <htd/CompressionOperation.hpp>
+#include <htd/IIncrementalTreeDecompositionFitnessFunction.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <stack>
+#include <thread>
 #include <unordered_set>
 
 /**
@@ -46,7 +51,7 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), enforceNaiveOptimization_(false), strategy_(nullptr), fitnessFunction_(nullptr), manipulationOperations_()
+        : managementInstance_(manager), enforceNaiveOptimization_(false), threadCount_(1), strategy_(nullptr), fitnessFunction_(nullptr), manipulationOperations_()
     {
 
     }
@@ -59,7 +64,7 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *  @param[in] enforceNaiveOptimization A boolean flag to enforce that each iteration of the optimization algorithm starts from scratch with a copy of the given decomposition.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionFitnessFunction * fitnessFunction, bool enforceNaiveOptimization)
-        : managementInstance_(manager), enforceNaiveOptimization_(enforceNaiveOptimization), strategy_(new htd::ExhaustiveVertexSelectionStrategy()), fitnessFunction_(fitnessFunction), manipulationOperations_()
+        : managementInstance_(manager), enforceNaiveOptimization_(enforceNaiveOptimization), threadCount_(1), strategy_(new htd::ExhaustiveVertexSelectionStrategy()), fitnessFunction_(fitnessFunction), manipulationOperations_()
     {
 
     }
@@ -93,6 +98,11 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      */
     bool enforceNaiveOptimization_;
 
+    /**
+     *  The number of worker threads which are used to evaluate the candidate roots when manipulation operations are involved.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The strategy defining which vertices shall be considered as root of the tree decomposition.
      */
@@ -127,6 +137,17 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      */
     void quickOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const;
 
+    /**
+     *  Select the optimal root of the given decomposition when no manipulation operations are involved and the fitness function
+     *  supports incremental evaluation. The summaries of all subtrees are computed in one bottom-up pass and re-rooted in one
+     *  top-down pass so that the fitness of each candidate root is available in linear time.
+     *
+     *  @param[in] graph            The graph which was decomposed.
+     *  @param[in] decomposition    The tree decomposition which shall be optimized.
+     *  @param[in] fitnessFunction  The incremental fitness function which is used to determine the quality of the decomposition.
+     */
+    void rerootingOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const htd::IIncrementalTreeDecompositionFitnessFunction & fitnessFunction) const;
+
     /**
      *  Select the optimal root of the given decomposition when complex manipulation operations are involved.
      *
@@ -155,6 +176,68 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *                                  visiting created nodes.
      */
     void removeCreatedNodes(htd::IMutableTreeDecomposition & decomposition, htd::vertex_t start, htd::vertex_t lastRegularVertex) const;
+
+    /**
+     *  Make a vertex the root of a decomposition to which the given safe manipulation operations were already applied.
+     *  The created vertices on the path between the new and the old root are removed and the manipulation operations
+     *  are re-applied to the affected vertices afterwards.
+     *
+     *  @param[in] graph                    The graph which was decomposed.
+     *  @param[in] decomposition            The tree decomposition which shall be re-rooted.
+     *  @param[in] vertex                   The new root of the decomposition.
+     *  @param[in] lastRegularVertex        The identifier of the last vertex which was not created by a manipulation operation.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be re-applied.
+     *  @param[in] labelingFunctions        A vector of labeling functions which shall be applied after the modifications.
+     *  @param[in,out] createdVertices      A vector to which the identifiers of the vertices created by the manipulation operations are appended.
+     *  @param[in,out] removedVertices      A vector to which the identifiers of the vertices removed by the manipulation operations are appended.
+     */
+    void makeRoot(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, htd::vertex_t lastRegularVertex, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations, const std::vector<htd::ILabelingFunction *> & labelingFunctions, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const;
+
+    /**
+     *  Create copies of the manipulation operations which are associated with the management instance of the optimization operation.
+     *
+     *  @return Copies of the manipulation operations in the order in which they shall be applied.
+     */
+    std::vector<htd::ITreeDecompositionManipulationOperation *> cloneManipulationOperations(void) const;
+
+    /**
+     *  Create copies of the given labeling functions which are associated with the management instance of the optimization operation.
+     *
+     *  @param[in] labelingFunctions    The labeling functions which shall be copied.
+     *
+     *  @return Copies of the given labeling functions in the same order.
+     */
+    std::vector<htd::ILabelingFunction *> cloneLabelingFunctions(const std::vector<htd::ILabelingFunction *> & labelingFunctions) const;
+
+    /**
+     *  Compute the number of worker threads which are actually used to evaluate the given number of candidate roots.
+     *
+     *  @param[in] candidateCount   The number of candidate roots.
+     *
+     *  @return The number of worker threads which are actually used to evaluate the given number of candidate roots.
+     */
+    std::size_t effectiveThreadCount(std::size_t candidateCount) const;
+
+    /**
+     *  Run the given worker function on the calling thread and on additional threads until the configured number of workers is reached.
+     *
+     *  @param[in] candidateCount   The number of candidate roots which are evaluated by the workers.
+     *  @param[in] worker           The worker function which evaluates candidate roots until none is left.
+     */
+    void evaluateInParallel(std::size_t candidateCount, const std::function<void(void)> & worker) const;
+
+    /**
+     *  Select the optimal candidate root based on the fitness evaluations of the candidates. Candidates are compared in their
+     *  given order so that the selection is identical to the one of the sequential evaluation.
+     *
+     *  @note All fitness evaluations are deleted except for the one of the selected root which is stored in optimalFitness.
+     *
+     *  @param[in] candidates               The candidate roots.
+     *  @param[in] fitnessEvaluations       The fitness evaluation of each candidate root or nullptr if the candidate was not evaluated.
+     *  @param[in,out] optimalRoot          The optimal root found so far.
+     *  @param[in,out] optimalFitness       The fitness evaluation of the optimal root found so far.
+     */
+    void selectOptimalCandidate(const std::vector<htd::vertex_t> & candidates, std::vector<htd::FitnessEvaluation *> & fitnessEvaluations, htd::vertex_t & optimalRoot, htd::FitnessEvaluation *& optimalFitness) const;
 };
 
 htd::TreeDecompositionOptimizationOperation::TreeDecompositionOptimizationOperation(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -216,7 +299,17 @@ void htd::TreeDecompositionOptimizationOperation::apply(const htd::IMultiHypergr
         {
             if (implementation_->manipulationOperations_.empty())
             {
-                implementation_->quickOptimization(graph, decomposition);
+                const htd::IIncrementalTreeDecompositionFitnessFunction * incrementalFitnessFunction =
+                    dynamic_cast<const htd::IIncrementalTreeDecompositionFitnessFunction *>(implementation_->fitnessFunction_);
+
+                if (incrementalFitnessFunction != nullptr)
+                {
+                    implementation_->rerootingOptimization(graph, decomposition, *incrementalFitnessFunction);
+                }
+                else
+                {
+                    implementation_->quickOptimization(graph, decomposition);
+                }
             }
             else
             {
@@ -357,6 +450,16 @@ void htd::TreeDecompositionOptimizationOperation::setVertexSelectionStrategy(htd
     implementation_->strategy_ = strategy;
 }
 
+std::size_t htd::TreeDecompositionOptimizationOperation::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::TreeDecompositionOptimizationOperation::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::TreeDecompositionOptimizationOperation::Implementation::quickOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const
 {
     const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
@@ -405,6 +508,161 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::quickOptimizat
     delete optimalFitness;
 }
 
+void htd::TreeDecompositionOptimizationOperation::Implementation::rerootingOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const htd::IIncrementalTreeDecompositionFitnessFunction & fitnessFunction) const
+{
+    htd::vertex_t initialRoot = decomposition.root();
+
+    std::vector<htd::vertex_t> candidates;
+
+    strategy_->selectVertices(decomposition, candidates);
+
+    std::size_t vertexCount = decomposition.vertexCount();
+
+    /* The nodes of the decomposition in breadth-first order, each node is identified by its position within this vector. */
+    std::vector<htd::vertex_t> nodes;
+
+    std::vector<htd::index_t> firstChild(vertexCount + 1, 0);
+
+    htd::vertex_t maximumVertex = 0;
+
+    for (htd::vertex_t vertex : decomposition.vertices())
+    {
+        maximumVertex = std::max(maximumVertex, vertex);
+    }
+
+    std::vector<htd::index_t> nodeIndex(maximumVertex + 1, 0);
+
+    nodes.reserve(vertexCount);
+
+    nodes.push_back(initialRoot);
+
+    /* Children are appended in blocks, hence the children of each node occupy a contiguous range of positions. */
+    for (htd::index_t index = 0; index < nodes.size(); ++index)
+    {
+        htd::vertex_t node = nodes[index];
+
+        nodeIndex[node] = index;
+
+        firstChild[index] = nodes.size();
+
+        for (htd::vertex_t child : decomposition.children(node))
+        {
+            nodes.push_back(child);
+        }
+    }
+
+    firstChild[vertexCount] = vertexCount;
+
+    HTD_ASSERT(nodes.size() == vertexCount)
+
+    std::vector<std::vector<double>> downwardSummaries(vertexCount);
+
+    std::vector<std::vector<double>> upwardSummaries(vertexCount);
+
+    std::vector<double> combinedSummary;
+
+    for (htd::index_t index = vertexCount; index > 0; --index)
+    {
+        fitnessFunction.initializeSummary(combinedSummary);
+
+        for (htd::index_t child = firstChild[index - 1]; child < firstChild[index]; ++child)
+        {
+            fitnessFunction.combineSummaries(combinedSummary, downwardSummaries[child]);
+        }
+
+        fitnessFunction.computeSummary(graph, decomposition, nodes[index - 1], combinedSummary, downwardSummaries[index - 1]);
+    }
+
+    std::vector<bool> candidateNodes(vertexCount, false);
+
+    for (htd::vertex_t candidate : candidates)
+    {
+        candidateNodes[nodeIndex[candidate]] = true;
+    }
+
+    /* The fitness of the initial root and of each candidate when it is made the root of the decomposition. */
+    std::vector<htd::FitnessEvaluation *> fitnessEvaluations(vertexCount, nullptr);
+
+    std::vector<std::vector<double>> prefixSummaries;
+
+    std::vector<double> suffixSummary;
+
+    std::vector<double> rootSummary;
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        htd::index_t childCount = firstChild[index + 1] - firstChild[index];
+
+        /* The summary of the part of the decomposition above the current node is combined first, followed by the summaries of its children. */
+        prefixSummaries.resize(childCount + 1);
+
+        fitnessFunction.initializeSummary(prefixSummaries[0]);
+
+        if (index > 0)
+        {
+            fitnessFunction.combineSummaries(prefixSummaries[0], upwardSummaries[index]);
+
+            std::vector<double>().swap(upwardSummaries[index]);
+        }
+
+        for (htd::index_t position = 0; position < childCount; ++position)
+        {
+            prefixSummaries[position + 1] = prefixSummaries[position];
+
+            fitnessFunction.combineSummaries(prefixSummaries[position + 1], downwardSummaries[firstChild[index] + position]);
+        }
+
+        if (index == 0 || candidateNodes[index])
+        {
+            fitnessFunction.computeSummary(graph, decomposition, nodes[index], prefixSummaries[childCount], rootSummary);
+
+            fitnessEvaluations[index] = fitnessFunction.evaluateSummary(rootSummary);
+
+            HTD_ASSERT(fitnessEvaluations[index] != nullptr)
+        }
+
+        fitnessFunction.initializeSummary(suffixSummary);
+
+        for (htd::index_t position = childCount; position > 0; --position)
+        {
+            htd::index_t child = firstChild[index] + position - 1;
+
+            combinedSummary = prefixSummaries[position - 1];
+
+            fitnessFunction.combineSummaries(combinedSummary, suffixSummary);
+
+            fitnessFunction.computeSummary(graph, decomposition, nodes[index], combinedSummary, upwardSummaries[child]);
+
+            fitnessFunction.combineSummaries(suffixSummary, downwardSummaries[child]);
+        }
+
+        std::vector<double>().swap(downwardSummaries[index]);
+    }
+
+    htd::vertex_t optimalRoot = initialRoot;
+
+    const htd::FitnessEvaluation * optimalFitness = fitnessEvaluations[0];
+
+    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+    {
+        const htd::FitnessEvaluation * currentFitness = fitnessEvaluations[nodeIndex[*it]];
+
+        if (*currentFitness > *optimalFitness)
+        {
+            optimalFitness = currentFitness;
+
+            optimalRoot = *it;
+        }
+    }
+
+    decomposition.makeRoot(optimalRoot);
+
+    for (htd::FitnessEvaluation * fitnessEvaluation : fitnessEvaluations)
+    {
+        delete fitnessEvaluation;
+    }
+}
+
 void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
 {
     const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
@@ -421,21 +679,11 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimizat
 
     strategy_->selectVertices(decomposition, candidates);
 
-    std::vector<htd::ITreeDecompositionManipulationOperation *> clonedManipulationOperations;
+    std::vector<htd::ITreeDecompositionManipulationOperation *> clonedManipulationOperations = cloneManipulationOperations();
 
-    for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
+    for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
     {
-#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-        htd::ITreeDecompositionManipulationOperation * clone = operation->clone();
-#else
-        htd::ITreeDecompositionManipulationOperation * clone = operation->cloneTreeDecompositionManipulationOperation();
-#endif
-
-        clone->setManagementInstance(managementInstance_);
-
-        clonedManipulationOperations.push_back(clone);
-
-        clone->apply(graph, *localDecomposition, labelingFunctions);
+        operation->apply(graph, *localDecomposition, labelingFunctions);
     }
 
     htd::vertex_t optimalRoot = initialRoot;
@@ -444,54 +692,112 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimizat
 
     HTD_ASSERT(optimalFitness != nullptr)
 
-    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+    delete localDecomposition;
+
+    if (effectiveThreadCount(candidates.size()) > 1)
     {
-        htd::vertex_t vertex = *it;
+        std::vector<htd::FitnessEvaluation *> fitnessEvaluations(candidates.size(), nullptr);
 
-        if (vertex != initialRoot)
+        std::atomic<htd::index_t> nextCandidate(0);
+
+        evaluateInParallel(candidates.size(), [&](void)
         {
-            delete localDecomposition;
+            std::unique_ptr<htd::ITreeDecompositionFitnessFunction> localFitnessFunction(fitnessFunction.clone());
+
+            std::vector<htd::ITreeDecompositionManipulationOperation *> localManipulationOperations = cloneManipulationOperations();
+
+            std::vector<htd::ILabelingFunction *> localLabelingFunctions = cloneLabelingFunctions(labelingFunctions);
+
+            for (htd::index_t index = nextCandidate++; index < candidates.size() && !managementInstance_->isTerminated(); index = nextCandidate++)
+            {
+                htd::vertex_t vertex = candidates[index];
 
+                if (vertex != initialRoot)
+                {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            localDecomposition = decomposition.clone();
+                    std::unique_ptr<htd::IMutableTreeDecomposition> candidateDecomposition(decomposition.clone());
 #else
-            localDecomposition = decomposition.cloneMutableTreeDecomposition();
+                    std::unique_ptr<htd::IMutableTreeDecomposition> candidateDecomposition(decomposition.cloneMutableTreeDecomposition());
 #endif
 
-            localDecomposition->makeRoot(vertex);
+                    candidateDecomposition->makeRoot(vertex);
+
+                    for (const htd::ITreeDecompositionManipulationOperation * operation : localManipulationOperations)
+                    {
+                        operation->apply(graph, *candidateDecomposition, localLabelingFunctions);
+                    }
+
+                    fitnessEvaluations[index] = localFitnessFunction->fitness(graph, *candidateDecomposition);
+
+                    HTD_ASSERT(fitnessEvaluations[index] != nullptr)
+                }
+            }
 
-            for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+            for (htd::ITreeDecompositionManipulationOperation * operation : localManipulationOperations)
             {
-                operation->apply(graph, *localDecomposition, labelingFunctions);
+                delete operation;
             }
 
-            htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, *localDecomposition);
+            for (htd::ILabelingFunction * labelingFunction : localLabelingFunctions)
+            {
+                delete labelingFunction;
+            }
+        });
 
-            HTD_ASSERT(currentFitness != nullptr)
+        selectOptimalCandidate(candidates, fitnessEvaluations, optimalRoot, optimalFitness);
+    }
+    else
+    {
+        for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+        {
+            htd::vertex_t vertex = *it;
 
-            if (*currentFitness > *optimalFitness)
+            if (vertex != initialRoot)
             {
-                delete optimalFitness;
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                localDecomposition = decomposition.clone();
+#else
+                localDecomposition = decomposition.cloneMutableTreeDecomposition();
+#endif
 
-                optimalFitness = currentFitness;
+                localDecomposition->makeRoot(vertex);
 
-                optimalRoot = vertex;
-            }
-            else
-            {
-                delete currentFitness;
+                for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+                {
+                    operation->apply(graph, *localDecomposition, labelingFunctions);
+                }
+
+                htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, *localDecomposition);
+
+                HTD_ASSERT(currentFitness != nullptr)
+
+                if (*currentFitness > *optimalFitness)
+                {
+                    delete optimalFitness;
+
+                    optimalFitness = currentFitness;
+
+                    optimalRoot = vertex;
+                }
+                else
+                {
+                    delete currentFitness;
+                }
+
+                delete localDecomposition;
             }
         }
     }
 
-    delete localDecomposition;
-
     decomposition.makeRoot(optimalRoot);
 
     for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
     {
         operation->apply(graph, decomposition, labelingFunctions);
+    }
 
+    for (htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+    {
         delete operation;
     }
 
@@ -510,21 +816,11 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
 
     htd::vertex_t lastRegularVertex = decomposition.nextVertex() - 1;
 
-    std::vector<htd::ITreeDecompositionManipulationOperation *> clonedManipulationOperations;
+    std::vector<htd::ITreeDecompositionManipulationOperation *> clonedManipulationOperations = cloneManipulationOperations();
 
-    for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
+    for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
     {
-#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-        htd::ITreeDecompositionManipulationOperation * clone = operation->clone();
-#else
-        htd::ITreeDecompositionManipulationOperation * clone = operation->cloneTreeDecompositionManipulationOperation();
-#endif
-
-        clone->setManagementInstance(managementInstance_);
-
-        clonedManipulationOperations.push_back(clone);
-
-        clone->apply(graph, decomposition, labelingFunctions);
+        operation->apply(graph, decomposition, labelingFunctions);
     }
 
     htd::vertex_t optimalRoot = initialRoot;
@@ -536,78 +832,100 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
     std::vector<htd::vertex_t> createdVertices;
     std::vector<htd::vertex_t> removedVertices;
 
-    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+    if (effectiveThreadCount(candidates.size()) > 1)
     {
-        htd::vertex_t vertex = *it;
+        std::vector<htd::FitnessEvaluation *> fitnessEvaluations(candidates.size(), nullptr);
 
-        if (vertex != initialRoot)
+        std::atomic<htd::index_t> nextCandidate(0);
+
+        evaluateInParallel(candidates.size(), [&](void)
         {
-            htd::vertex_t currentVertex = vertex;
+            std::unique_ptr<htd::ITreeDecompositionFitnessFunction> localFitnessFunction(fitnessFunction.clone());
+
+            std::vector<htd::ITreeDecompositionManipulationOperation *> localManipulationOperations = cloneManipulationOperations();
 
-            std::vector<htd::vertex_t> affectedVertices;
+            std::vector<htd::ILabelingFunction *> localLabelingFunctions = cloneLabelingFunctions(labelingFunctions);
 
-            while (!decomposition.isRoot(currentVertex))
+            /* Each worker re-roots its own copy of the decomposition step by step, just like the sequential evaluation does. */
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            std::unique_ptr<htd::IMutableTreeDecomposition> localDecomposition(decomposition.clone());
+#else
+            std::unique_ptr<htd::IMutableTreeDecomposition> localDecomposition(decomposition.cloneMutableTreeDecomposition());
+#endif
+
+            std::vector<htd::vertex_t> localCreatedVertices;
+            std::vector<htd::vertex_t> localRemovedVertices;
+
+            for (htd::index_t index = nextCandidate++; index < candidates.size() && !managementInstance_->isTerminated(); index = nextCandidate++)
             {
-                htd::vertex_t nextVertex = decomposition.parent(currentVertex);
+                htd::vertex_t vertex = candidates[index];
 
-                if (currentVertex <= lastRegularVertex)
+                if (vertex != initialRoot)
                 {
-                    affectedVertices.push_back(currentVertex);
-                }
+                    makeRoot(graph, *localDecomposition, vertex, lastRegularVertex, localManipulationOperations, localLabelingFunctions, localCreatedVertices, localRemovedVertices);
+
+                    fitnessEvaluations[index] = localFitnessFunction->fitness(graph, *localDecomposition);
 
-                currentVertex = nextVertex;
+                    HTD_ASSERT(fitnessEvaluations[index] != nullptr)
+                }
             }
 
-            if (currentVertex <= lastRegularVertex)
+            for (htd::ITreeDecompositionManipulationOperation * operation : localManipulationOperations)
             {
-                affectedVertices.push_back(currentVertex);
+                delete operation;
             }
 
-            for (htd::vertex_t affectedVertex : affectedVertices)
+            for (htd::ILabelingFunction * labelingFunction : localLabelingFunctions)
             {
-                removeCreatedNodes(decomposition, affectedVertex, lastRegularVertex);
+                delete labelingFunction;
             }
+        });
 
-            std::size_t newVertexCount = 0;
-
-            std::size_t oldCreatedVerticesCount = createdVertices.size();
-
-            decomposition.makeRoot(vertex);
+        selectOptimalCandidate(candidates, fitnessEvaluations, optimalRoot, optimalFitness);
+    }
+    else
+    {
+        for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+        {
+            htd::vertex_t vertex = *it;
 
-            for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+            if (vertex != initialRoot)
             {
-                operation->apply(graph, decomposition, affectedVertices, labelingFunctions, createdVertices, removedVertices);
+                makeRoot(graph, decomposition, vertex, lastRegularVertex, clonedManipulationOperations, labelingFunctions, createdVertices, removedVertices);
 
-                newVertexCount = createdVertices.size() - oldCreatedVerticesCount;
+                htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, decomposition);
 
-                if (newVertexCount > 0)
+                HTD_ASSERT(currentFitness != nullptr)
+
+                if (*currentFitness > *optimalFitness)
                 {
-                    affectedVertices.insert(affectedVertices.end(), createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end());
+                    delete optimalFitness;
+
+                    optimalFitness = currentFitness;
 
-                    oldCreatedVerticesCount = createdVertices.size();
+                    optimalRoot = vertex;
+                }
+                else
+                {
+                    delete currentFitness;
                 }
             }
+        }
+    }
 
-            htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, decomposition);
-
-            HTD_ASSERT(currentFitness != nullptr)
-
-            if (*currentFitness > *optimalFitness)
-            {
-                delete optimalFitness;
-
-                optimalFitness = currentFitness;
+    makeRoot(graph, decomposition, optimalRoot, lastRegularVertex, clonedManipulationOperations, labelingFunctions, createdVertices, removedVertices);
 
-                optimalRoot = vertex;
-            }
-            else
-            {
-                delete currentFitness;
-            }
-        }
+    for (htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+    {
+        delete operation;
     }
 
-    htd::vertex_t currentVertex = optimalRoot;
+    delete optimalFitness;
+}
+
+void htd::TreeDecompositionOptimizationOperation::Implementation::makeRoot(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, htd::vertex_t lastRegularVertex, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations, const std::vector<htd::ILabelingFunction *> & labelingFunctions, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
+{
+    htd::vertex_t currentVertex = vertex;
 
     std::vector<htd::vertex_t> affectedVertices;
 
@@ -637,9 +955,9 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
 
     std::size_t oldCreatedVerticesCount = createdVertices.size();
 
-    decomposition.makeRoot(optimalRoot);
+    decomposition.makeRoot(vertex);
 
-    for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+    for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations)
     {
         operation->apply(graph, decomposition, affectedVertices, labelingFunctions, createdVertices, removedVertices);
 
@@ -647,15 +965,106 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
 
         if (newVertexCount > 0)
         {
-            std::copy(createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end(), std::back_inserter(affectedVertices));
+            affectedVertices.insert(affectedVertices.end(), createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end());
 
             oldCreatedVerticesCount = createdVertices.size();
         }
+    }
+}
 
-        delete operation;
+std::vector<htd::ITreeDecompositionManipulationOperation *> htd::TreeDecompositionOptimizationOperation::Implementation::cloneManipulationOperations(void) const
+{
+    std::vector<htd::ITreeDecompositionManipulationOperation *> ret;
+
+    for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        htd::ITreeDecompositionManipulationOperation * clone = operation->clone();
+#else
+        htd::ITreeDecompositionManipulationOperation * clone = operation->cloneTreeDecompositionManipulationOperation();
+#endif
+
+        clone->setManagementInstance(managementInstance_);
+
+        ret.push_back(clone);
     }
 
-    delete optimalFitness;
+    return ret;
+}
+
+std::vector<htd::ILabelingFunction *> htd::TreeDecompositionOptimizationOperation::Implementation::cloneLabelingFunctions(const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    std::vector<htd::ILabelingFunction *> ret;
+
+    for (const htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        htd::ILabelingFunction * clone = labelingFunction->clone();
+#else
+        htd::ILabelingFunction * clone = labelingFunction->cloneLabelingFunction();
+#endif
+
+        clone->setManagementInstance(managementInstance_);
+
+        ret.push_back(clone);
+    }
+
+    return ret;
+}
+
+std::size_t htd::TreeDecompositionOptimizationOperation::Implementation::effectiveThreadCount(std::size_t candidateCount) const
+{
+    std::size_t ret = threadCount_;
+
+    if (ret == 0)
+    {
+        ret = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    return std::max(std::min(ret, candidateCount), (std::size_t)1);
+}
+
+void htd::TreeDecompositionOptimizationOperation::Implementation::evaluateInParallel(std::size_t candidateCount, const std::function<void(void)> & worker) const
+{
+    std::size_t threadCount = effectiveThreadCount(candidateCount);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void htd::TreeDecompositionOptimizationOperation::Implementation::selectOptimalCandidate(const std::vector<htd::vertex_t> & candidates, std::vector<htd::FitnessEvaluation *> & fitnessEvaluations, htd::vertex_t & optimalRoot, htd::FitnessEvaluation *& optimalFitness) const
+{
+    for (htd::index_t index = 0; index < candidates.size(); ++index)
+    {
+        htd::FitnessEvaluation * currentFitness = fitnessEvaluations[index];
+
+        if (currentFitness != nullptr)
+        {
+            if (*currentFitness > *optimalFitness)
+            {
+                delete optimalFitness;
+
+                optimalFitness = currentFitness;
+
+                optimalRoot = candidates[index];
+            }
+            else
+            {
+                delete currentFitness;
+            }
+        }
+    }
 }
 
 bool htd::TreeDecompositionOptimizationOperation::Implementation::isSafeOperation(const htd::ITreeDecompositionManipulationOperation & manipulationOperation) const
@@ -752,9 +1161,11 @@ htd::TreeDecompositionOptimizationOperation * htd::TreeDecompositionOptimization
     }
     else
     {
-        ret = new htd::TreeDecompositionOptimizationOperation(managementInstance(), implementation_->fitnessFunction_->clone());
+        ret = new htd::TreeDecompositionOptimizationOperation(managementInstance(), implementation_->fitnessFunction_->clone(), implementation_->enforceNaiveOptimization_);
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     for (const htd::ITreeDecompositionManipulationOperation * manipulationOperation : implementation_->manipulationOperations_)
     {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
@@ -30,17 +30,13 @@
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
-#include <htd/IMutableGraph.hpp>
-#include <htd/IMutableMultiHypergraph.hpp>
-#include <htd/GraphFactory.hpp>
-#include <htd/MultiHypergraphFactory.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
-#include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
-#include <htd/MinFillOrderingAlgorithm.hpp>
 
 #include <algorithm>
+#include <bitset>
+#include <cstdint>
 #include <numeric>
 #include <stack>
 #include <unordered_map>
@@ -478,39 +474,37 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
             }
 
             /**
-             *  Remove an edge from the graph.
+             *  Remove a set of fill edges from the graph.
              *
-             *  @param[in] vertex1      The first endpoint of the edge.
-             *  @param[in] vertex2      The second endpoint of the edge.
+             *  @param[in] edges        The fill edges which shall be removed, sorted in ascending order.
              *  @param[in] activeVertex The currently investigated vertex.
              */
-            void removeFillEdge(htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t activeVertex)
+            void removeFillEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges, htd::vertex_t activeVertex)
             {
-                HTD_ASSERT(vertex1 < names_.size() && vertex2 < names_.size());
+                HTD_ASSERT(activeVertex < names_.size());
 
-                std::vector<htd::vertex_t> & neighborhood1 = neighborhood_[vertex1];
-                std::vector<htd::vertex_t> & neighborhood2 = neighborhood_[vertex2];
+                for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+                {
+                    HTD_ASSERT(edge.first < names_.size() && edge.second < names_.size());
 
-                auto position = std::lower_bound(neighborhood1.begin(), neighborhood1.end(), vertex2);
+                    std::vector<htd::vertex_t> & neighborhood1 = neighborhood_[edge.first];
+                    std::vector<htd::vertex_t> & neighborhood2 = neighborhood_[edge.second];
 
-                if (position != neighborhood1.end() && *position == vertex2)
-                {
-                    neighborhood1.erase(position);
-                    neighborhood2.erase(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1));
+                    auto position = std::lower_bound(neighborhood1.begin(), neighborhood1.end(), edge.second);
+
+                    if (position != neighborhood1.end() && *position == edge.second)
+                    {
+                        neighborhood1.erase(position);
+                        neighborhood2.erase(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), edge.first));
+                    }
                 }
 
                 std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & relevantEdges = fillEdges_[activeVertex];
 
-                auto edgePosition =
-                    std::find_if(relevantEdges.begin(), relevantEdges.end(), [&](const std::pair<htd::vertex_t, htd::vertex_t> & currentFillEdge)
-                    {
-                       return currentFillEdge.first == vertex1 && currentFillEdge.second == vertex2;
-                    });
-
-                if (edgePosition != relevantEdges.end())
+                relevantEdges.erase(std::remove_if(relevantEdges.begin(), relevantEdges.end(), [&](const std::pair<htd::vertex_t, htd::vertex_t> & currentFillEdge)
                 {
-                    relevantEdges.erase(edgePosition);
-                }
+                    return std::binary_search(edges.begin(), edges.end(), currentFillEdge);
+                }), relevantEdges.end());
             }
 
             /**
@@ -718,31 +712,80 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                     ++position;
                 }
 
+                /* The elimination game only operates on the not yet eliminated part of each neighborhood. */
+                std::vector<std::vector<htd::vertex_t>> remainingNeighborhood(neighborhood_);
+
+                /* The reverse direction of each fill edge is collected first and merged as soon as the neighborhood is accessed. */
+                std::vector<std::vector<htd::vertex_t>> pendingNeighbors(neighborhood_.size());
+
+                /* For each vertex, the eliminated neighbor whose remaining neighborhood (without the vertex itself) is the largest known clique in its neighborhood. */
+                std::vector<htd::vertex_t> cliqueNeighbor(neighborhood_.size());
+
+                std::vector<std::size_t> cliqueSize(neighborhood_.size(), 0);
+
+                std::vector<htd::index_t> cliqueMarker(neighborhood_.size(), 0);
+
+                std::vector<htd::vertex_t> unknownNeighbors;
+
+                std::vector<htd::vertex_t> missingNeighbors;
+
                 for (htd::vertex_t vertex : eliminationSequence)
                 {
                     htd::vertex_t internalVertex = internalNames_.at(vertex);
 
                     htd::index_t currentPosition = positions_[internalVertex];
 
-                    std::vector<htd::vertex_t> relevantNeighbors;
+                    mergePendingNeighbors(internalVertex, remainingNeighborhood, pendingNeighbors);
 
-                    for (htd::vertex_t neighbor : neighborhood_[internalVertex])
+                    const std::vector<htd::vertex_t> & relevantNeighbors = remainingNeighborhood[internalVertex];
+
+                    if (relevantNeighbors.size() > 1)
                     {
-                        if (positions_[neighbor] > currentPosition)
+                        unknownNeighbors.clear();
+
+                        if (cliqueSize[internalVertex] > 0)
                         {
-                            relevantNeighbors.push_back(neighbor);
+                            for (htd::vertex_t neighbor : remainingNeighborhood[cliqueNeighbor[internalVertex]])
+                            {
+                                cliqueMarker[neighbor] = currentPosition + 1;
+                            }
+
+                            for (htd::vertex_t neighbor : relevantNeighbors)
+                            {
+                                if (cliqueMarker[neighbor] != currentPosition + 1)
+                                {
+                                    unknownNeighbors.push_back(neighbor);
+                                }
+                            }
+                        }
+                        else
+                        {
+                            unknownNeighbors = relevantNeighbors;
                         }
-                    }
 
-                    if (relevantNeighbors.size() > 1)
-                    {
                         for (auto it = relevantNeighbors.begin(); it != relevantNeighbors.end(); ++it)
                         {
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
+                            mergePendingNeighbors(*it, remainingNeighborhood, pendingNeighbors);
+
+                            std::vector<htd::vertex_t> & currentNeighborhood = remainingNeighborhood[*it];
 
-                            std::vector<htd::vertex_t> missingNeighbors;
+                            missingNeighbors.clear();
 
-                            std::set_difference(it + 1, relevantNeighbors.end(), currentNeighborhood.begin(), currentNeighborhood.end(), std::back_inserter(missingNeighbors));
+                            if (cliqueSize[internalVertex] > 0 && cliqueMarker[*it] == currentPosition + 1)
+                            {
+                                /* Members of the known clique are adjacent to each other, hence only the remaining neighbors have to be checked. */
+                                for (auto it2 = std::upper_bound(unknownNeighbors.begin(), unknownNeighbors.end(), *it); it2 != unknownNeighbors.end(); ++it2)
+                                {
+                                    if (!std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), *it2))
+                                    {
+                                        missingNeighbors.push_back(*it2);
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                std::set_difference(it + 1, relevantNeighbors.end(), currentNeighborhood.begin(), currentNeighborhood.end(), std::back_inserter(missingNeighbors));
+                            }
 
                             if (!missingNeighbors.empty())
                             {
@@ -752,13 +795,98 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                                 {
                                     fillEdges_[internalVertex].emplace_back(*it, missingNeighbor);
 
-                                    std::vector<htd::vertex_t> & currentNeighborhood2 = neighborhood_[missingNeighbor];
-
-                                    currentNeighborhood2.insert(std::lower_bound(currentNeighborhood2.begin(), currentNeighborhood2.end(), *it), *it);
+                                    pendingNeighbors[missingNeighbor].push_back(*it);
                                 }
                             }
                         }
                     }
+
+                    htd::vertex_t parent = internalVertex;
+
+                    for (htd::vertex_t neighbor : relevantNeighbors)
+                    {
+                        std::vector<htd::vertex_t> & currentNeighborhood = remainingNeighborhood[neighbor];
+
+                        currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), internalVertex));
+
+                        if (parent == internalVertex || positions_[neighbor] < positions_[parent])
+                        {
+                            parent = neighbor;
+                        }
+                    }
+
+                    if (cliqueSize[internalVertex] > 0)
+                    {
+                        std::vector<htd::vertex_t>().swap(remainingNeighborhood[cliqueNeighbor[internalVertex]]);
+                    }
+
+                    /* The remaining neighborhood of an eliminated vertex is a clique, its part without the parent stays available for the parent. */
+                    if (relevantNeighbors.size() > 1 && relevantNeighbors.size() - 1 > cliqueSize[parent])
+                    {
+                        if (cliqueSize[parent] > 0)
+                        {
+                            std::vector<htd::vertex_t>().swap(remainingNeighborhood[cliqueNeighbor[parent]]);
+                        }
+
+                        remainingNeighborhood[internalVertex].erase(std::lower_bound(relevantNeighbors.begin(), relevantNeighbors.end(), parent));
+
+                        cliqueNeighbor[parent] = internalVertex;
+
+                        cliqueSize[parent] = relevantNeighbors.size();
+                    }
+                    else
+                    {
+                        std::vector<htd::vertex_t>().swap(remainingNeighborhood[internalVertex]);
+                    }
+                }
+
+                for (std::vector<htd::vertex_t> & currentPendingNeighbors : pendingNeighbors)
+                {
+                    currentPendingNeighbors.clear();
+                }
+
+                for (const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & currentFillEdges : fillEdges_)
+                {
+                    for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : currentFillEdges)
+                    {
+                        pendingNeighbors[fillEdge.first].push_back(fillEdge.second);
+                        pendingNeighbors[fillEdge.second].push_back(fillEdge.first);
+                    }
+                }
+
+                for (htd::vertex_t vertex = 0; vertex < neighborhood_.size(); ++vertex)
+                {
+                    std::vector<htd::vertex_t> & currentPendingNeighbors = pendingNeighbors[vertex];
+
+                    if (!currentPendingNeighbors.empty())
+                    {
+                        std::sort(currentPendingNeighbors.begin(), currentPendingNeighbors.end());
+
+                        htd::inplace_merge(neighborhood_[vertex], currentPendingNeighbors);
+
+                        std::vector<htd::vertex_t>().swap(currentPendingNeighbors);
+                    }
+                }
+            }
+
+            /**
+             *  Merge the pending neighbors of a vertex into its remaining neighborhood.
+             *
+             *  @param[in] vertex                       The vertex.
+             *  @param[in,out] remainingNeighborhood    The not yet eliminated neighbors of each vertex.
+             *  @param[in,out] pendingNeighbors         The pending neighbors of each vertex.
+             */
+            static void mergePendingNeighbors(htd::vertex_t vertex, std::vector<std::vector<htd::vertex_t>> & remainingNeighborhood, std::vector<std::vector<htd::vertex_t>> & pendingNeighbors)
+            {
+                std::vector<htd::vertex_t> & currentPendingNeighbors = pendingNeighbors[vertex];
+
+                if (!currentPendingNeighbors.empty())
+                {
+                    std::sort(currentPendingNeighbors.begin(), currentPendingNeighbors.end());
+
+                    htd::inplace_merge(remainingNeighborhood[vertex], currentPendingNeighbors);
+
+                    currentPendingNeighbors.clear();
                 }
             }
     };
@@ -766,23 +894,49 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     /**
      *  Check whether the given fill edge is a candidate for removal from the given triangulated graph.
      *
-     *  @param[in] vertex1      The first endpoint of the edge.
-     *  @param[in] vertex2      The second endpoint of the edge.
-     *  @param[in] activeVertex The currently investigated vertex.
-     *  @param[in] position     The position of the currently investigated vertex within the elimination ordering.
-     *  @param[in] graph        The triangulated graph.
+     *  A fill edge is a candidate for removal if each common neighbor of its endpoints which is eliminated after the
+     *  currently investigated vertex is adjacent to the currently investigated vertex.
+     *
+     *  @param[in] vertex1          The first endpoint of the edge.
+     *  @param[in] vertex2          The second endpoint of the edge.
+     *  @param[in] position         The position of the currently investigated vertex within the elimination ordering.
+     *  @param[in] activeNeighbors  A flag for each vertex indicating whether the vertex is adjacent to the currently investigated vertex.
+     *  @param[in] graph            The triangulated graph.
      *
      *  @return True if the given fill edge is a candidate for removal from the given triangulated graph, false otherwise.
      */
-    bool isCandidateEdge(htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t activeVertex, htd::index_t position, const TriangulatedGraph & graph) const
+    static bool isCandidateEdge(htd::vertex_t vertex1, htd::vertex_t vertex2, htd::index_t position, const std::vector<bool> & activeNeighbors, const TriangulatedGraph & graph)
     {
         bool ret = true;
 
-        for (htd::vertex_t neighbor : graph.neighborhood(vertex1))
+        const std::vector<htd::vertex_t> & neighborhood1 = graph.neighborhood(vertex1);
+        const std::vector<htd::vertex_t> & neighborhood2 = graph.neighborhood(vertex2);
+
+        auto first1 = neighborhood1.begin();
+        auto first2 = neighborhood2.begin();
+
+        auto last1 = neighborhood1.end();
+        auto last2 = neighborhood2.end();
+
+        while (ret && first1 != last1 && first2 != last2)
         {
-            if (graph.position(neighbor) > position && graph.isNeighbor(vertex2, neighbor) && !graph.isNeighbor(activeVertex, neighbor))
+            if (*first1 < *first2)
+            {
+                ++first1;
+            }
+            else if (*first2 < *first1)
+            {
+                ++first2;
+            }
+            else
             {
-                ret = false;
+                if (graph.position(*first1) > position && !activeNeighbors[*first1])
+                {
+                    ret = false;
+                }
+
+                ++first1;
+                ++first2;
             }
         }
 
@@ -790,42 +944,343 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     }
 
     /**
-     *  Compute the set of fill edges which can be safely removed.
+     *  Reusable data structure for computing a minimal triangulation of the local graph of a vertex.
      *
-     *  @param[in] graph                    The input graph.
-     *  @param[in] candidateFillEdges       The fill edges which shall be checked.
-     *  @param[in] vertices                 The actual identifier (as used for the candidate fill edges) of the vertices of the input graph.
-     *  @param[in,out] redundantFillEdges   The vector of redundant fill edges which shall be updated.
+     *  The local graph of a vertex is the complete graph on the endpoints of its candidate fill edges without the
+     *  candidate fill edges themselves. Its adjacency matrix is stored as a bit matrix and the minimal triangulation
+     *  is computed by the algorithm MCS-M, i.e., the fill edges of the minimal triangulation are exactly those
+     *  candidate fill edges which cannot be removed from the triangulated graph.
      */
-    void computeRedundantFillEdges(const htd::IGraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & candidateFillEdges, const std::vector<htd::vertex_t> & vertices, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & redundantFillEdges) const
+    class LocalTriangulation
     {
-        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(managementInstance_);
+        public:
+            /**
+             *  Constructor for a local triangulation.
+             */
+            LocalTriangulation(void) : size_(0), wordCount_(0), adjacency_(), unnumbered_(), reached_(), labels_(), reachable_(), pool_(), targets_()
+            {
+
+            }
 
-        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+            /**
+             *  Destructor for a local triangulation.
+             */
+            virtual ~LocalTriangulation()
+            {
 
-        TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
+            }
 
-        delete ordering;
+            /**
+             *  Reset the data structure to the complete graph with the given number of vertices.
+             *
+             *  @param[in] size The number of vertices of the local graph.
+             */
+            void reset(std::size_t size)
+            {
+                size_ = size;
 
-        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+                wordCount_ = (size + 63) >> 6;
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
-        {
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
+                adjacency_.assign(size * wordCount_, 0);
+
+                for (htd::index_t vertex = 0; vertex < size; ++vertex)
+                {
+                    std::uint64_t * row = &(adjacency_[vertex * wordCount_]);
+
+                    std::fill(row, row + (size >> 6), ~((std::uint64_t)0));
+
+                    if ((size & 63) != 0)
+                    {
+                        row[size >> 6] = (((std::uint64_t)1) << (size & 63)) - 1;
+                    }
+
+                    row[vertex >> 6] &= ~(((std::uint64_t)1) << (vertex & 63));
+                }
+            }
+
+            /**
+             *  Remove an edge from the local graph.
+             *
+             *  @param[in] vertex1  The first endpoint of the edge.
+             *  @param[in] vertex2  The second endpoint of the edge.
+             */
+            void removeEdge(htd::index_t vertex1, htd::index_t vertex2)
+            {
+                adjacency_[vertex1 * wordCount_ + (vertex2 >> 6)] &= ~(((std::uint64_t)1) << (vertex2 & 63));
+                adjacency_[vertex2 * wordCount_ + (vertex1 >> 6)] &= ~(((std::uint64_t)1) << (vertex1 & 63));
+            }
+
+            /**
+             *  Check whether two vertices of the local graph are adjacent.
+             *
+             *  @param[in] vertex1  The first vertex.
+             *  @param[in] vertex2  The second vertex.
+             *
+             *  @return True if the two vertices are adjacent, false otherwise.
+             */
+            bool isEdge(htd::index_t vertex1, htd::index_t vertex2) const
+            {
+                return ((adjacency_[vertex1 * wordCount_ + (vertex2 >> 6)] >> (vertex2 & 63)) & 1) != 0;
+            }
+
+            /**
+             *  Compute a minimal triangulation of the local graph.
+             *
+             *  @param[out] fillEdges   The vector to which the fill edges of the minimal triangulation shall be appended. Each fill edge is stored as ordered pair of local vertices.
+             */
+            void triangulate(std::vector<std::pair<htd::index_t, htd::index_t>> & fillEdges)
+            {
+                unnumbered_.assign(wordCount_, ~((std::uint64_t)0));
+
+                if ((size_ & 63) != 0)
+                {
+                    unnumbered_[size_ >> 6] = (((std::uint64_t)1) << (size_ & 63)) - 1;
+                }
+
+                labels_.assign(size_, 0);
+
+                if (reachable_.size() < size_)
+                {
+                    reachable_.resize(size_);
+                }
+
+                for (std::size_t remainder = size_; remainder > 0; --remainder)
+                {
+                    std::size_t maximumLabel = 0;
+
+                    pool_.clear();
+
+                    for (htd::index_t vertex = 0; vertex < size_; ++vertex)
+                    {
+                        if (isUnnumbered(vertex))
+                        {
+                            if (labels_[vertex] > maximumLabel)
+                            {
+                                maximumLabel = labels_[vertex];
+
+                                pool_.clear();
+                            }
+
+                            if (labels_[vertex] == maximumLabel)
+                            {
+                                pool_.push_back(vertex);
+                            }
+                        }
+                    }
+
+                    htd::index_t selectedVertex = htd::selectRandomElement<htd::index_t>(pool_);
+
+                    unnumbered_[selectedVertex >> 6] &= ~(((std::uint64_t)1) << (selectedVertex & 63));
+
+                    reached_.assign(unnumbered_.begin(), unnumbered_.end());
+
+                    targets_.clear();
+
+                    /* The neighbors of the selected vertex are reached directly, all other vertices are reached via paths whose inner vertices have smaller labels. */
+                    visitNeighbors(selectedVertex, [&](htd::index_t neighbor)
+                    {
+                        targets_.push_back(neighbor);
+
+                        reachable_[labels_[neighbor]].push_back(neighbor);
+                    });
+
+                    for (std::size_t label = 0; label <= maximumLabel; ++label)
+                    {
+                        std::vector<htd::index_t> & currentlyReachable = reachable_[label];
+
+                        while (!currentlyReachable.empty())
+                        {
+                            htd::index_t reachedVertex = currentlyReachable.back();
+
+                            currentlyReachable.pop_back();
+
+                            visitNeighbors(reachedVertex, [&](htd::index_t neighbor)
+                            {
+                                if (labels_[neighbor] > label)
+                                {
+                                    targets_.push_back(neighbor);
+
+                                    reachable_[labels_[neighbor]].push_back(neighbor);
+                                }
+                                else
+                                {
+                                    currentlyReachable.push_back(neighbor);
+                                }
+                            });
+                        }
+                    }
+
+                    for (htd::index_t target : targets_)
+                    {
+                        ++labels_[target];
+
+                        if (!isEdge(selectedVertex, target))
+                        {
+                            fillEdges.emplace_back(std::min(selectedVertex, target), std::max(selectedVertex, target));
+                        }
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  The number of vertices of the local graph.
+             */
+            std::size_t size_;
+
+            /**
+             *  The number of 64-bit words of each row of the bit matrix.
+             */
+            std::size_t wordCount_;
+
+            /**
+             *  The adjacency matrix of the local graph.
+             */
+            std::vector<std::uint64_t> adjacency_;
+
+            /**
+             *  The bit vector of the vertices which were not numbered yet.
+             */
+            std::vector<std::uint64_t> unnumbered_;
+
+            /**
+             *  The bit vector of the unnumbered vertices which were not reached yet during the current search.
+             */
+            std::vector<std::uint64_t> reached_;
+
+            /**
+             *  The label of each vertex.
+             */
+            std::vector<std::size_t> labels_;
+
+            /**
+             *  The vertices which were reached during the current search, grouped by the maximum label of the path via which they were reached.
+             */
+            std::vector<std::vector<htd::index_t>> reachable_;
+
+            /**
+             *  The unnumbered vertices with maximum label.
+             */
+            std::vector<htd::index_t> pool_;
+
+            /**
+             *  The vertices whose label is incremented after the current search.
+             */
+            std::vector<htd::index_t> targets_;
+
+            /**
+             *  Check whether the given vertex is not numbered yet.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if the given vertex is not numbered yet, false otherwise.
+             */
+            bool isUnnumbered(htd::index_t vertex) const
+            {
+                return ((unnumbered_[vertex >> 6] >> (vertex & 63)) & 1) != 0;
+            }
+
+            /**
+             *  Call the given function for each unnumbered neighbor of the given vertex which was not reached yet and mark the neighbor as reached.
+             *
+             *  @param[in] vertex   The vertex.
+             *  @param[in] function The function which shall be called.
+             */
+            template <typename Function>
+            void visitNeighbors(htd::index_t vertex, const Function & function)
             {
-                fillEdges.push_back(std::make_pair(vertices[fillEdge.first], vertices[fillEdge.second]));
+                const std::uint64_t * row = &(adjacency_[vertex * wordCount_]);
+
+                for (htd::index_t word = 0; word < wordCount_; ++word)
+                {
+                    /* The bit vector 'reached_' stores the unnumbered vertices which were not reached yet. */
+                    std::uint64_t bits = row[word] & reached_[word];
+
+                    reached_[word] &= ~bits;
+
+                    while (bits != 0)
+                    {
+                        std::uint64_t lowestBit = bits & (~bits + 1);
+
+                        function((word << 6) + std::bitset<64>(lowestBit - 1).count());
+
+                        bits ^= lowestBit;
+                    }
+                }
             }
+    };
+
+    /**
+     *  Compute a perfect elimination ordering of the given triangulated graph by the algorithm maximum cardinality search.
+     *
+     *  @param[in] graph    The triangulated graph.
+     *
+     *  @return A perfect elimination ordering of the given triangulated graph consisting of the actual identifiers of the vertices.
+     */
+    static std::vector<htd::vertex_t> computePerfectEliminationOrdering(const TriangulatedGraph & graph)
+    {
+        std::size_t size = graph.vertexCount();
+
+        std::vector<htd::vertex_t> ret(size);
+
+        std::vector<std::size_t> labels(size, 0);
+
+        std::vector<bool> numbered(size, false);
+
+        std::vector<std::vector<htd::vertex_t>> buckets(size + 1);
+
+        for (htd::vertex_t vertex = size; vertex > 0; --vertex)
+        {
+            buckets[0].push_back(vertex - 1);
         }
 
-        std::sort(fillEdges.begin(), fillEdges.end());
+        std::size_t maximumLabel = 0;
 
-        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : candidateFillEdges)
+        for (std::size_t remainder = size; remainder > 0; --remainder)
         {
-            if (!std::binary_search(fillEdges.begin(), fillEdges.end(), fillEdge))
+            htd::vertex_t selectedVertex = 0;
+
+            bool found = false;
+
+            /* Outdated bucket entries of numbered vertices and vertices whose label increased are skipped lazily. */
+            while (!found)
             {
-                redundantFillEdges.push_back(fillEdge);
+                std::vector<htd::vertex_t> & bucket = buckets[maximumLabel];
+
+                if (bucket.empty())
+                {
+                    --maximumLabel;
+                }
+                else
+                {
+                    selectedVertex = bucket.back();
+
+                    bucket.pop_back();
+
+                    found = !numbered[selectedVertex] && labels[selectedVertex] == maximumLabel;
+                }
+            }
+
+            numbered[selectedVertex] = true;
+
+            ret[remainder - 1] = graph.vertexName(selectedVertex);
+
+            for (htd::vertex_t neighbor : graph.neighborhood(selectedVertex))
+            {
+                if (!numbered[neighbor])
+                {
+                    std::size_t & label = labels[neighbor];
+
+                    ++label;
+
+                    buckets[label].push_back(neighbor);
+
+                    maximumLabel = std::max(maximumLabel, label);
+                }
             }
         }
+
+        return ret;
     }
 };
 
@@ -864,6 +1319,20 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
     htd::TriangulationMinimizationOrderingAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
 
+    htd::TriangulationMinimizationOrderingAlgorithm::Implementation::LocalTriangulation localTriangulation;
+
+    std::vector<bool> activeNeighbors(triangulatedGraph.vertexCount(), false);
+
+    std::vector<htd::vertex_t> relevantVertices;
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> candidateEdges;
+
+    std::vector<std::pair<htd::index_t, htd::index_t>> localFillEdges;
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> requiredFillEdges;
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> redundantFillEdges;
+
     htd::index_t position = ordering->sequence().size() - 1;
 
     bool fillEdgeRemoved = false;
@@ -874,65 +1343,81 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
         const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges = triangulatedGraph.fillEdges(vertex);
 
-        std::unordered_set<htd::vertex_t> candidateVertices;
+        if (!fillEdges.empty())
+        {
+            const std::vector<htd::vertex_t> & currentNeighborhood = triangulatedGraph.neighborhood(vertex);
+
+            for (htd::vertex_t neighbor : currentNeighborhood)
+            {
+                activeNeighbors[neighbor] = true;
+            }
 
-        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> candidateEdges;
+            candidateEdges.clear();
 
-        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
-        {
-            if (implementation_->isCandidateEdge(fillEdge.first, fillEdge.second, vertex, position, triangulatedGraph))
+            relevantVertices.clear();
+
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
             {
-                candidateEdges.push_back(fillEdge);
+                if (implementation_->isCandidateEdge(fillEdge.first, fillEdge.second, position, activeNeighbors, triangulatedGraph))
+                {
+                    candidateEdges.push_back(fillEdge);
 
-                candidateVertices.insert(fillEdge.first);
-                candidateVertices.insert(fillEdge.second);
+                    relevantVertices.push_back(fillEdge.first);
+                    relevantVertices.push_back(fillEdge.second);
+                }
             }
-        }
 
-        if (!candidateEdges.empty())
-        {
-            std::vector<htd::vertex_t> relevantVertices(candidateVertices.begin(), candidateVertices.end());
+            for (htd::vertex_t neighbor : currentNeighborhood)
+            {
+                activeNeighbors[neighbor] = false;
+            }
 
-            std::sort(relevantVertices.begin(), relevantVertices.end());
+            if (!candidateEdges.empty())
+            {
+                std::sort(relevantVertices.begin(), relevantVertices.end());
 
-            htd::IMutableGraph * localGraph = implementation_->managementInstance_->graphFactory().createInstance(relevantVertices.size());
+                relevantVertices.erase(std::unique(relevantVertices.begin(), relevantVertices.end()), relevantVertices.end());
 
-            std::unordered_map<htd::vertex_t, htd::vertex_t> localMapping;
+                localTriangulation.reset(relevantVertices.size());
+
+                for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
+                {
+                    localTriangulation.removeEdge(std::lower_bound(relevantVertices.begin(), relevantVertices.end(), candidate.first) - relevantVertices.begin(),
+                                                  std::lower_bound(relevantVertices.begin(), relevantVertices.end(), candidate.second) - relevantVertices.begin());
+                }
 
-            htd::index_t localPosition = 1;
+                localFillEdges.clear();
 
-            for (htd::vertex_t relevantVertex : relevantVertices)
-            {
-                localMapping.emplace(relevantVertex, localPosition);
+                localTriangulation.triangulate(localFillEdges);
 
-                ++localPosition;
-            }
+                requiredFillEdges.clear();
 
-            for (auto it2 = relevantVertices.begin(); it2 != relevantVertices.end(); ++it2)
-            {
-                for (auto it3 = it2 + 1; it3 != relevantVertices.end(); ++it3)
+                for (const std::pair<htd::index_t, htd::index_t> & localFillEdge : localFillEdges)
                 {
-                    localGraph->addEdge(localMapping.at(*it2), localMapping.at(*it3));
+                    requiredFillEdges.emplace_back(relevantVertices[localFillEdge.first], relevantVertices[localFillEdge.second]);
                 }
-            }
 
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
-            {
-                localGraph->removeEdge(localMapping.at(candidate.first), localMapping.at(candidate.second));
-            }
+                std::sort(requiredFillEdges.begin(), requiredFillEdges.end());
 
-            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> redundantFillEdges;
+                redundantFillEdges.clear();
 
-            implementation_->computeRedundantFillEdges(*localGraph, candidateEdges, relevantVertices, redundantFillEdges);
+                for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
+                {
+                    if (!std::binary_search(requiredFillEdges.begin(), requiredFillEdges.end(), candidate))
+                    {
+                        redundantFillEdges.push_back(candidate);
+                    }
+                }
 
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : redundantFillEdges)
-            {
-                triangulatedGraph.removeFillEdge(candidate.first, candidate.second, vertex);
+                if (!redundantFillEdges.empty())
+                {
+                    std::sort(redundantFillEdges.begin(), redundantFillEdges.end());
 
-                fillEdgeRemoved = true;
-            }
+                    triangulatedGraph.removeFillEdges(redundantFillEdges, vertex);
 
-            delete localGraph;
+                    fillEdgeRemoved = true;
+                }
+            }
         }
 
         --position;
@@ -944,24 +1429,8 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
     {
         delete ordering;
 
-        htd::IMutableMultiHypergraph * optimizedGraph = implementation_->managementInstance_->multiHypergraphFactory().createInstance(graph);
-
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
-        {
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
-            {
-                htd::vertex_t vertex1 = triangulatedGraph.vertexName(fillEdge.first);
-                htd::vertex_t vertex2 = triangulatedGraph.vertexName(fillEdge.second);
-
-                optimizedGraph->addEdge(vertex1, vertex2);
-            }
-        }
-
-        htd::MinFillOrderingAlgorithm finalOrderingAlgorithm(implementation_->managementInstance_);
-
-        ret = finalOrderingAlgorithm.computeOrdering(*optimizedGraph);
-
-        delete optimizedGraph;
+        /* The remaining fill edges form a minimal triangulation of the input graph, hence each of its perfect elimination orderings induces exactly these fill edges. */
+        ret = new htd::VertexOrdering(htd::TriangulationMinimizationOrderingAlgorithm::Implementation::computePerfectEliminationOrdering(triangulatedGraph), 1);
     }
     else
     {
@@ -30,9 +30,16 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/Helpers.hpp>
 
-#include <cstdarg>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::WidthMinimizingTreeDecompositionAlgorithm.
@@ -45,7 +52,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1)
     {
 
     }
@@ -57,7 +64,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
      */
     Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1)
     {
 
     }
@@ -67,7 +74,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), threadCount_(original.threadCount_)
     {
 
     }
@@ -96,6 +103,170 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  The maximum number of iterations without improvement after which the algorithm shall terminate.
      */
     std::size_t nonImprovementLimit_;
+
+    /**
+     *  The number of worker threads which shall be used to perform the iterations.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Perform the iterations on multiple worker threads and return the decomposition of lowest width.
+     *
+     *  The results of the iterations are committed in the order of their indices, so the returned decomposition,
+     *  the invocations of the progress callback and the point at which the non-improvement limit stops the search
+     *  are the same as if the iterations were performed one after another.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked for each improved decomposition.
+     *  @param[in] maxBagSize               A function returning the current upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] threadCount              The number of worker threads which shall be used.
+     *
+     *  @return The decomposition of lowest width found by one of the workers or nullptr, if no decomposition respecting the upper bound was found.
+     */
+    htd::ITreeDecomposition * computeImprovedDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                     const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                     const std::function<std::size_t(void)> & maxBagSize, std::size_t threadCount) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        /* The bound is only tightened by committed iterations. It therefore never falls below the bound the sequential order would apply, so pruning cannot hide an improvement. */
+        std::atomic<std::size_t> currentBound(maxBagSize());
+
+        std::atomic<htd::index_t> nextIteration(0);
+
+        std::atomic<htd::index_t> iterationLimit(iterationCount_ == 0 ? (htd::index_t)-1 : std::max(iterationCount_, (std::size_t)1));
+
+        std::mutex resultMutex;
+
+        std::condition_variable resultCondition;
+
+        std::map<htd::index_t, htd::ITreeDecomposition *> pendingResults;
+
+        htd::index_t nextCommittedIteration = 0;
+
+        std::size_t nonImprovementCount = 0;
+
+        htd::ITreeDecomposition * ret = nullptr;
+
+        /* Each iteration re-seeds the random number generator of its thread with a seed derived from its index, so its result does not depend on the thread performing it. */
+        std::uint_fast32_t randomSeed = htd::randomNumberGenerator()();
+
+        auto worker = [&]()
+        {
+            std::unique_ptr<htd::BucketEliminationTreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+            for (htd::index_t iteration = nextIteration++; iteration < iterationLimit.load() && !managementInstance.isTerminated(); iteration = nextIteration++)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(resultMutex);
+
+                    /* Wait until the iteration lies within threadCount iterations of the committed prefix, which bounds the number of parked decompositions. */
+                    resultCondition.wait(lock, [&]() { return iteration < nextCommittedIteration + threadCount || iteration >= iterationLimit.load() || managementInstance.isTerminated(); });
+                }
+
+                if (iteration >= iterationLimit.load() || managementInstance.isTerminated())
+                {
+                    break;
+                }
+
+                htd::seedRandomNumberGenerator(htd::deriveRandomSeed(randomSeed, iteration));
+
+                std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+                for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+                {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                    clonedManipulationOperations.push_back(operation->clone());
+#else
+                    clonedManipulationOperations.push_back(operation->cloneDecompositionManipulationOperation());
+#endif
+                }
+
+                htd::ITreeDecomposition * currentDecomposition = algorithm->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, [&]() { return std::min(currentBound.load(), maxBagSize()); }, 1).first;
+
+                if (managementInstance.isTerminated())
+                {
+                    delete currentDecomposition;
+
+                    break;
+                }
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+
+                pendingResults[iteration] = currentDecomposition;
+
+                for (auto position = pendingResults.begin();
+                     position != pendingResults.end() && position->first == nextCommittedIteration && nextCommittedIteration < iterationLimit.load();
+                     position = pendingResults.erase(position))
+                {
+                    currentDecomposition = position->second;
+
+                    if (currentDecomposition != nullptr && (ret == nullptr || currentDecomposition->maximumBagSize() < ret->maximumBagSize()))
+                    {
+                        std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
+
+                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+
+                        delete ret;
+
+                        ret = currentDecomposition;
+
+                        currentBound = currentMaxBagSize > 0 ? currentMaxBagSize - 1 : 0;
+
+                        nonImprovementCount = 0;
+                    }
+                    else
+                    {
+                        delete currentDecomposition;
+
+                        ++nonImprovementCount;
+                    }
+
+                    ++nextCommittedIteration;
+
+                    if (nonImprovementCount > nonImprovementLimit_)
+                    {
+                        iterationLimit = nextCommittedIteration;
+                    }
+                }
+
+                resultCondition.notify_all();
+            }
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+
+            resultCondition.notify_all();
+        };
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(worker);
+        }
+
+        {
+            htd::RandomNumberGeneratorGuard randomNumberGeneratorGuard;
+
+            worker();
+        }
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+
+        for (auto & pendingResult : pendingResults)
+        {
+            delete pendingResult.second;
+        }
+
+        return ret;
+    }
 };
 
 htd::WidthMinimizingTreeDecompositionAlgorithm::WidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -271,7 +442,40 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
-    std::size_t bestMaxBagSize = maxBagSize + 1;
+    return computeImprovedDecomposition(graph, preprocessedGraph, manipulationOperations, progressCallback, [maxBagSize]() { return maxBagSize; });
+}
+
+htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::computeImprovedDecomposition(const htd::IMultiHypergraph & graph,
+                                                                                                       const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                       const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                                                       const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                                                       const std::function<std::size_t(void)> & maxBagSize) const
+{
+    std::size_t threadCount = implementation_->threadCount_;
+
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    if (implementation_->iterationCount_ > 0)
+    {
+        threadCount = std::min(threadCount, implementation_->iterationCount_);
+    }
+
+    if (threadCount > 1)
+    {
+        htd::ITreeDecomposition * ret = implementation_->computeImprovedDecompositionInParallel(graph, preprocessedGraph, manipulationOperations, progressCallback, maxBagSize, threadCount);
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
+    std::size_t bestMaxBagSize = maxBagSize() + 1;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -299,7 +503,7 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
             remainingIterations = std::min(remainingIterations, implementation_->nonImprovementLimit_);
         }
 
-        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, remainingIterations);
+        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, [&]() { return std::min(bestMaxBagSize - 1, maxBagSize()); }, remainingIterations);
 
         htd::ITreeDecomposition * currentDecomposition = decompositionResult.first;
 
@@ -434,6 +638,16 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLimit(std:
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::WidthMinimizingTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::WidthMinimizingTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 bool htd::WidthMinimizingTreeDecompositionAlgorithm::isCompressionEnabled(void) const
 {
     return implementation_->algorithm_->isCompressionEnabled();
@@ -0,0 +1,283 @@
+/*
+ * File:   BinFormatGraphExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMATGRAPHEXPORTER_CPP
+#define HTD_IO_BINFORMATGRAPHEXPORTER_CPP
+
+#include <htd_io/BinFormatGraphExporter.hpp>
+
+#include <htd_io/BinFormat.hpp>
+
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Write an unsigned 64-bit value in native byte order.
+     *
+     *  @param[in] outputStream The output stream to which the value shall be written.
+     *  @param[in] value        The value which shall be written.
+     */
+    void writeValue(std::ostream & outputStream, std::uint64_t value)
+    {
+        outputStream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    /**
+     *  Write an array of unsigned 64-bit values in native byte order.
+     *
+     *  @param[in] outputStream The output stream to which the values shall be written.
+     *  @param[in] values       The values which shall be written.
+     */
+    void writeValues(std::ostream & outputStream, const std::vector<std::uint64_t> & values)
+    {
+        outputStream.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(std::uint64_t)));
+    }
+
+    /**
+     *  Write a name table, i.e., the offsets of the names followed by the concatenated and padded names.
+     *
+     *  @param[in] outputStream The output stream to which the name table shall be written.
+     *  @param[in] names        The names which shall be written. Null pointers are written as empty names.
+     */
+    void writeNames(std::ostream & outputStream, const std::vector<const std::string *> & names)
+    {
+        std::vector<std::uint64_t> offsets;
+
+        offsets.reserve(names.size() + 1);
+
+        offsets.push_back(0);
+
+        std::string content;
+
+        for (const std::string * name : names)
+        {
+            if (name != nullptr)
+            {
+                content += *name;
+            }
+
+            offsets.push_back(content.size());
+        }
+
+        content.resize(htd_io::BinFormat::paddedSize(content.size()), '\0');
+
+        writeValues(outputStream, offsets);
+
+        outputStream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    /**
+     *  Compute the total size of the names in a name table.
+     *
+     *  @param[in] names    The names of the name table. Null pointers represent empty names.
+     *
+     *  @return The total size of the names in bytes, excluding padding.
+     */
+    std::size_t nameTableSize(const std::vector<const std::string *> & names)
+    {
+        std::size_t ret = 0;
+
+        for (const std::string * name : names)
+        {
+            if (name != nullptr)
+            {
+                ret += name->size();
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Write a graph in format 'bin'.
+     *
+     *  @param[in] graph        The graph which shall be written.
+     *  @param[in] vertexNames  The names of the vertices in the order of their identifiers or an empty vector if no vertex names shall be written.
+     *  @param[in] edgeNames    The names of the hyperedges in the order of the hyperedges or an empty vector if no edge names shall be written.
+     *  @param[in] outputStream The output stream to which the graph shall be written.
+     *
+     *  @return True if the graph was written successfully, false otherwise.
+     */
+    bool writeGraph(const htd::IMultiHypergraph & graph, const std::vector<const std::string *> & vertexNames, const std::vector<const std::string *> & edgeNames, std::ostream & outputStream)
+    {
+        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+
+        std::vector<std::uint64_t> positions;
+
+        std::uint64_t position = 0;
+
+        for (htd::vertex_t vertex : vertexCollection)
+        {
+            if (vertex >= positions.size())
+            {
+                positions.resize(vertex + 1);
+            }
+
+            positions[vertex] = position;
+
+            ++position;
+        }
+
+        std::vector<std::uint64_t> offsets;
+
+        std::vector<std::uint64_t> elements;
+
+        offsets.reserve(graph.edgeCount() + 1);
+
+        offsets.push_back(0);
+
+        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = graph.hyperedges();
+
+        for (const htd::Hyperedge & hyperedge : hyperedgeCollection)
+        {
+            for (htd::vertex_t vertex : hyperedge.elements())
+            {
+                elements.push_back(positions[vertex]);
+            }
+
+            offsets.push_back(elements.size());
+        }
+
+        std::uint64_t flags = 0;
+
+        if (!vertexNames.empty())
+        {
+            flags |= htd_io::BinFormat::VERTEX_NAMES;
+        }
+
+        if (!edgeNames.empty())
+        {
+            flags |= htd_io::BinFormat::EDGE_NAMES;
+        }
+
+        std::uint32_t version = htd_io::BinFormat::VERSION;
+
+        std::uint32_t byteOrderMark = htd_io::BinFormat::BYTE_ORDER_MARK;
+
+        outputStream.write(htd_io::BinFormat::magic(), htd_io::BinFormat::MAGIC_SIZE);
+
+        outputStream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+
+        outputStream.write(reinterpret_cast<const char *>(&byteOrderMark), sizeof(byteOrderMark));
+
+        writeValue(outputStream, flags);
+        writeValue(outputStream, position);
+        writeValue(outputStream, offsets.size() - 1);
+        writeValue(outputStream, elements.size());
+        writeValue(outputStream, nameTableSize(vertexNames));
+        writeValue(outputStream, nameTableSize(edgeNames));
+
+        writeValues(outputStream, offsets);
+
+        writeValues(outputStream, elements);
+
+        if (!vertexNames.empty())
+        {
+            writeNames(outputStream, vertexNames);
+        }
+
+        if (!edgeNames.empty())
+        {
+            writeNames(outputStream, edgeNames);
+        }
+
+        outputStream.flush();
+
+        return outputStream.good();
+    }
+}
+
+htd_io::BinFormatGraphExporter::BinFormatGraphExporter(void)
+{
+
+}
+
+htd_io::BinFormatGraphExporter::~BinFormatGraphExporter()
+{
+
+}
+
+bool htd_io::BinFormatGraphExporter::write(const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    return writeGraph(graph, std::vector<const std::string *>(), std::vector<const std::string *>(), outputStream);
+}
+
+bool htd_io::BinFormatGraphExporter::write(const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    const htd::IMultiHypergraph & internalGraph = graph.internalGraph();
+
+    std::vector<const std::string *> vertexNames;
+
+    std::vector<const std::string *> edgeNames;
+
+    bool namedEdges = false;
+
+    vertexNames.reserve(internalGraph.vertexCount());
+
+    for (htd::vertex_t vertex : internalGraph.vertices())
+    {
+        vertexNames.push_back(&(graph.vertexName(vertex)));
+    }
+
+    edgeNames.reserve(internalGraph.edgeCount());
+
+    for (const htd::Hyperedge & hyperedge : internalGraph.hyperedges())
+    {
+        if (graph.isNamedEdge(hyperedge.id()))
+        {
+            edgeNames.push_back(&(graph.edgeName(hyperedge.id())));
+
+            namedEdges = true;
+        }
+        else
+        {
+            edgeNames.push_back(nullptr);
+        }
+    }
+
+    if (!namedEdges)
+    {
+        edgeNames.clear();
+    }
+
+    return writeGraph(internalGraph, vertexNames, edgeNames, outputStream);
+}
+
+bool htd_io::BinFormatGraphExporter::write(const htd::IMultiHypergraph & graph, const std::string & path) const
+{
+    std::ofstream outputStream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    return outputStream.good() && write(graph, outputStream);
+}
+
+bool htd_io::BinFormatGraphExporter::write(const htd::NamedMultiHypergraph<std::string, std::string> & graph, const std::string & path) const
+{
+    std::ofstream outputStream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    return outputStream.good() && write(graph, outputStream);
+}
+
+#endif /* HTD_IO_BINFORMATGRAPHEXPORTER_CPP */
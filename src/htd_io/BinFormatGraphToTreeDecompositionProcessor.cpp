@@ -0,0 +1,361 @@
+/*
+ * File:   BinFormatGraphToTreeDecompositionProcessor.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP
+#define HTD_IO_BINFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP
+
+#include <htd_io/BinFormatGraphToTreeDecompositionProcessor.hpp>
+
+#include <htd_io/BinFormatImporter.hpp>
+
+#include <htd/main.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+/**
+ *  Private implementation details of class htd_io::BinFormatGraphToTreeDecompositionProcessor.
+ */
+struct htd_io::BinFormatGraphToTreeDecompositionProcessor::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), exporter_(nullptr), preprocessor_(nullptr)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        if (exporter_ != nullptr)
+        {
+            delete exporter_;
+        }
+
+        if (preprocessor_ != nullptr)
+        {
+            delete preprocessor_;
+        }
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The exporter which shall be used to export the resulting decomposition.
+     */
+    htd_io::ITreeDecompositionExporter * exporter_;
+
+    /**
+     *  The preprocessor which shall be used to preprocess the input graphs.
+     */
+    htd::IGraphPreprocessor * preprocessor_;
+
+    /**
+     *  A vector of callback functions which are invoked after parsing the input graph is finished.
+     */
+    std::vector<std::function<void(htd_io::parsing_result_t, std::size_t, std::size_t)>> parsingCallbacks_;
+
+    /**
+     *  A vector of callback functions which are invoked after preprocessing the input graph.
+     */
+    std::vector<std::function<void(std::size_t, std::size_t)>> preprocessingCallbacks_;
+
+    /**
+     *  A vector of callback functions which are invoked after decomposing the input graph is finished.
+     */
+    std::vector<std::function<void(const htd::FitnessEvaluation &)>> decompositionCallbacks_;
+
+    /**
+     *  Invoke all callback functions after parsing the input graph.
+     *
+     *  @param[in] result       This value indicates whether the parsing process was finished successfully.
+     *  @param[in] vertexCount  The vertex count of the input graph.
+     *  @param[in] edgeCount    The edge count of the input graph.
+     */
+    void invokeParsingCallbacks(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount) const
+    {
+        for (const std::function<void(htd_io::parsing_result_t, std::size_t, std::size_t)> & callback : parsingCallbacks_)
+        {
+            callback(result, vertexCount, edgeCount);
+        }
+    }
+
+    /**
+     *  Invoke all callback functions after preprocessing the input graph.
+     *
+     *  @param[in] vertexCount  The vertex count of the preprocessed input graph.
+     *  @param[in] edgeCount    The edge count of the preprocessed input graph.
+     */
+    void invokePreprocessingCallbacks(std::size_t vertexCount, std::size_t edgeCount) const
+    {
+        for (const std::function<void(std::size_t, std::size_t)> & callback : preprocessingCallbacks_)
+        {
+            callback(vertexCount, edgeCount);
+        }
+    }
+
+    /**
+     *  Invoke all callback functions after after decomposing the input graph.
+     *
+     *  @param[in] fitness  The fitness evaluation of the computed decomposition.
+     */
+    void invokeDecompositionCallbacks(const htd::FitnessEvaluation & fitness) const
+    {
+        for (const std::function<void(const htd::FitnessEvaluation &)> & callback : decompositionCallbacks_)
+        {
+            callback(fitness);
+        }
+    }
+
+    /**
+     *  Access the graph which shall be decomposed.
+     *
+     *  @param[in] graph    The input graph.
+     *
+     *  @return The graph which shall be decomposed.
+     */
+    static const htd::IMultiHypergraph & internalGraph(const htd::IMultiHypergraph & graph)
+    {
+        return graph;
+    }
+
+    /**
+     *  Access the graph which shall be decomposed.
+     *
+     *  @param[in] graph    The named input graph.
+     *
+     *  @return The graph underlying the named input graph which shall be decomposed.
+     */
+    static const htd::IMultiHypergraph & internalGraph(const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+    {
+        return graph.internalGraph();
+    }
+
+    /**
+     *  Decompose a given input graph and write the resulting decomposition to the given output stream.
+     *
+     *  @param[in] inputGraph   The input graph which shall be decomposed or nullptr if the input could not be read. The graph is deleted afterwards.
+     *  @param[in] outputStream The output stream to which the decomposition shall be written.
+     */
+    template <typename GraphType>
+    void process(GraphType * inputGraph, std::ostream & outputStream) const
+    {
+        if (inputGraph != nullptr)
+        {
+            const htd::IMultiHypergraph * graph = &(internalGraph(*inputGraph));
+
+            invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
+
+            htd::ITreeDecompositionAlgorithm * algorithm = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+
+            htd::ITreeDecomposition * decomposition = nullptr;
+
+            if (preprocessor_ != nullptr)
+            {
+                htd::IPreprocessedGraph * preprocessedGraph = preprocessor_->prepare(*graph);
+
+                HTD_ASSERT(preprocessedGraph != nullptr)
+
+                invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+
+                htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+
+                if (customizedAlgorithm != nullptr)
+                {
+                    decomposition = customizedAlgorithm->computeDecomposition(*graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
+                                                                                                              const htd::ITreeDecomposition & decomposition,
+                                                                                                              const htd::FitnessEvaluation & fitness)
+                    {
+                        HTD_UNUSED(graph)
+                        HTD_UNUSED(decomposition)
+
+                        invokeDecompositionCallbacks(fitness);
+                    });
+                }
+                else
+                {
+                    decomposition = algorithm->computeDecomposition(*graph, *preprocessedGraph);
+
+                    if (decomposition != nullptr)
+                    {
+                        invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    }
+                }
+
+                delete preprocessedGraph;
+            }
+            else
+            {
+                htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+
+                if (customizedAlgorithm != nullptr)
+                {
+                    decomposition = customizedAlgorithm->computeDecomposition(*graph, [&](const htd::IMultiHypergraph & graph,
+                                                                                          const htd::ITreeDecomposition & decomposition,
+                                                                                          const htd::FitnessEvaluation & fitness)
+                    {
+                        HTD_UNUSED(graph)
+                        HTD_UNUSED(decomposition)
+
+                        invokeDecompositionCallbacks(fitness);
+                    });
+                }
+                else
+                {
+                    decomposition = algorithm->computeDecomposition(*graph);
+
+                    if (decomposition != nullptr)
+                    {
+                        invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    }
+                }
+            }
+
+            delete algorithm;
+
+            if (decomposition != nullptr)
+            {
+                if (exporter_ != nullptr)
+                {
+                    exporter_->write(*decomposition, *inputGraph, outputStream);
+                }
+
+                delete decomposition;
+            }
+
+            delete inputGraph;
+        }
+        else
+        {
+            invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+        }
+    }
+};
+
+htd_io::BinFormatGraphToTreeDecompositionProcessor::BinFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::BinFormatGraphToTreeDecompositionProcessor::~BinFormatGraphToTreeDecompositionProcessor(void)
+{
+
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
+{
+    std::ofstream outputStream(outputFile);
+
+    process(inputFile, outputStream);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
+{
+    htd_io::BinFormatImporter importer(implementation_->managementInstance_);
+
+    if (importer.isNamed(inputFile))
+    {
+        implementation_->process(importer.importNamed(inputFile), outputStream);
+    }
+    else
+    {
+        implementation_->process(importer.import(inputFile), outputStream);
+    }
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
+{
+    std::ofstream outputStream(outputFile);
+
+    process(inputStream, outputStream);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
+{
+    htd_io::BinFormatImporter importer(implementation_->managementInstance_);
+
+    std::stringstream content(std::ios::in | std::ios::out | std::ios::binary);
+
+    content << inputStream.rdbuf();
+
+    htd::NamedMultiHypergraph<std::string, std::string> * namedGraph = importer.importNamed(content);
+
+    if (namedGraph != nullptr)
+    {
+        implementation_->process(namedGraph, outputStream);
+    }
+    else
+    {
+        content.clear();
+
+        content.seekg(0);
+
+        implementation_->process(importer.import(content), outputStream);
+    }
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::setExporter(htd_io::ITreeDecompositionExporter * exporter)
+{
+    if (implementation_->exporter_ != nullptr)
+    {
+        delete implementation_->exporter_;
+    }
+
+    implementation_->exporter_ = exporter;
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGraphPreprocessor * preprocessor)
+{
+    if (implementation_->preprocessor_ != nullptr)
+    {
+        delete implementation_->preprocessor_;
+    }
+
+    implementation_->preprocessor_ = preprocessor;
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback)
+{
+    implementation_->parsingCallbacks_.push_back(callback);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::registerPreprocessingCallback(const std::function<void(std::size_t vertexCount, std::size_t edgeCount)> & callback)
+{
+    implementation_->preprocessingCallbacks_.push_back(callback);
+}
+
+void htd_io::BinFormatGraphToTreeDecompositionProcessor::registerDecompositionCallback(const std::function<void(const htd::FitnessEvaluation &)> & callback)
+{
+    implementation_->decompositionCallbacks_.push_back(callback);
+}
+
+#endif /* HTD_IO_BINFORMATGRAPHTOTREEDECOMPOSITIONPROCESSOR_CPP */
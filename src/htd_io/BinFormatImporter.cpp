@@ -0,0 +1,520 @@
+/*
+ * File:   BinFormatImporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINFORMATIMPORTER_CPP
+#define HTD_IO_BINFORMATIMPORTER_CPP
+
+#include <htd_io/BinFormatImporter.hpp>
+
+#include <htd_io/BinFormat.hpp>
+#include <htd_io/MemoryMappedFile.hpp>
+
+#include <htd/MultiHypergraphFactory.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd_io::BinFormatImporter.
+ */
+struct htd_io::BinFormatImporter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Positions of the sections of a file in format 'bin'.
+     */
+    struct Layout
+    {
+        /**
+         *  The flags stored in the header.
+         */
+        std::uint64_t flags;
+
+        /**
+         *  The number of vertices.
+         */
+        std::size_t vertexCount;
+
+        /**
+         *  The number of hyperedges.
+         */
+        std::size_t edgeCount;
+
+        /**
+         *  The total number of hyperedge elements.
+         */
+        std::size_t elementCount;
+
+        /**
+         *  The size of the vertex name table in bytes.
+         */
+        std::size_t vertexNameSize;
+
+        /**
+         *  The size of the edge name table in bytes.
+         */
+        std::size_t edgeNameSize;
+
+        /**
+         *  The beginning of the hyperedge offsets.
+         */
+        const char * edgeOffsets;
+
+        /**
+         *  The beginning of the hyperedge elements.
+         */
+        const char * elements;
+
+        /**
+         *  The beginning of the vertex name offsets or nullptr if the file contains no vertex names.
+         */
+        const char * vertexNameOffsets;
+
+        /**
+         *  The beginning of the vertex names or nullptr if the file contains no vertex names.
+         */
+        const char * vertexNames;
+
+        /**
+         *  The beginning of the edge name offsets or nullptr if the file contains no edge names.
+         */
+        const char * edgeNameOffsets;
+
+        /**
+         *  The beginning of the edge names or nullptr if the file contains no edge names.
+         */
+        const char * edgeNames;
+    };
+
+    /**
+     *  Read an unsigned 64-bit value in native byte order.
+     *
+     *  @param[in] position The position of the value.
+     *  @param[in] index    The index of the value, relative to the given position.
+     *
+     *  @return The value at the given position.
+     */
+    static std::uint64_t readValue(const char * position, std::size_t index = 0)
+    {
+        std::uint64_t ret = 0;
+
+        std::memcpy(&ret, position + index * sizeof(std::uint64_t), sizeof(std::uint64_t));
+
+        return ret;
+    }
+
+    /**
+     *  Determine the positions of the sections of a file in format 'bin'.
+     *
+     *  @param[in] data     The content of the file.
+     *  @param[in] size     The size of the file in bytes.
+     *  @param[out] layout  The positions of the sections of the file.
+     *
+     *  @return True if the header is valid and the file is large enough to hold all sections, false otherwise.
+     */
+    static bool readLayout(const char * data, std::size_t size, Layout & layout)
+    {
+        bool ret = data != nullptr && size >= htd_io::BinFormat::HEADER_SIZE && std::memcmp(data, htd_io::BinFormat::magic(), htd_io::BinFormat::MAGIC_SIZE) == 0;
+
+        if (ret)
+        {
+            std::uint32_t version = 0;
+            std::uint32_t byteOrderMark = 0;
+
+            std::memcpy(&version, data + 8, sizeof(version));
+            std::memcpy(&byteOrderMark, data + 12, sizeof(byteOrderMark));
+
+            std::uint64_t valueLimit = size / sizeof(std::uint64_t);
+
+            layout.flags = readValue(data + 16);
+
+            std::uint64_t vertexCount = readValue(data + 24);
+            std::uint64_t edgeCount = readValue(data + 32);
+            std::uint64_t elementCount = readValue(data + 40);
+            std::uint64_t vertexNameSize = readValue(data + 48);
+            std::uint64_t edgeNameSize = readValue(data + 56);
+
+            /* Bound all counts by the file size first, so that the size computation below cannot overflow. */
+            ret = version == htd_io::BinFormat::VERSION &&
+                  byteOrderMark == htd_io::BinFormat::BYTE_ORDER_MARK &&
+                  (layout.flags & ~(htd_io::BinFormat::VERTEX_NAMES | htd_io::BinFormat::EDGE_NAMES)) == 0 &&
+                  vertexCount < valueLimit && edgeCount < valueLimit && elementCount <= valueLimit &&
+                  vertexNameSize <= size && edgeNameSize <= size;
+
+            if (ret)
+            {
+                layout.vertexCount = static_cast<std::size_t>(vertexCount);
+                layout.edgeCount = static_cast<std::size_t>(edgeCount);
+                layout.elementCount = static_cast<std::size_t>(elementCount);
+                layout.vertexNameSize = static_cast<std::size_t>(vertexNameSize);
+                layout.edgeNameSize = static_cast<std::size_t>(edgeNameSize);
+
+                std::size_t requiredSize = htd_io::BinFormat::HEADER_SIZE;
+
+                layout.edgeOffsets = data + requiredSize;
+
+                requiredSize += (layout.edgeCount + 1) * sizeof(std::uint64_t);
+
+                layout.elements = data + requiredSize;
+
+                requiredSize += layout.elementCount * sizeof(std::uint64_t);
+
+                layout.vertexNameOffsets = nullptr;
+                layout.vertexNames = nullptr;
+
+                if ((layout.flags & htd_io::BinFormat::VERTEX_NAMES) != 0)
+                {
+                    layout.vertexNameOffsets = data + requiredSize;
+
+                    requiredSize += (layout.vertexCount + 1) * sizeof(std::uint64_t);
+
+                    layout.vertexNames = data + requiredSize;
+
+                    requiredSize += htd_io::BinFormat::paddedSize(layout.vertexNameSize);
+                }
+
+                layout.edgeNameOffsets = nullptr;
+                layout.edgeNames = nullptr;
+
+                if ((layout.flags & htd_io::BinFormat::EDGE_NAMES) != 0)
+                {
+                    layout.edgeNameOffsets = data + requiredSize;
+
+                    requiredSize += (layout.edgeCount + 1) * sizeof(std::uint64_t);
+
+                    layout.edgeNames = data + requiredSize;
+
+                    requiredSize += htd_io::BinFormat::paddedSize(layout.edgeNameSize);
+                }
+
+                ret = requiredSize <= size;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Check that a name table is well-formed.
+     *
+     *  @param[in] offsets      The beginning of the offsets of the name table.
+     *  @param[in] nameCount    The number of names in the table.
+     *  @param[in] size         The size of the concatenated names in bytes.
+     *
+     *  @return True if the offsets are non-decreasing, start at 0 and end at the given size, false otherwise.
+     */
+    static bool isValidNameTable(const char * offsets, std::size_t nameCount, std::size_t size)
+    {
+        bool ret = readValue(offsets) == 0 && readValue(offsets, nameCount) == size;
+
+        for (std::size_t index = 0; ret && index < nameCount; ++index)
+        {
+            ret = readValue(offsets, index) <= readValue(offsets, index + 1);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Access a name stored in a name table.
+     *
+     *  @param[in] offsets  The beginning of the offsets of the name table.
+     *  @param[in] names    The beginning of the concatenated names.
+     *  @param[in] index    The index of the name.
+     *
+     *  @return The name at the given index.
+     */
+    static std::string name(const char * offsets, const char * names, std::size_t index)
+    {
+        std::size_t begin = static_cast<std::size_t>(readValue(offsets, index));
+
+        return std::string(names + begin, static_cast<std::size_t>(readValue(offsets, index + 1)) - begin);
+    }
+
+    /**
+     *  Decode the elements of a hyperedge.
+     *
+     *  @param[in] layout       The positions of the sections of the file.
+     *  @param[in] edgeIndex    The index of the hyperedge.
+     *  @param[in] elementIndex The index of the first element of the hyperedge. After the call, the index of the first element of the next hyperedge.
+     *  @param[out] elements    The 0-based positions of the vertices contained in the hyperedge.
+     *
+     *  @return True if the offsets and elements of the hyperedge are valid, false otherwise.
+     */
+    static bool readHyperedge(const Layout & layout, std::size_t edgeIndex, std::size_t & elementIndex, std::vector<std::size_t> & elements)
+    {
+        std::uint64_t end = readValue(layout.edgeOffsets, edgeIndex + 1);
+
+        bool ret = readValue(layout.edgeOffsets, edgeIndex) == elementIndex && end >= elementIndex && end <= layout.elementCount;
+
+        elements.clear();
+
+        while (ret && elementIndex < end)
+        {
+            std::uint64_t position = readValue(layout.elements, elementIndex);
+
+            ret = position < layout.vertexCount;
+
+            elements.push_back(static_cast<std::size_t>(position));
+
+            ++elementIndex;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Create a new IMultiHypergraph instance based on the content of a file in format 'bin'.
+     *
+     *  @param[in] data The content of the file.
+     *  @param[in] size The size of the file in bytes.
+     *
+     *  @return A new IMultiHypergraph instance or nullptr if the content is invalid.
+     */
+    htd::IMultiHypergraph * importGraph(const char * data, std::size_t size) const
+    {
+        htd::IMutableMultiHypergraph * ret = nullptr;
+
+        Layout layout;
+
+        if (readLayout(data, size, layout))
+        {
+            bool error = readValue(layout.edgeOffsets) != 0 || readValue(layout.edgeOffsets, layout.edgeCount) != layout.elementCount;
+
+            ret = managementInstance_->multiHypergraphFactory().createInstance(layout.vertexCount);
+
+            std::vector<std::size_t> positions;
+
+            std::size_t elementIndex = 0;
+
+            for (std::size_t edgeIndex = 0; !error && edgeIndex < layout.edgeCount && !managementInstance_->isTerminated(); ++edgeIndex)
+            {
+                error = !readHyperedge(layout, edgeIndex, elementIndex, positions);
+
+                if (!error)
+                {
+                    if (positions.size() == 2)
+                    {
+                        ret->addEdge(positions[0] + htd::Vertex::FIRST, positions[1] + htd::Vertex::FIRST);
+                    }
+                    else
+                    {
+                        std::vector<htd::vertex_t> elements;
+
+                        elements.reserve(positions.size());
+
+                        for (std::size_t position : positions)
+                        {
+                            elements.push_back(position + htd::Vertex::FIRST);
+                        }
+
+                        ret->addEdge(std::move(elements));
+                    }
+                }
+            }
+
+            if (error)
+            {
+                delete ret;
+
+                ret = nullptr;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Create a new htd::NamedMultiHypergraph<std::string, std::string> instance based on the content of a file in format 'bin'.
+     *
+     *  @param[in] data The content of the file.
+     *  @param[in] size The size of the file in bytes.
+     *
+     *  @return A new htd::NamedMultiHypergraph<std::string, std::string> instance or nullptr if the content is invalid or contains no vertex names.
+     */
+    htd::NamedMultiHypergraph<std::string, std::string> * importNamedGraph(const char * data, std::size_t size) const
+    {
+        htd::NamedMultiHypergraph<std::string, std::string> * ret = nullptr;
+
+        Layout layout;
+
+        if (readLayout(data, size, layout) && layout.vertexNames != nullptr)
+        {
+            bool error = readValue(layout.edgeOffsets) != 0 || readValue(layout.edgeOffsets, layout.edgeCount) != layout.elementCount ||
+                         !isValidNameTable(layout.vertexNameOffsets, layout.vertexCount, layout.vertexNameSize) ||
+                         (layout.edgeNames != nullptr && !isValidNameTable(layout.edgeNameOffsets, layout.edgeCount, layout.edgeNameSize));
+
+            ret = new htd::NamedMultiHypergraph<std::string, std::string>(managementInstance_);
+
+            if (!error)
+            {
+                std::vector<std::string> vertexNames;
+
+                vertexNames.reserve(layout.vertexCount);
+
+                for (std::size_t index = 0; index < layout.vertexCount; ++index)
+                {
+                    vertexNames.push_back(name(layout.vertexNameOffsets, layout.vertexNames, index));
+                }
+
+                ret->addVertices(vertexNames);
+
+                /* Duplicate vertex names would silently merge vertices. */
+                error = ret->vertexCount() != layout.vertexCount;
+
+                std::vector<std::size_t> positions;
+
+                std::size_t elementIndex = 0;
+
+                for (std::size_t edgeIndex = 0; !error && edgeIndex < layout.edgeCount && !managementInstance_->isTerminated(); ++edgeIndex)
+                {
+                    error = !readHyperedge(layout, edgeIndex, elementIndex, positions);
+
+                    if (!error)
+                    {
+                        std::vector<std::string> elements;
+
+                        elements.reserve(positions.size());
+
+                        for (std::size_t position : positions)
+                        {
+                            elements.push_back(vertexNames[position]);
+                        }
+
+                        if (layout.edgeNames != nullptr && readValue(layout.edgeNameOffsets, edgeIndex) != readValue(layout.edgeNameOffsets, edgeIndex + 1))
+                        {
+                            ret->addEdge(elements, name(layout.edgeNameOffsets, layout.edgeNames, edgeIndex));
+                        }
+                        else
+                        {
+                            ret->addEdge(elements);
+                        }
+                    }
+                }
+            }
+
+            if (error)
+            {
+                delete ret;
+
+                ret = nullptr;
+            }
+        }
+
+        return ret;
+    }
+};
+
+htd_io::BinFormatImporter::BinFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::BinFormatImporter::~BinFormatImporter(void)
+{
+
+}
+
+bool htd_io::BinFormatImporter::isValid(const std::string & path) const
+{
+    htd_io::MemoryMappedFile file(path);
+
+    Implementation::Layout layout;
+
+    return file.isOpen() && Implementation::readLayout(file.data(), file.size(), layout);
+}
+
+bool htd_io::BinFormatImporter::isNamed(const std::string & path) const
+{
+    htd_io::MemoryMappedFile file(path);
+
+    Implementation::Layout layout;
+
+    return file.isOpen() && Implementation::readLayout(file.data(), file.size(), layout) && layout.vertexNames != nullptr;
+}
+
+htd::IMultiHypergraph * htd_io::BinFormatImporter::import(const std::string & path) const
+{
+    htd::IMultiHypergraph * ret = nullptr;
+
+    htd_io::MemoryMappedFile file(path);
+
+    if (file.isOpen())
+    {
+        ret = implementation_->importGraph(file.data(), file.size());
+    }
+
+    return ret;
+}
+
+htd::IMultiHypergraph * htd_io::BinFormatImporter::import(std::istream & stream) const
+{
+    std::vector<char> content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    return implementation_->importGraph(content.data(), content.size());
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::BinFormatImporter::importNamed(const std::string & path) const
+{
+    htd::NamedMultiHypergraph<std::string, std::string> * ret = nullptr;
+
+    htd_io::MemoryMappedFile file(path);
+
+    if (file.isOpen())
+    {
+        ret = implementation_->importNamedGraph(file.data(), file.size());
+    }
+
+    return ret;
+}
+
+htd::NamedMultiHypergraph<std::string, std::string> * htd_io::BinFormatImporter::importNamed(std::istream & stream) const
+{
+    std::vector<char> content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    return implementation_->importNamedGraph(content.data(), content.size());
+}
+
+#endif /* HTD_IO_BINFORMATIMPORTER_CPP */
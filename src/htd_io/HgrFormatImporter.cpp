@@ -26,12 +26,18 @@
 #define HTD_IO_HGRFORMATIMPORTER_CPP
 
 #include <htd_io/HgrFormatImporter.hpp>
+#include <htd_io/MemoryMappedFile.hpp>
 
 #include <htd/MultiHypergraphFactory.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <string>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::HgrFormatImporter.
@@ -43,7 +49,7 @@ struct htd_io::HgrFormatImporter::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1)
     {
 
     }
@@ -57,8 +63,371 @@ struct htd_io::HgrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of worker threads which shall be used to parse memory-mapped files.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The minimum number of bytes which are assigned to a worker thread when parsing a file in parallel.
+     */
+    static const std::size_t MINIMUM_CHUNK_SIZE = 1 << 16;
+
+    /**
+     *  Find the end of the line starting at the given position.
+     *
+     *  @param[in] position The beginning of the line.
+     *  @param[in] end      The end of the input.
+     *
+     *  @return The position of the line break terminating the line or the end of the input if the line is not terminated.
+     */
+    static const char * findLineEnd(const char * position, const char * end)
+    {
+        const char * ret = static_cast<const char *>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+
+        return ret != nullptr ? ret : end;
+    }
+
+    /**
+     *  Parse a non-negative decimal integer and advance the given position behind its last digit.
+     *
+     *  @param[in,out] position The position of the first digit.
+     *  @param[in] end          The end of the input.
+     *  @param[out] value       The parsed integer.
+     *
+     *  @return True if at least one digit was found and the integer does not exceed the range of std::size_t, false otherwise.
+     */
+    static bool parseNumber(const char * & position, const char * end, std::size_t & value)
+    {
+        const std::size_t limit = (std::numeric_limits<std::size_t>::max() - 9) / 10;
+
+        bool ret = position != end && *position >= '0' && *position <= '9';
+
+        value = 0;
+
+        while (ret && position != end && *position >= '0' && *position <= '9')
+        {
+            ret = value <= limit;
+
+            value = value * 10 + static_cast<std::size_t>(*position - '0');
+
+            ++position;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Parse the problem line of the input and advance the given position to the beginning of the first line after it.
+     *
+     *  @param[in,out] position The beginning of the input.
+     *  @param[in] end          The end of the input.
+     *  @param[out] vertexCount The number of vertices declared in the problem line.
+     *  @param[out] edgeCount   The number of edges declared in the problem line.
+     *
+     *  @return True if a valid problem line was found, false otherwise.
+     */
+    static bool parseProblemLine(const char * & position, const char * end, std::size_t & vertexCount, std::size_t & edgeCount)
+    {
+        bool ret = false;
+
+        bool error = false;
+
+        while (!ret && !error && position != end)
+        {
+            const char * lineEnd = findLineEnd(position, end);
+
+            const char * nextLine = lineEnd != end ? lineEnd + 1 : end;
+
+            if (lineEnd != position && *(lineEnd - 1) == '\r')
+            {
+                --lineEnd;
+            }
+
+            if (position == lineEnd)
+            {
+                error = true;
+            }
+            else if (*position != 'c')
+            {
+                error = lineEnd - position < 5 || std::strncmp(position, "p tw ", 5) != 0;
+
+                if (!error)
+                {
+                    position += 5;
+
+                    error = !parseNumber(position, lineEnd, vertexCount) || position == lineEnd || *position != ' ';
+
+                    if (!error)
+                    {
+                        ++position;
+
+                        error = !parseNumber(position, lineEnd, edgeCount) || position != lineEnd;
+                    }
+                }
+
+                ret = !error;
+            }
+
+            position = nextLine;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Parse the edges stored in a range of complete lines.
+     *
+     *  @param[in] position     The beginning of the first line.
+     *  @param[in] end          The end of the last line.
+     *  @param[in] vertexCount  The number of vertices declared in the problem line.
+     *  @param[out] edgeCount   The number of parsed edges.
+     *  @param[in] edgeHandler  The function which is called with the vertices of each parsed hyperedge.
+     *
+     *  @return True if all lines are valid, false otherwise.
+     */
+    template <typename EdgeHandler>
+    bool parseEdges(const char * position, const char * end, std::size_t vertexCount, std::size_t & edgeCount, const EdgeHandler & edgeHandler) const
+    {
+        bool ret = true;
+
+        edgeCount = 0;
+
+        std::vector<htd::vertex_t> vertices;
+
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        while (ret && position != end && !managementInstance.isTerminated())
+        {
+            const char * lineEnd = findLineEnd(position, end);
+
+            const char * nextLine = lineEnd != end ? lineEnd + 1 : end;
+
+            if (lineEnd != position && *(lineEnd - 1) == '\r')
+            {
+                --lineEnd;
+            }
+
+            if (position == lineEnd)
+            {
+                ret = false;
+            }
+            else if (*position != 'c')
+            {
+                bool lineFinished = false;
+
+                vertices.clear();
+
+                while (ret && !lineFinished)
+                {
+                    std::size_t vertex = 0;
+
+                    ret = parseNumber(position, lineEnd, vertex) && vertex >= htd::Vertex::FIRST && vertex <= vertexCount;
+
+                    if (ret)
+                    {
+                        vertices.push_back(static_cast<htd::vertex_t>(vertex));
+
+                        if (position == lineEnd)
+                        {
+                            lineFinished = true;
+                        }
+                        else
+                        {
+                            ret = *position == ' ';
+
+                            ++position;
+                        }
+                    }
+                }
+
+                if (ret)
+                {
+                    edgeHandler(vertices);
+
+                    ++edgeCount;
+                }
+            }
+
+            position = nextLine;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Create a new IMultiHypergraph instance based on the content of a file in the graph format 'hgr'.
+     *
+     *  @param[in] begin    The beginning of the content of the file.
+     *  @param[in] end      The end of the content of the file.
+     *
+     *  @return A new IMultiHypergraph instance based on the given content or nullptr if the content is not valid.
+     */
+    htd::IMultiHypergraph * import(const char * begin, const char * end) const
+    {
+        std::size_t vertexCount = 0;
+        std::size_t edgeCount = 0;
+
+        const char * position = begin;
+
+        bool error = !parseProblemLine(position, end, vertexCount, edgeCount);
+
+        htd::IMutableMultiHypergraph * ret = nullptr;
+
+        if (!error)
+        {
+            ret = managementInstance_->multiHypergraphFactory().createInstance(vertexCount);
+
+            std::size_t chunkCount = std::min(effectiveThreadCount(), std::max(static_cast<std::size_t>(end - position) / MINIMUM_CHUNK_SIZE, (std::size_t)1));
+
+            std::size_t parsedEdgeCount = 0;
+
+            if (chunkCount > 1)
+            {
+                error = !importInParallel(*ret, position, end, vertexCount, edgeCount, chunkCount, parsedEdgeCount);
+            }
+            else
+            {
+                error = !parseEdges(position, end, vertexCount, parsedEdgeCount, [&](const std::vector<htd::vertex_t> & vertices)
+                {
+                    ret->addEdge(vertices);
+                });
+            }
+
+            if (parsedEdgeCount != edgeCount && !managementInstance_->isTerminated())
+            {
+                error = true;
+            }
+        }
+
+        if (error)
+        {
+            delete ret;
+
+            ret = nullptr;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Parse the edges stored in a range of complete lines concurrently and add them to the given graph.
+     *
+     *  The range is split on line boundaries into one chunk per worker thread. Each worker collects the
+     *  hyperedges of its chunk in a separate, flat edge list and the edge lists are added to the graph in
+     *  the order of the chunks, so that the resulting graph is identical to the one obtained by a sequential
+     *  parse.
+     *
+     *  @param[in] graph            The graph to which the parsed edges shall be added.
+     *  @param[in] begin            The beginning of the first line.
+     *  @param[in] end              The end of the last line.
+     *  @param[in] vertexCount      The number of vertices declared in the problem line.
+     *  @param[in] edgeCount        The number of edges declared in the problem line.
+     *  @param[in] chunkCount       The number of chunks, i.e., the number of worker threads which shall be used.
+     *  @param[out] parsedEdgeCount The total number of parsed edges.
+     *
+     *  @return True if all lines are valid, false otherwise.
+     */
+    bool importInParallel(htd::IMutableMultiHypergraph & graph, const char * begin, const char * end, std::size_t vertexCount, std::size_t edgeCount, std::size_t chunkCount, std::size_t & parsedEdgeCount) const
+    {
+        bool ret = true;
+
+        std::vector<const char *> boundaries(chunkCount + 1, end);
+
+        boundaries[0] = begin;
+
+        for (std::size_t index = 1; index < chunkCount; ++index)
+        {
+            const char * position = std::max(begin + (static_cast<std::size_t>(end - begin) / chunkCount) * index, boundaries[index - 1]);
+
+            const char * lineEnd = findLineEnd(position, end);
+
+            boundaries[index] = lineEnd != end ? lineEnd + 1 : end;
+        }
+
+        std::vector<std::vector<htd::vertex_t>> elements(chunkCount);
+
+        std::vector<std::vector<std::size_t>> edgeSizes(chunkCount);
+
+        std::vector<std::size_t> edgeCounts(chunkCount, 0);
+
+        std::vector<char> results(chunkCount, 0);
+
+        auto worker = [&](std::size_t index)
+        {
+            std::vector<htd::vertex_t> & currentElements = elements[index];
+
+            std::vector<std::size_t> & currentEdgeSizes = edgeSizes[index];
+
+            currentEdgeSizes.reserve(edgeCount / chunkCount + 1);
+
+            results[index] = parseEdges(boundaries[index], boundaries[index + 1], vertexCount, edgeCounts[index], [&](const std::vector<htd::vertex_t> & vertices)
+            {
+                currentElements.insert(currentElements.end(), vertices.begin(), vertices.end());
+
+                currentEdgeSizes.push_back(vertices.size());
+            });
+        };
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t index = 1; index < chunkCount; ++index)
+        {
+            threads.emplace_back(worker, index);
+        }
+
+        worker(0);
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+
+        parsedEdgeCount = 0;
+
+        for (std::size_t index = 0; ret && index < chunkCount && !managementInstance_->isTerminated(); ++index)
+        {
+            ret = results[index] != 0;
+
+            auto position = elements[index].begin();
+
+            for (std::size_t edgeSize : edgeSizes[index])
+            {
+                graph.addEdge(std::vector<htd::vertex_t>(position, position + edgeSize));
+
+                position += edgeSize;
+            }
+
+            parsedEdgeCount += edgeCounts[index];
+
+            std::vector<htd::vertex_t>().swap(elements[index]);
+            std::vector<std::size_t>().swap(edgeSizes[index]);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Determine the number of worker threads which shall be used to parse memory-mapped files.
+     *
+     *  @return The number of worker threads which shall be used to parse memory-mapped files.
+     */
+    std::size_t effectiveThreadCount(void) const
+    {
+        std::size_t ret = threadCount_;
+
+        if (ret == 0)
+        {
+            ret = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        return ret;
+    }
 };
 
+const std::size_t htd_io::HgrFormatImporter::Implementation::MINIMUM_CHUNK_SIZE;
+
 htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
 {
 
@@ -71,9 +440,22 @@ htd_io::HgrFormatImporter::~HgrFormatImporter(void)
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
 {
-    std::ifstream stream(path);
+    htd::IMultiHypergraph * ret = nullptr;
 
-    return import(stream);
+    htd_io::MemoryMappedFile file(path);
+
+    if (file.isOpen())
+    {
+        ret = implementation_->import(file.data(), file.data() + file.size());
+    }
+    else
+    {
+        std::ifstream stream(path);
+
+        ret = import(stream);
+    }
+
+    return ret;
 }
 
 htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
@@ -194,4 +576,14 @@ htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream)
     return ret;
 }
 
+std::size_t htd_io::HgrFormatImporter::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd_io::HgrFormatImporter::setThreadCount(std::size_t threadCount)
+{
+    implementation_->threadCount_ = threadCount;
+}
+
 #endif /* HTD_IO_HGRFORMATIMPORTER_CPP */
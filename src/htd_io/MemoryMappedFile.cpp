@@ -0,0 +1,258 @@
+/*
+ * File:   MemoryMappedFile.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_MEMORYMAPPEDFILE_CPP
+#define HTD_IO_MEMORYMAPPEDFILE_CPP
+
+#include <htd_io/MemoryMappedFile.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    #define HTD_IO_POSIX_MEMORY_MAPPING
+#endif
+
+/**
+ *  Private implementation details of class htd_io::MemoryMappedFile.
+ */
+struct htd_io::MemoryMappedFile::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] path The path to the file which shall be opened.
+     */
+    Implementation(const std::string & path) : data_(nullptr), size_(0), open_(false), mapped_(false), buffer_()
+    {
+        if (!map(path))
+        {
+            read(path);
+        }
+    }
+
+    virtual ~Implementation()
+    {
+        if (mapped_)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(data_);
+#elif defined(HTD_IO_POSIX_MEMORY_MAPPING)
+            ::munmap(const_cast<char *>(data_), size_);
+#endif
+        }
+    }
+
+    /**
+     *  A pointer to the first byte of the file.
+     */
+    const char * data_;
+
+    /**
+     *  The size of the file in bytes.
+     */
+    std::size_t size_;
+
+    /**
+     *  A boolean flag indicating whether the file could be opened.
+     */
+    bool open_;
+
+    /**
+     *  A boolean flag indicating whether the content of the file is accessed via a memory mapping.
+     */
+    bool mapped_;
+
+    /**
+     *  The buffer holding the content of the file if it could not be mapped into memory.
+     */
+    std::vector<char> buffer_;
+
+    /**
+     *  Map the file into memory.
+     *
+     *  @param[in] path The path to the file which shall be mapped.
+     *
+     *  @return True if the file was successfully mapped into memory or if it is an empty regular file, false otherwise.
+     */
+    bool map(const std::string & path)
+    {
+        bool ret = false;
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER fileSize;
+
+            if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &fileSize))
+            {
+                if (fileSize.QuadPart == 0)
+                {
+                    open_ = true;
+
+                    ret = true;
+                }
+                else
+                {
+                    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+                    if (mapping != NULL)
+                    {
+                        void * view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+                        if (view != NULL)
+                        {
+                            data_ = static_cast<const char *>(view);
+
+                            size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+                            open_ = true;
+
+                            mapped_ = true;
+
+                            ret = true;
+                        }
+
+                        /* The view keeps the mapping alive until it is unmapped. */
+                        CloseHandle(mapping);
+                    }
+                }
+            }
+
+            CloseHandle(file);
+        }
+#elif defined(HTD_IO_POSIX_MEMORY_MAPPING)
+        int file = ::open(path.c_str(), O_RDONLY);
+
+        if (file >= 0)
+        {
+            struct stat status;
+
+            if (fstat(file, &status) == 0 && S_ISREG(status.st_mode))
+            {
+                if (status.st_size == 0)
+                {
+                    open_ = true;
+
+                    ret = true;
+                }
+                else
+                {
+                    void * view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+                    if (view != MAP_FAILED)
+                    {
+#ifdef MADV_SEQUENTIAL
+                        ::madvise(view, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+#endif
+
+                        data_ = static_cast<const char *>(view);
+
+                        size_ = static_cast<std::size_t>(status.st_size);
+
+                        open_ = true;
+
+                        mapped_ = true;
+
+                        ret = true;
+                    }
+                }
+            }
+
+            /* The mapping stays valid after the file descriptor is closed. */
+            ::close(file);
+        }
+#else
+        HTD_UNUSED(path)
+#endif
+
+        return ret;
+    }
+
+    /**
+     *  Read the complete content of the file into the internal buffer.
+     *
+     *  @param[in] path The path to the file which shall be read.
+     */
+    void read(const std::string & path)
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+        if (stream.good())
+        {
+            buffer_.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+            data_ = buffer_.data();
+
+            size_ = buffer_.size();
+
+            open_ = true;
+        }
+    }
+};
+
+htd_io::MemoryMappedFile::MemoryMappedFile(const std::string & path) : implementation_(new Implementation(path))
+{
+
+}
+
+htd_io::MemoryMappedFile::~MemoryMappedFile()
+{
+
+}
+
+bool htd_io::MemoryMappedFile::isOpen(void) const
+{
+    return implementation_->open_;
+}
+
+bool htd_io::MemoryMappedFile::isMapped(void) const
+{
+    return implementation_->mapped_;
+}
+
+const char * htd_io::MemoryMappedFile::data(void) const
+{
+    return implementation_->data_;
+}
+
+std::size_t htd_io::MemoryMappedFile::size(void) const
+{
+    return implementation_->size_;
+}
+
+#endif /* HTD_IO_MEMORYMAPPEDFILE_CPP */
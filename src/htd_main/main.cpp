@@ -31,6 +31,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
@@ -66,6 +67,7 @@ htd_cli::OptionManager * createOptionManager(void)
         inputFormatChoice->addPossibility("gr", "Use the input format 'gr'.");
         inputFormatChoice->addPossibility("lp", "Use the input format 'lp'.");
         inputFormatChoice->addPossibility("hgr", "Use the input format 'hgr'.");
+        inputFormatChoice->addPossibility("bin", "Use the binary graph format 'bin'.");
 
         inputFormatChoice->setDefaultValue("gr");
 
@@ -75,6 +77,14 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(inputFileOption, "Input-Specific Options");
 
+        htd_cli::SingleValueOption * parserThreadOption = new htd_cli::SingleValueOption("parser-threads", "Parse the file given by option --instance in formats 'gr' and 'hgr' with <count> worker threads (0 = number of hardware threads). (Default: 1)", "count");
+
+        manager->registerOption(parserThreadOption, "Input-Specific Options");
+
+        htd_cli::SingleValueOption * cacheOption = new htd_cli::SingleValueOption("cache", "Read the input graph from the binary cache file <file> if it exists. Otherwise, read the input graph in the format given by option --input and store it in <file> for subsequent calls. (The cache file is not updated when the input graph changes.)", "file");
+
+        manager->registerOption(cacheOption, "Input-Specific Options");
+
         htd_cli::Choice * outputFormatChoice = new htd_cli::Choice("output", "Set the output format of the decomposition to <format>.\n  (See https://github.com/mabseher/htd/blob/master/FORMATS.md for information about the available output formats.)", "format");
 
         outputFormatChoice->addPossibility("td", "Use the output format 'td'.");
@@ -122,10 +132,39 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(preprocessingChoice, "Algorithm Options");
 
-        htd_cli::Option * triangulationMinimizationOption = new htd_cli::Option("triangulation-minimization", "Apply triangulation minimization approach.");
+        htd_cli::SingleValueOption * cliqueSeparatorLimitOption = new htd_cli::SingleValueOption("clique-separator-limit", "Split the input graph along its clique minimal separators only if at most <count> vertices remain after the other preprocessing steps (0 = never). (Default: 1024)", "count");
+
+        manager->registerOption(cliqueSeparatorLimitOption, "Algorithm Options");
+
+        htd_cli::Option * triangulationMinimizationOption = new htd_cli::Option("triangulation-minimization", "Apply triangulation minimization approach. (Default for strategies based on vertex elimination orderings)");
 
         manager->registerOption(triangulationMinimizationOption, "Algorithm Options");
 
+        htd_cli::Option * noTriangulationMinimizationOption = new htd_cli::Option("no-triangulation-minimization", "Do not apply triangulation minimization approach.");
+
+        manager->registerOption(noTriangulationMinimizationOption, "Algorithm Options");
+
+        htd_cli::SingleValueOption * componentThreadOption = new htd_cli::SingleValueOption("component-threads", "Decompose the connected components of the input graph independently using <count> worker threads (0 = number of hardware threads).", "count");
+
+        manager->registerOption(componentThreadOption, "Algorithm Options");
+
+        htd_cli::SingleValueOption * separatorThreadOption = new htd_cli::SingleValueOption("separator-threads", "Evaluate the candidate separators of strategy 'min-separator' using <count> worker threads (0 = number of hardware threads). (Default: 1)", "count");
+
+        manager->registerOption(separatorThreadOption, "Algorithm Options");
+
+        htd_cli::SingleValueOption * coverThreadOption = new htd_cli::SingleValueOption("cover-threads", "Compute the covering edges of the bags of hypertree decompositions using <count> worker threads (0 = number of hardware threads). (Default: 1)", "count");
+
+        manager->registerOption(coverThreadOption, "Algorithm Options");
+
+        htd_cli::Choice * setCoverChoice = new htd_cli::Choice("set-cover", "Set the set-cover algorithm which shall be used to compute the covering edges of hypertree decompositions to <algorithm>.", "algorithm");
+
+        setCoverChoice->addPossibility("greedy", "Greedy set-cover algorithm");
+        setCoverChoice->addPossibility("branch-and-bound", "Branch-and-bound set-cover algorithm with a greedy fallback");
+
+        setCoverChoice->setDefaultValue("greedy");
+
+        manager->registerOption(setCoverChoice, "Algorithm Options");
+
         htd_cli::Choice * optimizationChoice = new htd_cli::Choice("opt", "Iteratively compute a decomposition which optimizes <criterion>.", "criterion");
 
         optimizationChoice->addPossibility("none", "Do not perform any optimization.");
@@ -142,6 +181,10 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * threadOption = new htd_cli::SingleValueOption("threads", "Set the number of worker threads used during optimization to <count> (0 = number of hardware threads). (Default: 1)", "count");
+
+        manager->registerOption(threadOption, "Optimization Options");
     }
     catch (const std::runtime_error & exception)
     {
@@ -184,14 +227,36 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & instanceOption = optionManager.accessSingleValueOption("instance");
 
+    const htd_cli::SingleValueOption & parserThreadOption = optionManager.accessSingleValueOption("parser-threads");
+
+    const htd_cli::SingleValueOption & cacheOption = optionManager.accessSingleValueOption("cache");
+
+    const htd_cli::Choice & inputFormatChoice = optionManager.accessChoice("input");
+
     const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
 
     const htd_cli::SingleValueOption & iterationOption = optionManager.accessSingleValueOption("iterations");
 
     const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
 
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
+
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
+    const htd_cli::Option & noTriangulationMinimizationOption = optionManager.accessOption("no-triangulation-minimization");
+
+    const htd_cli::SingleValueOption & componentThreadOption = optionManager.accessSingleValueOption("component-threads");
+
+    const htd_cli::SingleValueOption & separatorThreadOption = optionManager.accessSingleValueOption("separator-threads");
+
+    const htd_cli::Choice & preprocessingChoice = optionManager.accessChoice("preprocessing");
+
+    const htd_cli::SingleValueOption & cliqueSeparatorLimitOption = optionManager.accessSingleValueOption("clique-separator-limit");
+
+    const htd_cli::SingleValueOption & coverThreadOption = optionManager.accessSingleValueOption("cover-threads");
+
+    const htd_cli::Choice & setCoverChoice = optionManager.accessChoice("set-cover");
+
     if (ret && helpOption.used())
     {
         std::cout << "VERSION: htd_main " << htd_version() << std::endl << std::endl;
@@ -237,13 +302,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 }
                 else
                 {
-                    srand(seed);
+                    htd::seedRandomNumberGenerator(static_cast<std::uint_fast32_t>(seed));
                 }
             }
         }
         else
         {
-            srand(static_cast<unsigned int>(time(NULL)));
+            htd::seedRandomNumberGenerator(static_cast<std::uint_fast32_t>(time(NULL)));
         }
     }
 
@@ -262,6 +327,43 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret && parserThreadOption.used())
+    {
+        if (instanceOption.used())
+        {
+            const std::string & value = parserThreadOption.value();
+
+            if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+            {
+                std::cerr << "INVALID NUMBER OF PARSER THREADS: " << value << std::endl;
+
+                ret = false;
+            }
+        }
+        else
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --parser-threads may only be used in combination with option --instance!" << std::endl;
+
+            ret = false;
+        }
+    }
+
+    if (ret && cacheOption.used())
+    {
+        if (inputFormatChoice.used() && std::string(inputFormatChoice.value()) == "bin")
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --cache may not be used when option --input is set to \"bin\"!" << std::endl;
+
+            ret = false;
+        }
+        else if (std::string(cacheOption.value()).empty())
+        {
+            std::cerr << "INVALID CACHE FILE: " << cacheOption.value() << std::endl;
+
+            ret = false;
+        }
+    }
+
     if (ret && strategyChoice.used())
     {
         const std::string & value = strategyChoice.value();
@@ -412,7 +514,236 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
-    if (ret && triangulationMinimizationOption.used())
+    if (ret)
+    {
+        if (threadOption.used())
+        {
+            if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
+            {
+                std::size_t index = 0;
+
+                const std::string & value = threadOption.value();
+
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << threadOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::stoul(value, &index, 10);
+
+                    if (index != value.length())
+                    {
+                        std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --threads may only be used when option --opt is set to \"width\"!" << std::endl;
+
+                ret = false;
+            }
+        }
+    }
+
+    if (ret && componentThreadOption.used())
+    {
+        if ((optimizationChoice.used() && std::string(optimizationChoice.value()) == "width") ||
+            (decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree"))
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --component-threads may only be used for tree decompositions when option --opt is set to \"none\"!" << std::endl;
+
+            ret = false;
+        }
+        else
+        {
+            std::size_t index = 0;
+
+            const std::string & value = componentThreadOption.value();
+
+            if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+            {
+                std::cerr << "INVALID NUMBER OF THREADS: " << componentThreadOption.value() << std::endl;
+
+                ret = false;
+            }
+
+            if (ret)
+            {
+                std::stoul(value, &index, 10);
+
+                if (index != value.length())
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                    ret = false;
+                }
+            }
+        }
+    }
+
+    if (ret && cliqueSeparatorLimitOption.used())
+    {
+        if (!preprocessingChoice.used() || std::string(preprocessingChoice.value()) != "full")
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --clique-separator-limit may only be used when option --preprocessing is set to \"full\"!" << std::endl;
+
+            ret = false;
+        }
+        else
+        {
+            std::size_t index = 0;
+
+            const std::string & value = cliqueSeparatorLimitOption.value();
+
+            if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+            {
+                std::cerr << "INVALID CLIQUE SEPARATOR LIMIT: " << value << std::endl;
+
+                ret = false;
+            }
+
+            if (ret)
+            {
+                std::stoul(value, &index, 10);
+
+                if (index != value.length())
+                {
+                    std::cerr << "INVALID CLIQUE SEPARATOR LIMIT: " << value << std::endl;
+
+                    ret = false;
+                }
+            }
+        }
+    }
+
+    if (ret && separatorThreadOption.used())
+    {
+        if (!strategyChoice.used() || std::string(strategyChoice.value()) != "min-separator")
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --separator-threads may only be used when option --strategy is set to \"min-separator\"!" << std::endl;
+
+            ret = false;
+        }
+        else
+        {
+            std::size_t index = 0;
+
+            const std::string & value = separatorThreadOption.value();
+
+            if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+            {
+                std::cerr << "INVALID NUMBER OF THREADS: " << separatorThreadOption.value() << std::endl;
+
+                ret = false;
+            }
+
+            if (ret)
+            {
+                std::size_t threadCount = std::stoul(value, &index, 10);
+
+                if (index != value.length())
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                    ret = false;
+                }
+                else
+                {
+                    htd::MinimumSeparatorAlgorithm * separatorAlgorithm = new htd::MinimumSeparatorAlgorithm(manager);
+
+                    separatorAlgorithm->setThreadCount(threadCount);
+
+                    manager->graphSeparatorAlgorithmFactory().setConstructionTemplate(separatorAlgorithm);
+                }
+            }
+        }
+    }
+
+    if (ret && coverThreadOption.used())
+    {
+        if (!decompositionTypeChoice.used() || std::string(decompositionTypeChoice.value()) != "hypertree")
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --cover-threads may only be used when option --type is set to \"hypertree\"!" << std::endl;
+
+            ret = false;
+        }
+        else
+        {
+            std::size_t index = 0;
+
+            const std::string & value = coverThreadOption.value();
+
+            if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+            {
+                std::cerr << "INVALID NUMBER OF THREADS: " << coverThreadOption.value() << std::endl;
+
+                ret = false;
+            }
+
+            if (ret)
+            {
+                std::size_t threadCount = std::stoul(value, &index, 10);
+
+                if (index != value.length())
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                    ret = false;
+                }
+                else
+                {
+                    htd::HypertreeDecompositionAlgorithm * hypertreeDecompositionAlgorithm = new htd::HypertreeDecompositionAlgorithm(manager);
+
+                    hypertreeDecompositionAlgorithm->setThreadCount(threadCount);
+
+                    manager->hypertreeDecompositionAlgorithmFactory().setConstructionTemplate(hypertreeDecompositionAlgorithm);
+                }
+            }
+        }
+    }
+
+    if (ret && setCoverChoice.used())
+    {
+        const std::string & value = setCoverChoice.value();
+
+        if (!decompositionTypeChoice.used() || std::string(decompositionTypeChoice.value()) != "hypertree")
+        {
+            std::cerr << "INVALID PROGRAM CALL: Option --set-cover may only be used when option --type is set to \"hypertree\"!" << std::endl;
+
+            ret = false;
+        }
+        else if (value == "greedy")
+        {
+            manager->setCoverAlgorithmFactory().setConstructionTemplate(new htd::IndexedGreedySetCoverAlgorithm(manager));
+        }
+        else if (value == "branch-and-bound")
+        {
+            manager->setCoverAlgorithmFactory().setConstructionTemplate(new htd::BranchAndBoundSetCoverAlgorithm(manager));
+        }
+        else
+        {
+            std::cerr << "INVALID SET-COVER ALGORITHM: " << value << std::endl;
+
+            ret = false;
+        }
+    }
+
+    if (ret && triangulationMinimizationOption.used() && noTriangulationMinimizationOption.used())
+    {
+        std::cerr << "INVALID PROGRAM CALL: Options --triangulation-minimization and --no-triangulation-minimization may not be used together!" << std::endl;
+
+        ret = false;
+    }
+
+    /* Triangulation minimization only removes fill edges, hence it is applied by default whenever a vertex elimination ordering is used. */
+    if (ret && !noTriangulationMinimizationOption.used() && !(strategyChoice.used() && std::string(strategyChoice.value()) == "min-separator"))
     {
         htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
             new htd::TriangulationMinimizationOrderingAlgorithm(libraryInstance);
@@ -545,15 +876,40 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
 
         decompose(*manager, algorithm, importer.import(std::cin), exporter);
     }
+    else if (inputFormat == "bin")
+    {
+        htd_io::BinFormatImporter importer(manager);
+
+        std::stringstream content(std::ios::in | std::ios::out | std::ios::binary);
+
+        content << std::cin.rdbuf();
+
+        htd::NamedMultiHypergraph<std::string, std::string> * graph = importer.importNamed(content);
+
+        if (graph != nullptr)
+        {
+            decomposeNamed(*manager, algorithm, graph, exporter);
+        }
+        else
+        {
+            content.clear();
+
+            content.seekg(0);
+
+            decompose(*manager, algorithm, importer.import(content), exporter);
+        }
+    }
 }
 
 template <typename DecompositionAlgorithm, typename Exporter>
-void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, const std::string & inputFormat, const htd::LibraryInstance * const manager, const std::string & instanceFile)
+void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, const std::string & inputFormat, const htd::LibraryInstance * const manager, const std::string & instanceFile, std::size_t parserThreadCount)
 {
     if (inputFormat == "gr")
     {
         htd_io::GrFormatImporter importer(manager);
 
+        importer.setThreadCount(parserThreadCount);
+
         decompose(*manager, algorithm, importer.import(instanceFile), exporter);
     }
     else if (inputFormat == "lp")
@@ -566,8 +922,96 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
+        importer.setThreadCount(parserThreadCount);
+
         decompose(*manager, algorithm, importer.import(instanceFile), exporter);
     }
+    else if (inputFormat == "bin")
+    {
+        htd_io::BinFormatImporter importer(manager);
+
+        if (importer.isNamed(instanceFile))
+        {
+            decomposeNamed(*manager, algorithm, importer.importNamed(instanceFile), exporter);
+        }
+        else
+        {
+            decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+        }
+    }
+}
+
+bool createCache(const std::string & inputFormat, const htd::LibraryInstance * const manager, const std::string & instanceFile, std::size_t parserThreadCount, const std::string & cacheFile)
+{
+    bool ret = false;
+
+    bool valid = false;
+
+    htd_io::BinFormatGraphExporter exporter;
+
+    if (inputFormat == "lp")
+    {
+        htd_io::LpFormatImporter importer(manager);
+
+        htd::NamedMultiHypergraph<std::string, std::string> * graph = instanceFile.empty() ? importer.import(std::cin) : importer.import(instanceFile);
+
+        if (graph != nullptr)
+        {
+            valid = !manager->isTerminated();
+
+            ret = valid && exporter.write(*graph, cacheFile);
+
+            delete graph;
+        }
+    }
+    else
+    {
+        htd::IMultiHypergraph * graph = nullptr;
+
+        if (inputFormat == "gr")
+        {
+            htd_io::GrFormatImporter importer(manager);
+
+            importer.setThreadCount(parserThreadCount);
+
+            graph = instanceFile.empty() ? importer.import(std::cin) : importer.import(instanceFile);
+        }
+        else if (inputFormat == "hgr")
+        {
+            htd_io::HgrFormatImporter importer(manager);
+
+            importer.setThreadCount(parserThreadCount);
+
+            graph = instanceFile.empty() ? importer.import(std::cin) : importer.import(instanceFile);
+        }
+
+        if (graph != nullptr)
+        {
+            valid = !manager->isTerminated();
+
+            ret = valid && exporter.write(*graph, cacheFile);
+
+            delete graph;
+        }
+    }
+
+    if (!ret)
+    {
+        if (manager->isTerminated())
+        {
+            std::cerr << "Program was terminated successfully!" << std::endl;
+        }
+        else if (!valid)
+        {
+            std::cerr << "NO VALID INSTANCE PROVIDED!" << std::endl;
+        }
+        else
+        {
+            std::cerr << "COULD NOT WRITE CACHE FILE: " << cacheFile << std::endl;
+        }
+    }
+
+    return ret;
 }
 
 void handleSignal(int signal)
@@ -626,6 +1070,36 @@ int main(int argc, const char * const * const argv)
 
         const htd_cli::SingleValueOption & patienceOption = optionManager->accessSingleValueOption("patience");
 
+        const htd_cli::SingleValueOption & threadOption = optionManager->accessSingleValueOption("threads");
+
+        const htd_cli::SingleValueOption & cliqueSeparatorLimitOption = optionManager->accessSingleValueOption("clique-separator-limit");
+
+        const htd_cli::SingleValueOption & parserThreadOption = optionManager->accessSingleValueOption("parser-threads");
+
+        const htd_cli::SingleValueOption & componentThreadOption = optionManager->accessSingleValueOption("component-threads");
+
+        std::size_t parserThreadCount = parserThreadOption.used() ? std::stoul(parserThreadOption.value(), nullptr, 10) : 1;
+
+        const htd_cli::SingleValueOption & cacheOption = optionManager->accessSingleValueOption("cache");
+
+        std::string inputFormat = inputFormatChoice.value();
+
+        std::string instanceFile = instanceOption.used() ? instanceOption.value() : "";
+
+        if (cacheOption.used())
+        {
+            htd_io::BinFormatImporter importer(libraryInstance);
+
+            if (!importer.isValid(cacheOption.value()))
+            {
+                error = !createCache(inputFormat, libraryInstance, instanceFile, parserThreadCount, cacheOption.value());
+            }
+
+            inputFormat = "bin";
+
+            instanceFile = cacheOption.value();
+        }
+
         const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
 
         const std::string & outputFormat = outputFormatChoice.value();
@@ -655,6 +1129,22 @@ int main(int argc, const char * const * const argv)
             decompAlgorithm = treeDecompositionAlgorithm;
         }
 
+        if (componentThreadOption.used())
+        {
+            htd::ConnectedComponentTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::ConnectedComponentTreeDecompositionAlgorithm(libraryInstance);
+
+            /* The decomposition strategy is selected explicitly via the command-line, hence it is used for components of any size. */
+            treeDecompositionAlgorithm->setDecompositionAlgorithm(decompAlgorithm->clone());
+
+            treeDecompositionAlgorithm->setSmallComponentDecompositionAlgorithm(decompAlgorithm);
+
+            treeDecompositionAlgorithm->setThreadCount(std::stoul(componentThreadOption.value(), nullptr, 10));
+
+            treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+
+            decompAlgorithm = treeDecompositionAlgorithm;
+        }
+
         if (hypertreeDecompositionRequested)
         {
             htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
@@ -678,13 +1168,13 @@ int main(int argc, const char * const * const argv)
 
             if (!error)
             {
-                if (instanceOption.used())
+                if (!instanceFile.empty())
                 {
-                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance, instanceOption.value());
+                    run(*algorithm, *exporter, inputFormat, libraryInstance, instanceFile, parserThreadCount);
                 }
                 else
                 {
-                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance);
+                    run(*algorithm, *exporter, inputFormat, libraryInstance);
                 }
 
                 delete exporter;
@@ -817,9 +1307,19 @@ int main(int argc, const char * const * const argv)
                             }
                         }
 
+                        if (threadOption.used())
+                        {
+                            baseAlgorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+                        }
+
                         algorithm->addDecompositionAlgorithm(baseAlgorithm);
                     }
 
+                    if (threadOption.used())
+                    {
+                        algorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+                    }
+
                     algorithm->setComputeInducedEdgesEnabled(false);
 
                     decompAlgorithm=algorithm;
@@ -856,25 +1356,47 @@ int main(int argc, const char * const * const argv)
 
                     preprocessor->setIterationCount(256);
                     preprocessor->setNonImprovementLimit(64);
+
+                    if (threadOption.used())
+                    {
+                        preprocessor->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+                    }
+
+                    if (cliqueSeparatorLimitOption.used())
+                    {
+                        preprocessor->setCliqueSeparatorVertexLimit(std::stoul(cliqueSeparatorLimitOption.value(), nullptr, 10));
+                    }
                 }
 
                 htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
 
-                if (std::string(inputFormatChoice.value()) == "gr")
+                if (inputFormat == "gr")
                 {
-                    processor = new htd_io::GrFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                    htd_io::GrFormatGraphToTreeDecompositionProcessor * grProcessor = new htd_io::GrFormatGraphToTreeDecompositionProcessor(libraryInstance);
+
+                    grProcessor->setParserThreadCount(parserThreadCount);
+
+                    processor = grProcessor;
                 }
-                else if (std::string(inputFormatChoice.value()) == "hgr")
+                else if (inputFormat == "hgr")
                 {
-                    processor = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                    htd_io::HgrFormatGraphToTreeDecompositionProcessor * hgrProcessor = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(libraryInstance);
+
+                    hgrProcessor->setParserThreadCount(parserThreadCount);
+
+                    processor = hgrProcessor;
                 }
-                else if (std::string(inputFormatChoice.value()) == "lp")
+                else if (inputFormat == "lp")
                 {
                     processor = new htd_io::LpFormatGraphToTreeDecompositionProcessor(libraryInstance);
                 }
+                else if (inputFormat == "bin")
+                {
+                    processor = new htd_io::BinFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                }
                 else
                 {
-                    std::cerr << "INVALID INPUT FORMAT: " << inputFormatChoice.value() << std::endl;
+                    std::cerr << "INVALID INPUT FORMAT: " << inputFormat << std::endl;
 
                     std::exit(1);
                 }
@@ -1014,9 +1536,9 @@ int main(int argc, const char * const * const argv)
                     });
                 }
 
-                if (instanceOption.used())
+                if (!instanceFile.empty())
                 {
-                    processor->process(instanceOption.value(), std::cout);
+                    processor->process(instanceFile, std::cout);
                 }
                 else
                 {
@@ -533,6 +533,80 @@ TEST(BucketEliminationGraphDecompositionAlgorithmTest, CheckResultSimpleGraphWit
     delete libraryInstance;
 }
 
+TEST(BucketEliminationGraphDecompositionAlgorithmTest, CheckResultParallelInducedEdges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(600);
+
+    for (htd::vertex_t vertex = 1; vertex <= 600; ++vertex)
+    {
+        graph.addEdge(vertex, (vertex % 600) + 1);
+        graph.addEdge(std::vector<htd::vertex_t> { vertex, ((vertex + 2) % 600) + 1, ((vertex + 36) % 600) + 1 });
+        graph.addEdge(((vertex + 36) % 600) + 1, vertex);
+
+        if (vertex % 5 == 0)
+        {
+            graph.addEdge(std::vector<htd::vertex_t> { vertex });
+        }
+    }
+
+    htd::BucketEliminationGraphDecompositionAlgorithm sequentialAlgorithm(libraryInstance);
+
+    htd::BucketEliminationGraphDecompositionAlgorithm parallelAlgorithm(libraryInstance);
+
+    parallelAlgorithm.setThreadCount(3);
+
+    ASSERT_EQ(sequentialAlgorithm.threadCount(), (std::size_t)1);
+    ASSERT_EQ(parallelAlgorithm.threadCount(), (std::size_t)3);
+
+    htd::BucketEliminationGraphDecompositionAlgorithm * clonedAlgorithm = parallelAlgorithm.clone();
+
+    ASSERT_EQ(clonedAlgorithm->threadCount(), (std::size_t)3);
+
+    htd::seedRandomNumberGenerator(42);
+
+    htd::IGraphDecomposition * sequentialDecomposition = sequentialAlgorithm.computeDecomposition(graph);
+
+    htd::seedRandomNumberGenerator(42);
+
+    htd::IGraphDecomposition * parallelDecomposition = clonedAlgorithm->computeDecomposition(graph);
+
+    ASSERT_NE(sequentialDecomposition, nullptr);
+    ASSERT_NE(parallelDecomposition, nullptr);
+
+    ASSERT_EQ(sequentialDecomposition->vertexCount(), parallelDecomposition->vertexCount());
+
+    for (htd::vertex_t vertex : parallelDecomposition->vertices())
+    {
+        ASSERT_EQ(sequentialDecomposition->bagContent(vertex), parallelDecomposition->bagContent(vertex));
+
+        std::vector<htd::id_t> sequentialInducedEdges;
+        std::vector<htd::id_t> parallelInducedEdges;
+
+        for (const htd::Hyperedge & hyperedge : sequentialDecomposition->inducedHyperedges(vertex))
+        {
+            sequentialInducedEdges.push_back(hyperedge.id());
+        }
+
+        for (const htd::Hyperedge & hyperedge : parallelDecomposition->inducedHyperedges(vertex))
+        {
+            parallelInducedEdges.push_back(hyperedge.id());
+        }
+
+        ASSERT_EQ(sequentialInducedEdges, parallelInducedEdges);
+    }
+
+    delete sequentialDecomposition;
+    delete parallelDecomposition;
+
+    delete clonedAlgorithm;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
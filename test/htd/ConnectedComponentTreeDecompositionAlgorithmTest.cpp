@@ -0,0 +1,331 @@
+/*
+ * File:   ConnectedComponentTreeDecompositionAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+class ConnectedComponentTreeDecompositionAlgorithmTest : public ::testing::Test
+{
+    public:
+        ConnectedComponentTreeDecompositionAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ConnectedComponentTreeDecompositionAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Create a graph consisting of the given number of components, each of them being a grid with a random number of rows and columns.
+ */
+void createGridComponents(htd::MultiHypergraph & graph, std::size_t componentCount, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+
+    std::uniform_int_distribution<std::size_t> distribution(1, 8);
+
+    for (std::size_t component = 0; component < componentCount; ++component)
+    {
+        std::size_t rows = distribution(generator);
+        std::size_t columns = distribution(generator);
+
+        htd::vertex_t first = graph.addVertices(rows * columns);
+
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            for (std::size_t column = 0; column < columns; ++column)
+            {
+                htd::vertex_t vertex = first + row * columns + column;
+
+                if (column + 1 < columns)
+                {
+                    graph.addEdge(vertex, vertex + 1);
+                }
+
+                if (row + 1 < rows)
+                {
+                    graph.addEdge(vertex, vertex + columns);
+                }
+            }
+        }
+    }
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->edgeCount(), (std::size_t)0);
+
+    EXPECT_EQ(decomposition->bagSize(decomposition->root()), (std::size_t)0);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultConnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+    graph.addEdge(vertex2, vertex3);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)2);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+    htd::vertex_t vertex4 = graph.addVertex();
+    htd::vertex_t vertex5 = graph.addVertex();
+    htd::vertex_t vertex6 = graph.addVertex();
+    htd::vertex_t vertex7 = graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+    graph.addEdge(vertex2, vertex3);
+    graph.addEdge(std::vector<htd::vertex_t> { vertex4, vertex5, vertex6 });
+    graph.addEdge(vertex4, vertex6);
+    graph.addEdge(vertex7, vertex7);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(2);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    EXPECT_EQ(decomposition->bagSize(decomposition->root()), (std::size_t)0);
+
+    EXPECT_EQ(decomposition->childCount(decomposition->root()), (std::size_t)3);
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)3);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    std::unordered_set<htd::id_t> inducedEdges;
+
+    for (htd::vertex_t node : decomposition->vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(node);
+
+        for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(node))
+        {
+            for (htd::vertex_t vertex : hyperedge)
+            {
+                ASSERT_TRUE(std::binary_search(bag.begin(), bag.end(), vertex));
+            }
+
+            inducedEdges.insert(hyperedge.id());
+        }
+    }
+
+    EXPECT_EQ(inducedEdges.size(), graph.edgeCount());
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultIndependentOfThreadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createGridComponents(graph, 64, 7);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setSmallComponentSizeLimit(16);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd::seedRandomNumberGenerator(1);
+
+    htd::ITreeDecomposition * decomposition1 = algorithm.computeDecomposition(graph);
+
+    algorithm.setThreadCount(4);
+
+    htd::seedRandomNumberGenerator(1);
+
+    htd::ITreeDecomposition * decomposition2 = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition1, nullptr);
+    ASSERT_NE(decomposition2, nullptr);
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition1));
+    ASSERT_TRUE(verifier.verify(graph, *decomposition2));
+
+    ASSERT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+
+    EXPECT_EQ(decomposition1->maximumBagSize(), decomposition2->maximumBagSize());
+
+    for (htd::vertex_t node : decomposition1->vertices())
+    {
+        EXPECT_EQ(decomposition1->bagContent(node), decomposition2->bagContent(node));
+
+        EXPECT_EQ(decomposition1->parent(node), decomposition2->parent(node));
+    }
+
+    delete decomposition1;
+    delete decomposition2;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultPreprocessedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createGridComponents(graph, 32, 11);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(2);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(0);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph, 1, new htd::NormalizationOperation(libraryInstance));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(ConnectedComponentTreeDecompositionAlgorithmTest, CheckResultDisconnectedPreprocessedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 3);
+    graph.addEdge(4, 5);
+    graph.addEdge(4, 6);
+    graph.addEdge(5, 6);
+    graph.addEdge(3, 7);
+    graph.addEdge(7, 4);
+
+    /* Vertex 7 was eliminated during preprocessing, so the two triangles remain connected only via the input graph. */
+    htd::PreprocessedGraph preprocessedGraph(std::vector<htd::vertex_t> { 1, 2, 3, 4, 5, 6, 7 },
+                                             std::vector<std::vector<htd::vertex_t>> { { 1, 2 }, { 0, 2 }, { 0, 1 }, { 4, 5 }, { 3, 5 }, { 3, 4 }, { } },
+                                             std::vector<htd::vertex_t> { 7 },
+                                             std::vector<htd::vertex_t> { 0, 1, 2, 3, 4, 5 },
+                                             8, 2);
+
+    htd::ConnectedComponentTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(2);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, preprocessedGraph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)3);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
@@ -0,0 +1,141 @@
+/*
+ * File:   DenseIdentifierMapTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+class DenseIdentifierMapTest : public ::testing::Test
+{
+    public:
+        DenseIdentifierMapTest(void)
+        {
+
+        }
+
+        virtual ~DenseIdentifierMapTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(DenseIdentifierMapTest, CheckInsertionAndRemoval)
+{
+    htd::DenseIdentifierMap<std::vector<htd::vertex_t>> map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ((std::size_t)0, map.size());
+    ASSERT_EQ((std::size_t)0, map.count(1));
+
+    ASSERT_TRUE(map.emplace(1, std::vector<htd::vertex_t> { 1, 2 }));
+    ASSERT_TRUE(map.emplace(5, std::vector<htd::vertex_t> { 3 }));
+    ASSERT_FALSE(map.emplace(5, std::vector<htd::vertex_t> { 4 }));
+
+    ASSERT_EQ((std::size_t)2, map.size());
+    ASSERT_EQ((std::size_t)1, map.count(5));
+    ASSERT_EQ((std::size_t)0, map.count(3));
+    ASSERT_EQ((std::size_t)0, map.count(100));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), map.at(1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3 }), map.at(5));
+
+    map[3].push_back(7);
+
+    ASSERT_EQ((std::size_t)3, map.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 7 }), map.at(3));
+
+    ASSERT_EQ((std::size_t)1, map.erase(1));
+    ASSERT_EQ((std::size_t)0, map.erase(1));
+
+    ASSERT_EQ((std::size_t)2, map.size());
+    ASSERT_EQ((std::size_t)0, map.count(1));
+
+    const htd::DenseIdentifierMap<std::vector<htd::vertex_t>> & constMap = map;
+
+    ASSERT_THROW(map.at(1), std::out_of_range);
+    ASSERT_THROW(map.at(100), std::out_of_range);
+    ASSERT_THROW(constMap.at(1), std::out_of_range);
+    ASSERT_THROW(constMap.at(100), std::out_of_range);
+
+    ASSERT_TRUE(map.emplace(8));
+
+    ASSERT_TRUE(map.at(8).empty());
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ((std::size_t)0, map.count(5));
+}
+
+TEST(DenseIdentifierMapTest, CheckReferenceStability)
+{
+    htd::DenseIdentifierMap<std::vector<htd::vertex_t>> map;
+
+    map.emplace(1, std::vector<htd::vertex_t> { 1 });
+
+    std::vector<htd::vertex_t> & value = map.at(1);
+
+    for (htd::id_t identifier = 2; identifier <= 10000; ++identifier)
+    {
+        map.emplace(identifier, std::vector<htd::vertex_t> { identifier });
+
+        if (identifier % 2 == 0 && identifier > 2)
+        {
+            map.erase(identifier - 1);
+        }
+    }
+
+    ASSERT_EQ(&value, &(map.at(1)));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1 }), value);
+
+    for (htd::id_t identifier = 2; identifier <= 10000; ++identifier)
+    {
+        ASSERT_EQ((std::size_t)(identifier % 2 == 0 ? 1 : 0), map.count(identifier));
+
+        if (map.count(identifier) == 1)
+        {
+            ASSERT_EQ(std::vector<htd::vertex_t>({ identifier }), map.at(identifier));
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
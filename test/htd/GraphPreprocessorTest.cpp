@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <memory>
 #include <vector>
 
 class GraphPreprocessorTest : public ::testing::Test
@@ -1457,6 +1458,293 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+TEST(GraphPreprocessorTest, CheckAdjacencyArray)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(2, 6);
+    graph.addEdge(3, 4);
+    graph.addEdge(3, 7);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    std::shared_ptr<const htd::AdjacencyArray> adjacencyArrayPointer = preprocessedGraph->adjacencyArray();
+
+    ASSERT_EQ(adjacencyArrayPointer, preprocessedGraph->adjacencyArray());
+
+    const htd::AdjacencyArray & adjacencyArray = *adjacencyArrayPointer;
+
+    ASSERT_EQ(preprocessedGraph->neighborhood().size(), adjacencyArray.vertexCount());
+    ASSERT_EQ(2 * graph.edgeCount(), adjacencyArray.targetCount());
+
+    for (htd::vertex_t vertex = 0; vertex < adjacencyArray.vertexCount(); ++vertex)
+    {
+        std::vector<htd::vertex_t> neighborhood(adjacencyArray.begin(vertex), adjacencyArray.end(vertex));
+
+        ASSERT_EQ(preprocessedGraph->neighborhood(vertex), neighborhood);
+        ASSERT_EQ(neighborhood.size(), adjacencyArray.neighborCount(vertex));
+    }
+
+    htd::NeighborhoodWorkingSet workingSet(adjacencyArray);
+
+    ASSERT_FALSE(workingSet.isModified(1));
+    ASSERT_EQ(adjacencyArray.begin(1), workingSet.begin(1));
+
+    std::vector<htd::vertex_t> & modifiedNeighborhood = workingSet[1];
+
+    ASSERT_TRUE(workingSet.isModified(1));
+    ASSERT_EQ(preprocessedGraph->neighborhood(1), modifiedNeighborhood);
+
+    modifiedNeighborhood.clear();
+
+    ASSERT_EQ((std::size_t)0, workingSet.size(1));
+    ASSERT_EQ(preprocessedGraph->neighborhood(1).size(), adjacencyArray.neighborCount(1));
+    ASSERT_EQ(preprocessedGraph->neighborhood(2).size(), workingSet.size(2));
+    ASSERT_FALSE(workingSet.isModified(2));
+
+    htd::PreprocessedGraph copiedGraph(std::vector<htd::vertex_t>(preprocessedGraph->vertexNames()),
+                                       std::vector<std::vector<htd::vertex_t>>(preprocessedGraph->neighborhood()),
+                                       std::vector<htd::vertex_t>(preprocessedGraph->eliminationSequence()),
+                                       std::vector<htd::vertex_t>(preprocessedGraph->remainingVertices()),
+                                       preprocessedGraph->inputGraphEdgeCount(),
+                                       preprocessedGraph->minTreeWidth());
+
+    ASSERT_EQ(adjacencyArray.targets(), copiedGraph.adjacencyArray()->targets());
+    ASSERT_EQ(adjacencyArray.offsets(), copiedGraph.adjacencyArray()->offsets());
+
+    std::shared_ptr<const htd::AdjacencyArray> copiedAdjacencyArray = copiedGraph.adjacencyArray();
+
+    copiedGraph.removeVertex(1);
+
+    // An adjacency array obtained before the modification remains valid and unchanged.
+    ASSERT_EQ(adjacencyArray.targets(), copiedAdjacencyArray->targets());
+    ASSERT_EQ(adjacencyArray.offsets(), copiedAdjacencyArray->offsets());
+
+    ASSERT_NE(copiedAdjacencyArray, copiedGraph.adjacencyArray());
+
+    ASSERT_EQ(adjacencyArray.targetCount() - 2 * preprocessedGraph->neighborhood(1).size(), copiedGraph.adjacencyArray()->targetCount());
+    ASSERT_EQ((std::size_t)0, copiedGraph.adjacencyArray()->neighborCount(1));
+
+    delete libraryInstance;
+    delete preprocessedGraph;
+}
+
+TEST(GraphPreprocessorTest, CheckPathContractionCascade)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 100);
+
+    for (htd::vertex_t vertex = 1; vertex <= 50; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 50);
+
+        if (vertex < 50)
+        {
+            graph.addEdge(vertex, vertex + 1);
+            graph.addEdge(vertex + 50, vertex + 51);
+        }
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    // Contracting a corner of the ladder turns one of its neighbors into a vertex of degree 2, hence the whole ladder is reduced.
+    ASSERT_EQ((std::size_t)100, preprocessedGraph->eliminationSequence().size());
+    ASSERT_EQ((std::size_t)0, preprocessedGraph->remainingVertices().size());
+    ASSERT_EQ((std::size_t)2, preprocessedGraph->minTreeWidth());
+
+    std::vector<htd::vertex_t> vertices(preprocessedGraph->eliminationSequence());
+
+    std::sort(vertices.begin(), vertices.end());
+
+    ASSERT_TRUE(vertices == graph.vertexVector());
+
+    delete libraryInstance;
+    delete preprocessedGraph;
+}
+
+TEST(GraphPreprocessorTest, CheckSimplicialVertexCascade)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 40);
+
+    // Each vertex is adjacent to its four predecessors, i.e., the graph is a 4-tree without vertices of degree less than 4.
+    for (htd::vertex_t vertex = 2; vertex <= 40; ++vertex)
+    {
+        for (htd::vertex_t neighbor = vertex > 4 ? vertex - 4 : 1; neighbor < vertex; ++neighbor)
+        {
+            graph.addEdge(neighbor, vertex);
+        }
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(2);
+
+    const htd::IPreprocessedGraph * preprocessedGraph1 = preprocessor.prepare(graph);
+
+    ASSERT_EQ((std::size_t)0, preprocessedGraph1->eliminationSequence().size());
+    ASSERT_EQ((std::size_t)40, preprocessedGraph1->remainingVertices().size());
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    const htd::IPreprocessedGraph * preprocessedGraph2 = preprocessor.prepare(graph);
+
+    // Eliminating a simplicial vertex makes its most recent neighbor simplicial, hence the whole graph is reduced.
+    ASSERT_EQ((std::size_t)40, preprocessedGraph2->eliminationSequence().size());
+    ASSERT_EQ((std::size_t)0, preprocessedGraph2->remainingVertices().size());
+    ASSERT_EQ((std::size_t)4, preprocessedGraph2->minTreeWidth());
+
+    delete libraryInstance;
+    delete preprocessedGraph1;
+    delete preprocessedGraph2;
+}
+
+TEST(GraphPreprocessorTest, CheckAtomSeparation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 23);
+
+    // A complete bipartite graph K_{4,4} which is attached to the remainder of the graph via the articulation point 8.
+    for (htd::vertex_t vertex = 1; vertex <= 4; ++vertex)
+    {
+        for (htd::vertex_t neighbor = 5; neighbor <= 8; ++neighbor)
+        {
+            graph.addEdge(vertex, neighbor);
+        }
+    }
+
+    // A complete bipartite graph K_{5,5} which contains the clique separator {13, 14}.
+    for (htd::vertex_t vertex = 8; vertex <= 12; ++vertex)
+    {
+        for (htd::vertex_t neighbor = 13; neighbor <= 17; ++neighbor)
+        {
+            graph.addEdge(vertex, neighbor);
+        }
+    }
+
+    graph.addEdge(13, 14);
+
+    // A complete bipartite graph K_{3,3} which is attached to the remainder of the graph via the clique separator {13, 14}.
+    for (htd::vertex_t vertex = 18; vertex <= 20; ++vertex)
+    {
+        for (htd::vertex_t neighbor = 21; neighbor <= 23; ++neighbor)
+        {
+            graph.addEdge(vertex, neighbor);
+        }
+    }
+
+    graph.addEdge(13, 18);
+    graph.addEdge(13, 19);
+    graph.addEdge(14, 18);
+    graph.addEdge(14, 19);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    ASSERT_EQ((std::size_t)1024, preprocessor.cliqueSeparatorVertexLimit());
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    htd::seedRandomNumberGenerator(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph1 = preprocessor.prepare(graph);
+
+    preprocessor.setThreadCount(3);
+
+    htd::seedRandomNumberGenerator(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph2 = preprocessor.prepare(graph);
+
+    // Both atoms are ordered completely before any vertex of the retained part of the graph is eliminated.
+    ASSERT_EQ((std::size_t)13, preprocessedGraph1->eliminationSequence().size());
+    ASSERT_EQ((std::size_t)10, preprocessedGraph1->remainingVertices().size());
+    // The width of an atom is measured for its ordering without the separator, which is eliminated together with the retained part of the graph.
+    ASSERT_EQ((std::size_t)5, preprocessedGraph1->minTreeWidth());
+
+    std::vector<htd::vertex_t> eliminatedVertices(preprocessedGraph1->eliminationSequence());
+
+    std::sort(eliminatedVertices.begin(), eliminatedVertices.end());
+
+    std::vector<htd::vertex_t> expectedEliminatedVertices { 1, 2, 3, 4, 5, 6, 7, 18, 19, 20, 21, 22, 23 };
+
+    ASSERT_TRUE(eliminatedVertices == expectedEliminatedVertices);
+
+    for (htd::vertex_t vertex : preprocessedGraph1->remainingVertices())
+    {
+        htd::vertex_t vertexName = preprocessedGraph1->vertexName(vertex);
+
+        ASSERT_LE((htd::vertex_t)8, vertexName);
+        ASSERT_GE((htd::vertex_t)17, vertexName);
+
+        for (htd::vertex_t neighbor : preprocessedGraph1->neighborhood(vertex))
+        {
+            ASSERT_TRUE(preprocessedGraph1->isVertex(neighbor));
+        }
+    }
+
+    // The result does not depend on the number of threads used for ordering the atoms.
+    ASSERT_TRUE(preprocessedGraph1->eliminationSequence() == preprocessedGraph2->eliminationSequence());
+    ASSERT_TRUE(preprocessedGraph1->remainingVertices() == preprocessedGraph2->remainingVertices());
+    ASSERT_EQ(preprocessedGraph1->minTreeWidth(), preprocessedGraph2->minTreeWidth());
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph1);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    ASSERT_EQ((std::size_t)6, decomposition->maximumBagSize());
+
+    ASSERT_EQ(preprocessedGraph1->minTreeWidth() + 1, decomposition->maximumBagSize());
+
+    // Without clique separators, only the atom attached via the articulation point 8 is split off.
+    preprocessor.setCliqueSeparatorVertexLimit(0);
+
+    htd::GraphPreprocessor * clonedPreprocessor = preprocessor.clone();
+
+    ASSERT_EQ((std::size_t)0, clonedPreprocessor->cliqueSeparatorVertexLimit());
+
+    htd::seedRandomNumberGenerator(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph3 = clonedPreprocessor->prepare(graph);
+
+    eliminatedVertices = preprocessedGraph3->eliminationSequence();
+
+    std::sort(eliminatedVertices.begin(), eliminatedVertices.end());
+
+    expectedEliminatedVertices = { 1, 2, 3, 4, 5, 6, 7 };
+
+    ASSERT_TRUE(eliminatedVertices == expectedEliminatedVertices);
+
+    ASSERT_EQ((std::size_t)16, preprocessedGraph3->remainingVertices().size());
+
+    delete decomposition;
+    delete clonedPreprocessor;
+    delete libraryInstance;
+    delete preprocessedGraph1;
+    delete preprocessedGraph2;
+    delete preprocessedGraph3;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
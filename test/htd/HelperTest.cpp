@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 class HelperTest : public ::testing::Test
@@ -52,6 +54,22 @@ class HelperTest : public ::testing::Test
         }
 };
 
+std::vector<htd::vertex_t> createRandomSet(std::size_t size, std::size_t universeSize)
+{
+    std::vector<htd::vertex_t> ret;
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        ret.push_back(static_cast<htd::vertex_t>(htd::selectRandomIndex(universeSize) + 1));
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+
+    return ret;
+}
+
 TEST(HelperTest, CheckAssemblyInfo)
 {
     std::string version = htd_version();
@@ -589,6 +607,61 @@ TEST(HelperTest, CheckSetIntersectionSize2)
     ASSERT_EQ((std::size_t)2, htd::set_intersection_size(input1.begin(), input1.end(), input2.begin(), input2.end()));
 }
 
+TEST(HelperTest, CheckSetOperationsOnRandomSets)
+{
+    htd::seedRandomNumberGenerator(1234);
+
+    const std::vector<std::size_t> sizes { 0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 33, 100, 1000, 5000 };
+
+    for (std::size_t size1 : sizes)
+    {
+        for (std::size_t size2 : sizes)
+        {
+            std::vector<htd::vertex_t> input1 = createRandomSet(size1, 2 * std::max(size1, size2) + 1);
+            std::vector<htd::vertex_t> input2 = createRandomSet(size2, 2 * std::max(size1, size2) + 1);
+
+            std::vector<htd::vertex_t> expectedIntersection;
+            std::vector<htd::vertex_t> expectedDifference;
+            std::vector<htd::vertex_t> expectedMerge;
+
+            std::set_intersection(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedIntersection));
+            std::set_difference(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedDifference));
+            std::merge(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedMerge));
+
+            const std::set<htd::vertex_t> orderedSet1(input1.begin(), input1.end());
+            const std::set<htd::vertex_t> orderedSet2(input2.begin(), input2.end());
+
+            ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(input1.begin(), input1.end(), input2.begin(), input2.end()));
+            ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(input1.data(), input1.data() + input1.size(), input2.data(), input2.data() + input2.size()));
+            ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(orderedSet1.begin(), orderedSet1.end(), orderedSet2.begin(), orderedSet2.end()));
+
+            ASSERT_EQ(expectedDifference.size(), htd::set_difference_size(input1.begin(), input1.end(), input2.begin(), input2.end()));
+            ASSERT_EQ(expectedDifference.size(), htd::set_difference_size(orderedSet1.begin(), orderedSet1.end(), orderedSet2.begin(), orderedSet2.end()));
+
+            std::vector<htd::vertex_t> actualIntersection;
+            std::vector<htd::vertex_t> actualDifference;
+
+            htd::set_intersection(input1, input2, actualIntersection);
+            htd::set_difference(input1, input2, actualDifference);
+
+            ASSERT_EQ(expectedIntersection, actualIntersection);
+            ASSERT_EQ(expectedDifference, actualDifference);
+
+            const std::tuple<std::size_t, std::size_t, std::size_t> & analysis = htd::analyze_sets(input1, input2);
+
+            ASSERT_EQ(expectedDifference.size(), std::get<0>(analysis));
+            ASSERT_EQ(expectedIntersection.size(), std::get<1>(analysis));
+            ASSERT_EQ(input2.size() - expectedIntersection.size(), std::get<2>(analysis));
+
+            std::vector<htd::vertex_t> actualMerge(input1);
+
+            htd::inplace_merge(actualMerge, input2);
+
+            ASSERT_EQ(expectedMerge, actualMerge);
+        }
+    }
+}
+
 TEST(HelperTest, CheckHasNonEmptySetDifferenceSize1)
 {
     std::vector<htd::vertex_t> input1 { 1, 3, 5 };
@@ -714,6 +787,97 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+TEST(HelperTest, CheckSelectRandomElementReproducible)
+{
+    std::vector<htd::vertex_t> input { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+    std::vector<htd::vertex_t> selection1;
+    std::vector<htd::vertex_t> selection2;
+
+    htd::seedRandomNumberGenerator(1234);
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        selection1.push_back(htd::selectRandomElement<htd::vertex_t>(input));
+    }
+
+    htd::seedRandomNumberGenerator(1234);
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        selection2.push_back(htd::selectRandomElement<htd::vertex_t>(input));
+    }
+
+    ASSERT_EQ(selection1, selection2);
+
+    for (htd::vertex_t vertex : selection1)
+    {
+        ASSERT_TRUE(std::find(input.begin(), input.end(), vertex) != input.end());
+    }
+}
+
+TEST(HelperTest, CheckRandomNumberGeneratorPerThread)
+{
+    std::vector<std::size_t> indices1;
+    std::vector<std::size_t> indices2;
+
+    htd::seedRandomNumberGenerator(htd::deriveRandomSeed(42, 3));
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        indices1.push_back(htd::selectRandomIndex(1000));
+    }
+
+    std::thread thread([&]()
+    {
+        htd::seedRandomNumberGenerator(htd::deriveRandomSeed(42, 3));
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            indices2.push_back(htd::selectRandomIndex(1000));
+        }
+    });
+
+    thread.join();
+
+    ASSERT_EQ(indices1, indices2);
+
+    ASSERT_NE(htd::deriveRandomSeed(42, 3), htd::deriveRandomSeed(42, 4));
+    ASSERT_NE(htd::deriveRandomSeed(42, 3), htd::deriveRandomSeed(43, 3));
+}
+
+TEST(HelperTest, CheckRandomNumberGeneratorGuard)
+{
+    htd::seedRandomNumberGenerator(1234);
+
+    std::mt19937 expectedGenerator = htd::randomNumberGenerator();
+
+    {
+        htd::RandomNumberGeneratorGuard guard;
+
+        htd::seedRandomNumberGenerator(5678);
+
+        htd::selectRandomIndex(1000);
+    }
+
+    ASSERT_TRUE(expectedGenerator == htd::randomNumberGenerator());
+
+    try
+    {
+        htd::RandomNumberGeneratorGuard guard;
+
+        htd::seedRandomNumberGenerator(5678);
+
+        throw std::runtime_error("Error");
+    }
+    catch (const std::runtime_error &)
+    {
+
+    }
+
+    ASSERT_TRUE(expectedGenerator == htd::randomNumberGenerator());
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -466,6 +466,73 @@ TEST(HypertreeDecompositionAlgorithmTest, CheckResultSimpleGraphWithLabelingFunc
     delete libraryInstance;
 }
 
+TEST(HypertreeDecompositionAlgorithmTest, CheckResultParallelCoveringEdges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(40);
+
+    for (htd::vertex_t vertex = 1; vertex <= 40; ++vertex)
+    {
+        graph.addEdge(std::vector<htd::vertex_t> { vertex, (vertex % 40) + 1, ((vertex + 6) % 40) + 1 });
+
+        if (vertex % 3 == 0)
+        {
+            graph.addEdge(vertex, ((vertex + 16) % 40) + 1);
+        }
+    }
+
+    htd::HypertreeDecompositionAlgorithm sequentialAlgorithm(libraryInstance);
+
+    htd::HypertreeDecompositionAlgorithm parallelAlgorithm(libraryInstance);
+
+    parallelAlgorithm.setThreadCount(4);
+
+    ASSERT_EQ(sequentialAlgorithm.threadCount(), (std::size_t)1);
+    ASSERT_EQ(parallelAlgorithm.threadCount(), (std::size_t)4);
+
+    htd::HypertreeDecompositionAlgorithm * clonedAlgorithm = parallelAlgorithm.clone();
+
+    ASSERT_EQ(clonedAlgorithm->threadCount(), (std::size_t)4);
+
+    htd::seedRandomNumberGenerator(42);
+
+    htd::IHypertreeDecomposition * sequentialDecomposition = sequentialAlgorithm.computeDecomposition(graph);
+
+    htd::seedRandomNumberGenerator(42);
+
+    htd::IHypertreeDecomposition * parallelDecomposition = clonedAlgorithm->computeDecomposition(graph);
+
+    ASSERT_NE(sequentialDecomposition, nullptr);
+    ASSERT_NE(parallelDecomposition, nullptr);
+
+    ASSERT_EQ(sequentialDecomposition->vertexCount(), parallelDecomposition->vertexCount());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *parallelDecomposition));
+
+    ASSERT_TRUE(isValidHypertreeDecomposition(graph, *parallelDecomposition));
+
+    for (htd::vertex_t vertex : parallelDecomposition->vertices())
+    {
+        ASSERT_EQ(sequentialDecomposition->bagContent(vertex), parallelDecomposition->bagContent(vertex));
+
+        ASSERT_EQ(sequentialDecomposition->coveringEdges(vertex), parallelDecomposition->coveringEdges(vertex));
+    }
+
+    ASSERT_EQ(sequentialDecomposition->maximumCoveringEdgeAmount(), parallelDecomposition->maximumCoveringEdgeAmount());
+
+    delete sequentialDecomposition;
+    delete parallelDecomposition;
+
+    delete clonedAlgorithm;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -293,6 +294,46 @@ TEST(IteratorTest, CheckConstIteratorCloneMethod2)
     delete it2;
 }
 
+TEST(IteratorTest, CheckContiguousConstIterator)
+{
+    htd::ConstCollection<int> collection1;
+
+    {
+        htd::VectorAdapter<int> adapter(std::vector<int> { 1, 2, 3 });
+
+        collection1 = htd::ConstCollection<int>::getInstance(adapter);
+    }
+
+    ASSERT_EQ((std::size_t)3, collection1.size());
+
+    auto it1 = collection1.begin();
+
+    auto it2 = it1++;
+
+    ASSERT_EQ(1, *it2);
+    ASSERT_EQ(2, *it1);
+
+    it2 = it1;
+
+    ASSERT_TRUE(it1 == it2);
+
+    ++it2;
+
+    ASSERT_TRUE(it1 != it2);
+    ASSERT_EQ(3, *it2);
+
+    ASSERT_EQ(3, collection1[2]);
+
+    ASSERT_EQ(6, std::accumulate(collection1.begin(), collection1.end(), 0));
+
+    std::vector<int> values;
+
+    htd::ConstCollection<int> collection2 = htd::ConstCollection<int>::getInstance(values);
+
+    ASSERT_TRUE(collection2.empty());
+    ASSERT_TRUE(collection2.begin() == collection2.end());
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -151,6 +152,98 @@ class FitnessFunction : public htd::ITreeDecompositionFitnessFunction
         }
 };
 
+class IncrementalFitnessFunction : public htd::IIncrementalTreeDecompositionFitnessFunction
+{
+    public:
+        IncrementalFitnessFunction(void)
+        {
+
+        }
+
+        ~IncrementalFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            HTD_UNUSED(graph)
+
+            double depthSum = 0;
+
+            for (htd::vertex_t vertex : decomposition.vertices())
+            {
+                depthSum += decomposition.depth(vertex);
+            }
+
+            return new htd::FitnessEvaluation(2,
+                                              -(double)(decomposition.height()),
+                                              -depthSum);
+        }
+
+        void initializeSummary(std::vector<double> & summary) const
+        {
+            summary.assign({ -1, 0, 0 });
+        }
+
+        void combineSummaries(std::vector<double> & summary, const std::vector<double> & otherSummary) const
+        {
+            summary[0] = std::max(summary[0], otherSummary[0]);
+            summary[1] += otherSummary[1];
+            summary[2] += otherSummary[2];
+        }
+
+        void computeSummary(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t node, const std::vector<double> & childSummary, std::vector<double> & summary) const
+        {
+            HTD_UNUSED(graph)
+            HTD_UNUSED(decomposition)
+            HTD_UNUSED(node)
+
+            summary.assign({ childSummary[0] + 1, childSummary[1] + 1, childSummary[2] + childSummary[1] });
+        }
+
+        htd::FitnessEvaluation * evaluateSummary(const std::vector<double> & summary) const
+        {
+            return new htd::FitnessEvaluation(2,
+                                              -summary[0],
+                                              -summary[2]);
+        }
+
+        IncrementalFitnessFunction * clone(void) const
+        {
+            return new IncrementalFitnessFunction();
+        }
+};
+
+class GenericFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        GenericFitnessFunction(void)
+        {
+
+        }
+
+        ~GenericFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            return incrementalFitnessFunction_.fitness(graph, decomposition);
+        }
+
+        GenericFitnessFunction * clone(void) const
+        {
+            return new GenericFitnessFunction();
+        }
+
+    private:
+        IncrementalFitnessFunction incrementalFitnessFunction_;
+};
+
 htd::IMultiHypergraph * createInputGraph(const htd::LibraryInstance * const libraryInstance)
 {
     htd::MultiHypergraph * graph = new htd::MultiHypergraph(libraryInstance, 50);
@@ -1809,6 +1902,133 @@ TEST(ManipulationOperationTest, CheckTreeDecompositionOptimizationOperation2)
     delete libraryInstance2;
 }
 
+TEST(ManipulationOperationTest, CheckTreeDecompositionOptimizationOperationWithIncrementalFitnessFunction)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance);
+
+    htd::IMultiHypergraph * graph = input.first;
+
+    htd::NormalizationOperation normalizationOperation(libraryInstance);
+
+    normalizationOperation.apply(*graph, *(input.second));
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(*graph, *(input.second)));
+
+    htd::TreeDecompositionOptimizationOperation genericOperation(libraryInstance, new GenericFitnessFunction());
+
+    htd::TreeDecompositionOptimizationOperation incrementalOperation(libraryInstance, new IncrementalFitnessFunction());
+
+    IncrementalFitnessFunction fitnessFunction;
+
+    for (htd::vertex_t root : input.second->vertices())
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        htd::IMutableTreeDecomposition * decomposition1 = input.second->clone();
+        htd::IMutableTreeDecomposition * decomposition2 = input.second->clone();
+#else
+        htd::IMutableTreeDecomposition * decomposition1 = input.second->cloneMutableTreeDecomposition();
+        htd::IMutableTreeDecomposition * decomposition2 = input.second->cloneMutableTreeDecomposition();
+#endif
+
+        decomposition1->makeRoot(root);
+        decomposition2->makeRoot(root);
+
+        genericOperation.apply(*graph, *decomposition1);
+
+        incrementalOperation.apply(*graph, *decomposition2);
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition2));
+
+        EXPECT_EQ(decomposition1->root(), decomposition2->root());
+
+        htd::FitnessEvaluation * fitness1 = fitnessFunction.fitness(*graph, *decomposition1);
+        htd::FitnessEvaluation * fitness2 = fitnessFunction.fitness(*graph, *decomposition2);
+
+        EXPECT_TRUE(*fitness1 == *fitness2);
+
+        delete fitness1;
+        delete fitness2;
+        delete decomposition1;
+        delete decomposition2;
+    }
+
+    delete graph;
+    delete input.second;
+    delete libraryInstance;
+}
+
+TEST(ManipulationOperationTest, CheckParallelTreeDecompositionOptimizationOperation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::pair<htd::IMultiHypergraph *, htd::IMutableTreeDecomposition *> input = computeTreeDecomposition(libraryInstance);
+
+    htd::IMultiHypergraph * graph = input.first;
+
+    htd::TreeDecompositionVerifier verifier;
+
+    BagSizeLabelingFunction labelingFunction(libraryInstance);
+
+    FitnessFunction fitnessFunction;
+
+    for (bool enforceNaiveOptimization : { false, true })
+    {
+        htd::TreeDecompositionOptimizationOperation sequentialOperation(libraryInstance, new FitnessFunction(), enforceNaiveOptimization);
+
+        sequentialOperation.addManipulationOperations({ new htd::NormalizationOperation(libraryInstance), new htd::AddEmptyLeavesOperation(libraryInstance) });
+
+        htd::TreeDecompositionOptimizationOperation * parallelOperation = sequentialOperation.clone();
+
+        ASSERT_EQ((std::size_t)1, parallelOperation->threadCount());
+
+        parallelOperation->setThreadCount(3);
+
+        ASSERT_EQ((std::size_t)3, parallelOperation->threadCount());
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        htd::IMutableTreeDecomposition * decomposition1 = input.second->clone();
+        htd::IMutableTreeDecomposition * decomposition2 = input.second->clone();
+#else
+        htd::IMutableTreeDecomposition * decomposition1 = input.second->cloneMutableTreeDecomposition();
+        htd::IMutableTreeDecomposition * decomposition2 = input.second->cloneMutableTreeDecomposition();
+#endif
+
+        sequentialOperation.apply(*graph, *decomposition1, { &labelingFunction });
+
+        parallelOperation->apply(*graph, *decomposition2, { &labelingFunction });
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition2));
+
+        EXPECT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+
+        EXPECT_EQ(decomposition1->bagContent(decomposition1->root()), decomposition2->bagContent(decomposition2->root()));
+
+        htd::FitnessEvaluation * fitness1 = fitnessFunction.fitness(*graph, *decomposition1);
+        htd::FitnessEvaluation * fitness2 = fitnessFunction.fitness(*graph, *decomposition2);
+
+        EXPECT_TRUE(*fitness1 == *fitness2);
+
+        for (htd::vertex_t vertex : decomposition2->vertices())
+        {
+            EXPECT_EQ(decomposition2->bagSize(vertex), htd::accessLabel<std::size_t>(decomposition2->vertexLabel("BAG_SIZE", vertex)));
+        }
+
+        delete fitness1;
+        delete fitness2;
+        delete decomposition1;
+        delete decomposition2;
+        delete parallelOperation;
+    }
+
+    delete graph;
+    delete input.second;
+    delete libraryInstance;
+}
+
 TEST(ManipulationOperationTest, CheckTreeDecompositionOptimizationOperation3)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -0,0 +1,215 @@
+/*
+ * File:   MaxFlowAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class MaxFlowAlgorithmTest : public ::testing::Test
+{
+    public:
+        MaxFlowAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MaxFlowAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Check that the given flow respects the capacities and the flow conservation constraints of the given flow network.
+ */
+void checkFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::IFlow & flow)
+{
+    std::size_t vertexCount = flowNetwork.vertexCount();
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        long long balance = 0;
+
+        for (htd::vertex_t neighbor = 0; neighbor < vertexCount; ++neighbor)
+        {
+            long long currentFlow = flow.flow(vertex, neighbor);
+
+            EXPECT_EQ(-currentFlow, flow.flow(neighbor, vertex));
+
+            EXPECT_LE(currentFlow, (long long)flowNetwork.capacity(vertex, neighbor));
+
+            balance += currentFlow;
+        }
+
+        if (vertex == flow.source())
+        {
+            EXPECT_EQ((long long)flow.value(), balance);
+        }
+        else if (vertex == flow.target())
+        {
+            EXPECT_EQ(-(long long)flow.value(), balance);
+        }
+        else
+        {
+            EXPECT_EQ(0, balance);
+        }
+    }
+}
+
+TEST(MaxFlowAlgorithmTest, CheckDinitzMaxFlowAlgorithm1)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::FlowNetworkStructure flowNetwork(6);
+
+    flowNetwork.updateCapacity(0, 1, 16);
+    flowNetwork.updateCapacity(0, 2, 13);
+    flowNetwork.updateCapacity(1, 3, 12);
+    flowNetwork.updateCapacity(2, 1, 4);
+    flowNetwork.updateCapacity(2, 4, 14);
+    flowNetwork.updateCapacity(3, 2, 9);
+    flowNetwork.updateCapacity(3, 5, 20);
+    flowNetwork.updateCapacity(4, 3, 7);
+    flowNetwork.updateCapacity(4, 5, 4);
+
+    ASSERT_EQ((std::size_t)9, flowNetwork.edgeCount());
+    ASSERT_EQ((std::size_t)14, flowNetwork.capacity(2, 4));
+    ASSERT_EQ((std::size_t)0, flowNetwork.capacity(4, 2));
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance);
+
+    htd::IFlow * flow = algorithm.determineMaximumFlow(flowNetwork, 0, 5);
+
+    ASSERT_NE(flow, nullptr);
+
+    EXPECT_EQ((std::size_t)6, flow->vertexCount());
+    EXPECT_EQ((htd::vertex_t)0, flow->source());
+    EXPECT_EQ((htd::vertex_t)5, flow->target());
+    EXPECT_EQ((std::size_t)23, flow->value());
+
+    checkFlow(flowNetwork, *flow);
+
+    delete flow;
+
+    flow = algorithm.determineMaximumFlow(flowNetwork, 5, 0);
+
+    EXPECT_EQ((std::size_t)0, flow->value());
+
+    checkFlow(flowNetwork, *flow);
+
+    delete flow;
+
+    delete libraryInstance;
+}
+
+TEST(MaxFlowAlgorithmTest, CheckDinitzMaxFlowAlgorithm2)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::FlowNetworkStructure flowNetwork(6);
+
+    flowNetwork.updateCapacity(0, 1, 1);
+    flowNetwork.updateCapacity(0, 2, 1);
+    flowNetwork.updateCapacity(1, 3, 1);
+    flowNetwork.updateCapacity(1, 4, 1);
+    flowNetwork.updateCapacity(2, 3, 1);
+    flowNetwork.updateCapacity(3, 5, 1);
+    flowNetwork.updateCapacity(4, 5, 1);
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance);
+
+    htd::IFlow * flow = algorithm.determineMaximumFlow(flowNetwork, 0, 5);
+
+    EXPECT_EQ((std::size_t)2, flow->value());
+
+    EXPECT_EQ(1, flow->flow(1, 4));
+    EXPECT_EQ(1, flow->flow(2, 3));
+    EXPECT_EQ(0, flow->flow(1, 3));
+
+    checkFlow(flowNetwork, *flow);
+
+    delete flow;
+
+    delete libraryInstance;
+}
+
+TEST(MaxFlowAlgorithmTest, CheckDinitzMaxFlowAlgorithmLargeNetwork)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t pathCount = 3;
+    const std::size_t pathLength = 50000;
+
+    htd::FlowNetworkStructure flowNetwork(pathCount * pathLength + 2);
+
+    htd::vertex_t source = pathCount * pathLength;
+    htd::vertex_t target = source + 1;
+
+    for (htd::index_t path = 0; path < pathCount; ++path)
+    {
+        htd::vertex_t first = path * pathLength;
+
+        flowNetwork.updateCapacity(source, first, (std::size_t)-1);
+
+        for (htd::index_t index = 0; index + 1 < pathLength; ++index)
+        {
+            flowNetwork.updateCapacity(first + index, first + index + 1, path + 1);
+            flowNetwork.updateCapacity(first + index + 1, first + index, path + 1);
+        }
+
+        flowNetwork.updateCapacity(first + pathLength - 1, target, (std::size_t)-1);
+    }
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance);
+
+    htd::IFlow * flow = algorithm.determineMaximumFlow(flowNetwork, source, target);
+
+    EXPECT_EQ((std::size_t)6, flow->value());
+
+    EXPECT_EQ(3, flow->flow(2 * pathLength + 7, 2 * pathLength + 8));
+    EXPECT_EQ(-3, flow->flow(2 * pathLength + 8, 2 * pathLength + 7));
+
+    delete flow;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,156 @@
+/*
+ * File:   MaximalSetFilterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class MaximalSetFilterTest : public ::testing::Test
+{
+    public:
+        MaximalSetFilterTest(void)
+        {
+
+        }
+
+        virtual ~MaximalSetFilterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Determine the maximal sets of the given collection by comparing all pairs of sets.
+ */
+std::vector<htd::index_t> computeMaximalSetsNaively(const std::vector<std::vector<htd::id_t>> & sets)
+{
+    std::vector<htd::index_t> ret;
+
+    for (htd::index_t index1 = 0; index1 < sets.size(); ++index1)
+    {
+        bool maximal = true;
+
+        for (htd::index_t index2 = 0; maximal && index2 < sets.size(); ++index2)
+        {
+            if (index1 != index2 && std::includes(sets[index2].begin(), sets[index2].end(), sets[index1].begin(), sets[index1].end()))
+            {
+                maximal = sets[index1] == sets[index2] && index1 > index2;
+            }
+        }
+
+        if (maximal)
+        {
+            ret.push_back(index1);
+        }
+    }
+
+    return ret;
+}
+
+TEST(MaximalSetFilterTest, CheckSimpleCollection)
+{
+    htd::MaximalSetFilter filter;
+
+    std::vector<std::vector<htd::id_t>> sets { { 1, 2, 3 }, { 2, 3 }, { 3, 4 }, { 1, 2, 3 }, { }, { 4 }, { 5 } };
+
+    std::vector<htd::index_t> result { 42 };
+
+    filter.computeMaximalSets(sets, result);
+
+    EXPECT_EQ(std::vector<htd::index_t>({ 42, 2, 3, 6 }), result);
+
+    std::vector<std::vector<htd::id_t>> emptySets { { }, { } };
+
+    result.clear();
+
+    filter.computeMaximalSets(emptySets, result);
+
+    EXPECT_EQ(std::vector<htd::index_t>({ 1 }), result);
+}
+
+TEST(MaximalSetFilterTest, CheckRandomCollections)
+{
+    htd::MaximalSetFilter filter;
+
+    ASSERT_TRUE(filter.isSignatureCheckEnabled());
+
+    std::mt19937 randomNumberGenerator(1);
+
+    for (bool signatureCheckEnabled : { true, false })
+    {
+        filter.setSignatureCheckEnabled(signatureCheckEnabled);
+
+        htd::MaximalSetFilter * clone = filter.clone();
+
+        ASSERT_EQ(signatureCheckEnabled, clone->isSignatureCheckEnabled());
+
+        for (int iteration = 0; iteration < 20; ++iteration)
+        {
+            std::vector<std::vector<htd::id_t>> sets(100);
+
+            for (std::vector<htd::id_t> & set : sets)
+            {
+                std::size_t size = randomNumberGenerator() % 6;
+
+                for (std::size_t index = 0; index < size; ++index)
+                {
+                    set.push_back(1 + randomNumberGenerator() % 150);
+                }
+
+                std::sort(set.begin(), set.end());
+
+                set.erase(std::unique(set.begin(), set.end()), set.end());
+            }
+
+            std::vector<htd::index_t> result;
+
+            clone->computeMaximalSets(sets, result);
+
+            EXPECT_EQ(computeMaximalSetsNaively(sets), result);
+        }
+
+        delete clone;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
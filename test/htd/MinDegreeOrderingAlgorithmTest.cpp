@@ -328,6 +328,52 @@ TEST(MinDegreeOrderingAlgorithmTest, CheckSimpleGraph5)
     delete libraryInstance;
 }
 
+TEST(MinDegreeOrderingAlgorithmTest, CheckSimpleGraph5WithBucketPriorityQueue)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    graph.addEdge(1,4);
+    graph.addEdge(2,3);
+    graph.addEdge(2,8);
+    graph.addEdge(3,10);
+    graph.addEdge(3,4);
+    graph.addEdge(4,10);
+    graph.addEdge(4,7);
+    graph.addEdge(5,1);
+    graph.addEdge(5,7);
+    graph.addEdge(5,4);
+    graph.addEdge(6,7);
+    graph.addEdge(6,8);
+    graph.addEdge(7,9);
+    graph.addEdge(8,7);
+
+    htd::MinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    ASSERT_FALSE(algorithm.isBucketPriorityQueueEnabled());
+
+    algorithm.setBucketPriorityQueueEnabled(true);
+
+    ASSERT_TRUE(algorithm.isBucketPriorityQueueEnabled());
+
+    htd::MinDegreeOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_TRUE(clonedAlgorithm->isBucketPriorityQueueEnabled());
+
+    const htd::IVertexOrdering * ordering = clonedAlgorithm->computeOrdering(graph);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering->sequence()));
+
+    delete ordering;
+
+    delete clonedAlgorithm;
+
+    delete libraryInstance;
+}
+
 TEST(MinDegreeOrderingAlgorithmTest, CheckSize50Graph1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
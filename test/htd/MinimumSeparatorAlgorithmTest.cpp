@@ -0,0 +1,264 @@
+/*
+ * File:   MinimumSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <random>
+#include <vector>
+
+class MinimumSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        MinimumSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MinimumSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the size of the largest connected component of the given graph after removing the given vertices.
+ */
+std::size_t largestRemainingComponentSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & separator)
+{
+    std::size_t ret = 0;
+
+    htd::MultiHypergraph remainder(graph);
+
+    for (htd::vertex_t vertex : separator)
+    {
+        remainder.removeVertex(vertex);
+    }
+
+    htd::DepthFirstConnectedComponentAlgorithm algorithm(graph.managementInstance());
+
+    std::vector<std::vector<htd::vertex_t>> components;
+
+    algorithm.determineComponents(remainder, components);
+
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        ret = std::max(ret, component.size());
+    }
+
+    EXPECT_GT(components.size(), (std::size_t)1);
+
+    return ret;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckPath)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    htd::vertex_t first = graph.addVertices(9);
+
+    for (htd::vertex_t vertex = first; vertex + 1 < first + 9; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_EQ((std::size_t)1, separator->size());
+
+    largestRemainingComponentSize(graph, *separator);
+
+    delete separator;
+
+    algorithm.setBalancedSeparatorModeEnabled(true);
+
+    htd::MinimumSeparatorAlgorithm * clone = algorithm.clone();
+
+    ASSERT_TRUE(clone->isBalancedSeparatorModeEnabled());
+
+    separator = clone->computeSeparator(graph);
+
+    ASSERT_EQ((std::size_t)1, separator->size());
+
+    EXPECT_EQ(first + 4, (*separator)[0]);
+
+    EXPECT_EQ((std::size_t)4, largestRemainingComponentSize(graph, *separator));
+
+    delete separator;
+
+    delete clone;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckGrid)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t size = 12;
+
+    htd::Graph graph(libraryInstance);
+
+    htd::vertex_t first = graph.addVertices(size * size);
+
+    for (htd::index_t row = 0; row < size; ++row)
+    {
+        for (htd::index_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = first + row * size + column;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    EXPECT_EQ((std::size_t)2, separator->size());
+
+    EXPECT_TRUE(std::is_sorted(separator->begin(), separator->end()));
+
+    largestRemainingComponentSize(graph, *separator);
+
+    delete separator;
+
+    algorithm.setBalancedSeparatorModeEnabled(true);
+
+    separator = algorithm.computeSeparator(graph);
+
+    EXPECT_LT(largestRemainingComponentSize(graph, *separator) + separator->size(), size * size - 1);
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckCompleteGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    htd::vertex_t first = graph.addVertices(5);
+
+    for (htd::vertex_t vertex1 = first; vertex1 < first + 5; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 < first + 5; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    EXPECT_EQ((std::size_t)5, separator->size());
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckParallelEvaluation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    htd::vertex_t first = graph.addVertices(60);
+
+    std::mt19937 randomNumberGenerator(7);
+
+    for (htd::vertex_t vertex = first + 1; vertex < first + 60; ++vertex)
+    {
+        for (htd::index_t index = 0; index < 2; ++index)
+        {
+            graph.addEdge(vertex, first + randomNumberGenerator() % (vertex - first));
+        }
+    }
+
+    for (bool balanced : { false, true })
+    {
+        htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+        algorithm.setBalancedSeparatorModeEnabled(balanced);
+
+        std::vector<htd::vertex_t> * expectedSeparator = algorithm.computeSeparator(graph);
+
+        largestRemainingComponentSize(graph, *expectedSeparator);
+
+        for (std::size_t threadCount : { 2, 4 })
+        {
+            algorithm.setThreadCount(threadCount);
+
+            htd::MinimumSeparatorAlgorithm * clone = algorithm.clone();
+
+            ASSERT_EQ(threadCount, clone->threadCount());
+
+            std::vector<htd::vertex_t> * separator = clone->computeSeparator(graph);
+
+            EXPECT_EQ(*expectedSeparator, *separator);
+
+            delete separator;
+
+            delete clone;
+        }
+
+        delete expectedSeparator;
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+/*
+ * File:   PriorityQueueTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class PriorityQueueTest : public ::testing::Test
+{
+    public:
+        PriorityQueueTest(void)
+        {
+
+        }
+
+        virtual ~PriorityQueueTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(PriorityQueueTest, CheckBucketPriorityQueue1)
+{
+    htd::BucketPriorityQueue<htd::vertex_t> priorityQueue;
+
+    ASSERT_TRUE(priorityQueue.empty());
+    ASSERT_EQ((std::size_t)0, priorityQueue.size());
+
+    priorityQueue.push(3, 5);
+    priorityQueue.push(1, 2);
+    priorityQueue.push(7, 2);
+    priorityQueue.push(2, 9);
+
+    ASSERT_FALSE(priorityQueue.empty());
+    ASSERT_EQ((std::size_t)4, priorityQueue.size());
+
+    ASSERT_TRUE(priorityQueue.contains(7));
+    ASSERT_FALSE(priorityQueue.contains(4));
+    ASSERT_FALSE(priorityQueue.contains(100));
+
+    ASSERT_EQ((std::size_t)2, priorityQueue.topPriority());
+    ASSERT_EQ((std::size_t)2, priorityQueue.topCollection().size());
+    ASSERT_EQ((htd::vertex_t)1, priorityQueue.top());
+
+    ASSERT_FALSE(priorityQueue.eraseFromTopCollection(3));
+    ASSERT_TRUE(priorityQueue.eraseFromTopCollection(1));
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.topCollection().size());
+    ASSERT_EQ((htd::vertex_t)7, priorityQueue.top());
+
+    priorityQueue.updatePriority(7, 2, 6);
+
+    ASSERT_EQ((std::size_t)5, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)3, priorityQueue.top());
+
+    priorityQueue.updatePriority(2, 9, 0);
+
+    ASSERT_EQ((std::size_t)0, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)2, priorityQueue.top());
+
+    ASSERT_FALSE(priorityQueue.erase(3, 4));
+    ASSERT_TRUE(priorityQueue.erase(3, 5));
+    ASSERT_FALSE(priorityQueue.erase(3));
+
+    priorityQueue.pop();
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.size());
+    ASSERT_EQ((std::size_t)6, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)7, priorityQueue.top());
+
+    priorityQueue.pop();
+
+    ASSERT_TRUE(priorityQueue.empty());
+    ASSERT_FALSE(priorityQueue.contains(7));
+}
+
+TEST(PriorityQueueTest, CheckBucketPriorityQueue2)
+{
+    const std::size_t elementCount = 200;
+
+    htd::BucketPriorityQueue<htd::vertex_t> bucketPriorityQueue(elementCount);
+
+    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    std::vector<std::size_t> priorities(elementCount);
+
+    htd::seedRandomNumberGenerator(1234);
+
+    for (htd::vertex_t vertex = 0; vertex < elementCount; ++vertex)
+    {
+        priorities[vertex] = htd::selectRandomIndex(20);
+
+        bucketPriorityQueue.push(vertex, priorities[vertex]);
+
+        priorityQueue.push(vertex, priorities[vertex]);
+    }
+
+    while (!priorityQueue.empty())
+    {
+        ASSERT_EQ(priorityQueue.size(), bucketPriorityQueue.size());
+        ASSERT_EQ(priorityQueue.topPriority(), bucketPriorityQueue.topPriority());
+
+        std::vector<htd::vertex_t> expectedTopCollection(priorityQueue.topCollection().begin(), priorityQueue.topCollection().end());
+        std::vector<htd::vertex_t> actualTopCollection(bucketPriorityQueue.topCollection().begin(), bucketPriorityQueue.topCollection().end());
+
+        std::sort(expectedTopCollection.begin(), expectedTopCollection.end());
+        std::sort(actualTopCollection.begin(), actualTopCollection.end());
+
+        ASSERT_EQ(expectedTopCollection, actualTopCollection);
+
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(bucketPriorityQueue.topCollection());
+
+        ASSERT_TRUE(bucketPriorityQueue.eraseFromTopCollection(selectedVertex));
+        ASSERT_TRUE(priorityQueue.eraseFromTopCollection(selectedVertex));
+
+        for (std::size_t index = 0; index < 3 && !priorityQueue.empty(); ++index)
+        {
+            htd::vertex_t vertex = htd::selectRandomIndex(elementCount);
+
+            if (bucketPriorityQueue.contains(vertex))
+            {
+                std::size_t newPriority = htd::selectRandomIndex(30);
+
+                bucketPriorityQueue.updatePriority(vertex, priorities[vertex], newPriority);
+
+                priorityQueue.updatePriority(vertex, priorities[vertex], newPriority);
+
+                priorities[vertex] = newPriority;
+            }
+        }
+    }
+
+    ASSERT_TRUE(bucketPriorityQueue.empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
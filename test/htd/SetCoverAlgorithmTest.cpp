@@ -402,6 +402,282 @@ TEST(SetCoverAlgorithmTest, CheckGreedySetCoverAlgorithm5)
     delete values;
 }
 
+TEST(SetCoverAlgorithmTest, CheckIndexedGreedySetCoverAlgorithm1)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IndexedGreedySetCoverAlgorithm algorithm(libraryInstance);
+
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(2);
+
+    ASSERT_TRUE(algorithm.managementInstance() == libraryInstance);
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_TRUE(algorithm.managementInstance() == libraryInstance2);
+
+    htd::ISetCoverAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_TRUE(clonedAlgorithm->managementInstance() == libraryInstance2);
+
+    delete clonedAlgorithm;
+    delete libraryInstance;
+    delete libraryInstance2;
+}
+
+TEST(SetCoverAlgorithmTest, CheckIndexedGreedySetCoverAlgorithm2)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::GreedySetCoverAlgorithm greedyAlgorithm(libraryInstance);
+
+    htd::IndexedGreedySetCoverAlgorithm algorithm(libraryInstance);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::vector<htd::id_t> * values = createContainer(1, 50, 0, 25);
+
+        std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 50, 25, 1, 8);
+
+        std::vector<htd::index_t> expectedResult;
+
+        greedyAlgorithm.computeSetCover(*values, *containers, expectedResult);
+
+        std::vector<htd::index_t> result;
+
+        algorithm.computeSetCover(*values, *containers, result);
+
+        ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+        ASSERT_EQ(expectedResult, result);
+
+        result.clear();
+
+        algorithm.computeSetCover(htd::ConstCollection<htd::id_t>::getInstance(*values),
+                                  htd::ConstCollection<std::vector<htd::id_t>>::getInstance(*containers), result);
+
+        ASSERT_EQ(expectedResult, result);
+
+        delete containers;
+        delete values;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(SetCoverAlgorithmTest, CheckIndexedGreedySetCoverAlgorithm3)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::GreedySetCoverAlgorithm greedyAlgorithm(libraryInstance);
+
+    htd::IndexedGreedySetCoverAlgorithm algorithm(libraryInstance);
+
+    std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 100, 50, 1, 10);
+
+    algorithm.setContainers(*containers);
+
+    htd::IndexedGreedySetCoverAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    for (int i = 0; i < 25; ++i)
+    {
+        std::vector<htd::id_t> * values = createContainer(1, 100, 0, 40);
+
+        std::vector<htd::index_t> expectedResult;
+
+        greedyAlgorithm.computeSetCover(*values, *containers, expectedResult);
+
+        std::vector<htd::index_t> result;
+
+        algorithm.computeSetCover(*values, result);
+
+        ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+        ASSERT_EQ(expectedResult, result);
+
+        result.clear();
+
+        clonedAlgorithm->computeSetCover(*values, result);
+
+        ASSERT_EQ(expectedResult, result);
+
+        delete values;
+    }
+
+    delete clonedAlgorithm;
+    delete containers;
+    delete libraryInstance;
+}
+
+TEST(SetCoverAlgorithmTest, CheckIndexedGreedySetCoverAlgorithm4)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IndexedGreedySetCoverAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::id_t> * values = createContainer(101, 150, 0, 25);
+
+    std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 50, 25, 1, 8);
+
+    std::vector<htd::index_t> result;
+
+    algorithm.computeSetCover(*values, *containers, result);
+
+    ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+    algorithm.setContainers(*containers);
+
+    algorithm.computeSetCover(*values, result);
+
+    ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+    delete libraryInstance;
+    delete containers;
+    delete values;
+}
+
+TEST(SetCoverAlgorithmTest, CheckBranchAndBoundSetCoverAlgorithm1)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::BranchAndBoundSetCoverAlgorithm algorithm(libraryInstance);
+
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(2);
+
+    ASSERT_TRUE(algorithm.managementInstance() == libraryInstance);
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_TRUE(algorithm.managementInstance() == libraryInstance2);
+
+    ASSERT_EQ((std::size_t)100000, algorithm.nodeLimit());
+    ASSERT_EQ((std::size_t)-1, algorithm.timeLimit());
+
+    algorithm.setNodeLimit(42);
+    algorithm.setTimeLimit(17);
+
+    htd::BranchAndBoundSetCoverAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_TRUE(clonedAlgorithm->managementInstance() == libraryInstance2);
+
+    ASSERT_EQ((std::size_t)42, clonedAlgorithm->nodeLimit());
+    ASSERT_EQ((std::size_t)17, clonedAlgorithm->timeLimit());
+
+    delete clonedAlgorithm;
+    delete libraryInstance;
+    delete libraryInstance2;
+}
+
+TEST(SetCoverAlgorithmTest, CheckBranchAndBoundSetCoverAlgorithm2)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::BranchAndBoundSetCoverAlgorithm algorithm(libraryInstance);
+
+    algorithm.setNodeLimit((std::size_t)-1);
+    algorithm.setTimeLimit((std::size_t)-1);
+
+    std::vector<htd::id_t> values { 1, 2, 3, 4, 5, 6 };
+
+    std::vector<std::vector<htd::id_t>> containers { { 1, 2, 3 }, { 4, 5, 6 }, { 1, 2, 4, 5 } };
+
+    std::vector<htd::index_t> greedyResult;
+
+    htd::GreedySetCoverAlgorithm(libraryInstance).computeSetCover(values, containers, greedyResult);
+
+    ASSERT_EQ((std::size_t)3, greedyResult.size());
+
+    std::vector<htd::index_t> result;
+
+    algorithm.computeSetCover(values, containers, result);
+
+    ASSERT_EQ(std::vector<htd::index_t>({ 0, 1 }), result);
+
+    result.clear();
+
+    algorithm.setNodeLimit(0);
+
+    algorithm.computeSetCover(values, containers, result);
+
+    ASSERT_TRUE(isValidSetCover(values, containers, result));
+
+    ASSERT_EQ(greedyResult.size(), result.size());
+
+    delete libraryInstance;
+}
+
+TEST(SetCoverAlgorithmTest, CheckBranchAndBoundSetCoverAlgorithm3)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::SetCoverAlgorithm exactAlgorithm(libraryInstance);
+
+    htd::GreedySetCoverAlgorithm greedyAlgorithm(libraryInstance);
+
+    htd::BranchAndBoundSetCoverAlgorithm algorithm(libraryInstance);
+
+    algorithm.setNodeLimit((std::size_t)-1);
+    algorithm.setTimeLimit((std::size_t)-1);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::vector<htd::id_t> * values = createContainer(1, 20, 0, 15);
+
+        std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 20, 12, 1, 6);
+
+        std::vector<htd::index_t> exactResult;
+
+        exactAlgorithm.computeSetCover(*values, *containers, exactResult);
+
+        std::vector<htd::index_t> greedyResult;
+
+        greedyAlgorithm.computeSetCover(*values, *containers, greedyResult);
+
+        std::vector<htd::index_t> result;
+
+        algorithm.computeSetCover(*values, *containers, result);
+
+        ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+        ASSERT_EQ(exactResult.size(), result.size());
+
+        ASSERT_LE(result.size(), greedyResult.size());
+
+        result.clear();
+
+        algorithm.computeSetCover(htd::ConstCollection<htd::id_t>::getInstance(*values),
+                                  htd::ConstCollection<std::vector<htd::id_t>>::getInstance(*containers), result);
+
+        ASSERT_EQ(exactResult.size(), result.size());
+
+        delete containers;
+        delete values;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(SetCoverAlgorithmTest, CheckBranchAndBoundSetCoverAlgorithm4)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::BranchAndBoundSetCoverAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::id_t> * values = createContainer(101, 150, 0, 25);
+
+    std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 50, 25, 1, 8);
+
+    std::vector<htd::index_t> result;
+
+    algorithm.computeSetCover(*values, *containers, result);
+
+    ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+    delete libraryInstance;
+    delete containers;
+    delete values;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -1048,6 +1048,232 @@ TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalHeight = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentHeight = currentDecomposition.height();
+
+        ASSERT_EQ(currentHeight, (std::size_t)(-fitness.at(0)));
+
+        ASSERT_LT(currentHeight, minimalHeight);
+
+        minimalHeight = currentHeight;
+
+        ++iterationCount;
+    });
+
+    ASSERT_GE(iterationCount, (std::size_t)1);
+    ASSERT_LE(iterationCount, (std::size_t)25);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalHeight, decomposition->height());
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    delete clonedAlgorithm;
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelWidthMinimizationResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::size_t minimalWidth = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentWidth, static_cast<std::size_t>(-fitness.at(0)));
+
+        ASSERT_LT(currentWidth, minimalWidth);
+
+        minimalWidth = currentWidth;
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    delete clonedAlgorithm;
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultIsReproducible)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    algorithm.setIterationCount(50);
+
+    algorithm.setNonImprovementLimit(10);
+
+    std::vector<htd::ITreeDecomposition *> decompositions;
+
+    std::vector<std::vector<double>> reportedFitness;
+
+    for (std::size_t threadCount : { 4, 4, 2 })
+    {
+        algorithm.setThreadCount(threadCount);
+
+        reportedFitness.emplace_back();
+
+        htd::seedRandomNumberGenerator(42);
+
+        decompositions.push_back(algorithm.computeDecomposition(*graph,
+                                                                [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation & fitness){
+            reportedFitness.back().push_back(fitness.at(0));
+        }));
+
+        ASSERT_NE(decompositions.back(), nullptr);
+    }
+
+    for (std::size_t index = 1; index < decompositions.size(); ++index)
+    {
+        EXPECT_EQ(reportedFitness[0], reportedFitness[index]);
+
+        ASSERT_EQ(decompositions[0]->vertexCount(), decompositions[index]->vertexCount());
+
+        for (htd::vertex_t vertex : decompositions[0]->vertices())
+        {
+            ASSERT_TRUE(decompositions[index]->isVertex(vertex));
+
+            EXPECT_EQ(decompositions[0]->bagContent(vertex), decompositions[index]->bagContent(vertex));
+
+            EXPECT_EQ(decompositions[0]->childCount(vertex), decompositions[index]->childCount(vertex));
+        }
+    }
+
+    for (htd::ITreeDecomposition * decomposition : decompositions)
+    {
+        delete decomposition;
+    }
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelWidthMinimizationResultIsReproducible)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setIterationCount(50);
+
+    algorithm.setNonImprovementLimit(10);
+
+    std::vector<htd::ITreeDecomposition *> decompositions;
+
+    std::vector<std::vector<double>> reportedFitness;
+
+    for (std::size_t threadCount : { 4, 4, 2 })
+    {
+        algorithm.setThreadCount(threadCount);
+
+        reportedFitness.emplace_back();
+
+        htd::seedRandomNumberGenerator(42);
+
+        decompositions.push_back(algorithm.computeDecomposition(*graph,
+                                                                [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation & fitness){
+            reportedFitness.back().push_back(fitness.at(0));
+        }));
+
+        ASSERT_NE(decompositions.back(), nullptr);
+    }
+
+    for (std::size_t index = 1; index < decompositions.size(); ++index)
+    {
+        EXPECT_EQ(reportedFitness[0], reportedFitness[index]);
+
+        ASSERT_EQ(decompositions[0]->vertexCount(), decompositions[index]->vertexCount());
+
+        for (htd::vertex_t vertex : decompositions[0]->vertices())
+        {
+            ASSERT_TRUE(decompositions[index]->isVertex(vertex));
+
+            EXPECT_EQ(decompositions[0]->bagContent(vertex), decompositions[index]->bagContent(vertex));
+
+            EXPECT_EQ(decompositions[0]->childCount(vertex), decompositions[index]->childCount(vertex));
+        }
+    }
+
+    for (htd::ITreeDecomposition * decomposition : decompositions)
+    {
+        delete decomposition;
+    }
+
+    delete graph;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1115,6 +1341,81 @@ TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComp
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelCombinedWidthMinimizationResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm1 =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm2 =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm3 =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    baseAlgorithm1->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
+    baseAlgorithm2->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+    baseAlgorithm3->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(baseAlgorithm1);
+    algorithm.addDecompositionAlgorithm(baseAlgorithm2);
+    algorithm.addDecompositionAlgorithm(baseAlgorithm3);
+
+    algorithm.addDecompositionAlgorithm(new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance));
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ(algorithm.threadCount(), (std::size_t)4);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::size_t minimalWidth = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentWidth, static_cast<std::size_t>(-fitness.at(0)));
+
+        if (currentWidth < minimalWidth)
+        {
+            minimalWidth = currentWidth;
+        }
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_LE(decomposition->minimumBagSize(), decomposition->maximumBagSize());
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(clonedAlgorithm->threadCount(), (std::size_t)4);
+
+    delete clonedAlgorithm;
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 class BagSizeLabelingFunction : public htd::ILabelingFunction
 {
     public:
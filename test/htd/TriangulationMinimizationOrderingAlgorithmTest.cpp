@@ -0,0 +1,278 @@
+/*
+ * File:   TriangulationMinimizationOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+class TriangulationMinimizationOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        TriangulationMinimizationOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~TriangulationMinimizationOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::set<std::pair<htd::vertex_t, htd::vertex_t>> computeEdges(const htd::IMultiHypergraph & graph)
+{
+    std::set<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            if (vertex < neighbor)
+            {
+                ret.emplace(vertex, neighbor);
+            }
+        }
+    }
+
+    return ret;
+}
+
+std::set<std::pair<htd::vertex_t, htd::vertex_t>> computeFillEdges(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::set<std::pair<htd::vertex_t, htd::vertex_t>> edges = computeEdges(graph);
+
+    std::set<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+    for (auto it = ordering.begin(); it != ordering.end(); ++it)
+    {
+        std::vector<htd::vertex_t> neighbors;
+
+        for (auto it2 = it + 1; it2 != ordering.end(); ++it2)
+        {
+            if (edges.count(std::make_pair(std::min(*it, *it2), std::max(*it, *it2))) > 0)
+            {
+                neighbors.push_back(*it2);
+            }
+        }
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 < neighbor2 && edges.emplace(neighbor1, neighbor2).second)
+                {
+                    ret.emplace(neighbor1, neighbor2);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool isChordal(std::vector<htd::vertex_t> vertices, const std::set<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    bool ret = true;
+
+    auto isEdge = [&](htd::vertex_t vertex1, htd::vertex_t vertex2) { return edges.count(std::make_pair(std::min(vertex1, vertex2), std::max(vertex1, vertex2))) > 0; };
+
+    while (ret && !vertices.empty())
+    {
+        auto simplicialVertex = std::find_if(vertices.begin(), vertices.end(), [&](htd::vertex_t vertex)
+        {
+            bool simplicial = true;
+
+            for (htd::vertex_t neighbor1 : vertices)
+            {
+                for (htd::vertex_t neighbor2 : vertices)
+                {
+                    if (neighbor1 < neighbor2 && isEdge(vertex, neighbor1) && isEdge(vertex, neighbor2) && !isEdge(neighbor1, neighbor2))
+                    {
+                        simplicial = false;
+                    }
+                }
+            }
+
+            return simplicial;
+        });
+
+        if (simplicialVertex != vertices.end())
+        {
+            vertices.erase(simplicialVertex);
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    return ret;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)0, ordering->sequence().size());
+
+    delete ordering;
+
+    delete libraryInstance;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckMinimalTriangulationOfTree)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 15);
+
+    for (htd::vertex_t vertex = 2; vertex <= 15; ++vertex)
+    {
+        graph.addEdge(vertex / 2, vertex);
+    }
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::RandomOrderingAlgorithm(libraryInstance));
+
+    for (unsigned int seed = 1; seed <= 20; ++seed)
+    {
+        htd::seedRandomNumberGenerator(seed);
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+        /* A tree is chordal, hence its only minimal triangulation is the tree itself. */
+        EXPECT_EQ((std::size_t)0, computeFillEdges(graph, ordering->sequence()).size());
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckMinimalTriangulationOfRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::RandomOrderingAlgorithm baseAlgorithm(libraryInstance);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(baseAlgorithm.clone());
+
+    for (unsigned int seed = 1; seed <= 25; ++seed)
+    {
+        htd::seedRandomNumberGenerator(seed);
+
+        std::size_t vertexCount = 8 + htd::randomNumberGenerator()() % 8;
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        for (htd::vertex_t vertex1 = 1; vertex1 <= vertexCount; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= vertexCount; ++vertex2)
+            {
+                if (htd::randomNumberGenerator()() % 4 == 0)
+                {
+                    graph.addEdge(vertex1, vertex2);
+                }
+            }
+        }
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+        htd::seedRandomNumberGenerator(seed);
+
+        htd::IVertexOrdering * baseOrdering = baseAlgorithm.computeOrdering(graph, *preprocessedGraph);
+
+        htd::seedRandomNumberGenerator(seed);
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+        std::set<std::pair<htd::vertex_t, htd::vertex_t>> baseFillEdges = computeFillEdges(graph, baseOrdering->sequence());
+
+        std::set<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges = computeFillEdges(graph, ordering->sequence());
+
+        EXPECT_TRUE(std::includes(baseFillEdges.begin(), baseFillEdges.end(), fillEdges.begin(), fillEdges.end()));
+
+        std::set<std::pair<htd::vertex_t, htd::vertex_t>> triangulation = computeEdges(graph);
+
+        triangulation.insert(fillEdges.begin(), fillEdges.end());
+
+        std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+        /* A triangulation is minimal if and only if no single fill edge can be removed without losing chordality. */
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+        {
+            triangulation.erase(fillEdge);
+
+            EXPECT_FALSE(isChordal(vertices, triangulation));
+
+            triangulation.insert(fillEdge);
+        }
+
+        delete ordering;
+        delete baseOrdering;
+        delete preprocessedGraph;
+    }
+
+    delete preprocessor;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,391 @@
+/*
+ * File:   BinFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class BinFormatImporterTest : public ::testing::Test
+{
+    public:
+        BinFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~BinFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Create a small hypergraph with binary edges, larger hyperedges, a loop and a duplicate edge.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *
+ *  @return The new graph.
+ */
+htd::IMutableMultiHypergraph * createInputGraph(const htd::LibraryInstance * const libraryInstance)
+{
+    htd::IMutableMultiHypergraph * ret = libraryInstance->multiHypergraphFactory().createInstance(6);
+
+    ret->addEdge(1, 2);
+    ret->addEdge(std::vector<htd::vertex_t> { 4, 2, 3 });
+    ret->addEdge(5, 5);
+    ret->addEdge(1, 2);
+    ret->addEdge(std::vector<htd::vertex_t> { 6, 1, 3, 5 });
+
+    return ret;
+}
+
+/**
+ *  Write a graph in format 'bin' to a string.
+ *
+ *  @param[in] graph    The graph which shall be written.
+ *
+ *  @return The content of the graph in format 'bin'.
+ */
+std::string exportGraph(const htd::IMultiHypergraph & graph)
+{
+    htd_io::BinFormatGraphExporter exporter;
+
+    std::ostringstream stream(std::ios::binary);
+
+    EXPECT_TRUE(exporter.write(graph, stream));
+
+    return stream.str();
+}
+
+/**
+ *  Import a graph in format 'bin' from a string.
+ *
+ *  @param[in] importer The importer which shall be used.
+ *  @param[in] content  The content of the graph in format 'bin'.
+ *
+ *  @return The imported graph or nullptr if the content is invalid.
+ */
+htd::IMultiHypergraph * importGraph(const htd_io::BinFormatImporter & importer, const std::string & content)
+{
+    std::istringstream stream(content, std::ios::binary);
+
+    return importer.import(stream);
+}
+
+/**
+ *  Overwrite a 64-bit value of the given content.
+ *
+ *  @param[in,out] content  The content which shall be modified.
+ *  @param[in] offset       The offset of the value in bytes.
+ *  @param[in] value        The new value.
+ */
+void setValue(std::string & content, std::size_t offset, std::uint64_t value)
+{
+    ASSERT_LE(offset + sizeof(value), content.size());
+
+    std::memcpy(&(content[offset]), &value, sizeof(value));
+}
+
+TEST(BinFormatImporterTest, CheckRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    std::string content = exportGraph(*graph);
+
+    ASSERT_EQ((std::size_t)0, content.size() % 8);
+
+    const std::string path("BinFormatImporterTest.bin");
+
+    htd_io::BinFormatGraphExporter exporter;
+
+    ASSERT_TRUE(exporter.write(*graph, path));
+
+    ASSERT_TRUE(importer.isValid(path));
+    ASSERT_FALSE(importer.isNamed(path));
+
+    htd::IMultiHypergraph * fileGraph = importer.import(path);
+
+    std::remove(path.c_str());
+
+    htd::IMultiHypergraph * streamGraph = importGraph(importer, content);
+
+    for (const htd::IMultiHypergraph * importedGraph : { fileGraph, streamGraph })
+    {
+        ASSERT_NE(importedGraph, nullptr);
+
+        ASSERT_EQ(graph->vertexCount(), importedGraph->vertexCount());
+        ASSERT_EQ(graph->edgeCount(), importedGraph->edgeCount());
+
+        ASSERT_EQ(std::vector<htd::vertex_t>(graph->vertices().begin(), graph->vertices().end()),
+                  std::vector<htd::vertex_t>(importedGraph->vertices().begin(), importedGraph->vertices().end()));
+
+        for (htd::index_t index = 0; index < graph->edgeCount(); ++index)
+        {
+            const htd::Hyperedge & expectedHyperedge = graph->hyperedgeAtPosition(index);
+
+            const htd::Hyperedge & actualHyperedge = importedGraph->hyperedgeAtPosition(index);
+
+            EXPECT_EQ(expectedHyperedge.id(), actualHyperedge.id());
+
+            EXPECT_EQ(expectedHyperedge.elements(), actualHyperedge.elements());
+        }
+    }
+
+    delete fileGraph;
+    delete streamGraph;
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckRoundTripWithRemovedVertex)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    graph->removeVertex(2);
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    htd::IMultiHypergraph * importedGraph = importGraph(importer, exportGraph(*graph));
+
+    ASSERT_NE(importedGraph, nullptr);
+
+    ASSERT_EQ((std::size_t)5, importedGraph->vertexCount());
+    ASSERT_EQ(graph->edgeCount(), importedGraph->edgeCount());
+
+    /* The vertices 3, 4, 5 and 6 are renumbered to 2, 3, 4 and 5. */
+    for (htd::index_t index = 0; index < graph->edgeCount(); ++index)
+    {
+        std::vector<htd::vertex_t> expectedElements;
+
+        for (htd::vertex_t vertex : graph->hyperedgeAtPosition(index))
+        {
+            expectedElements.push_back(vertex > 2 ? vertex - 1 : vertex);
+        }
+
+        EXPECT_EQ(expectedElements, importedGraph->hyperedgeAtPosition(index).elements());
+    }
+
+    delete importedGraph;
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckNamedRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> graph(libraryInstance);
+
+    graph.addVertex("a");
+    graph.addVertex("b");
+    graph.addVertex("c");
+
+    htd::id_t edgeId = graph.addEdge("a", "b", "ab");
+
+    graph.addEdge(std::vector<std::string> { "c", "a", "b" });
+
+    htd_io::BinFormatGraphExporter exporter;
+
+    std::ostringstream outputStream(std::ios::binary);
+
+    ASSERT_TRUE(exporter.write(graph, outputStream));
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    std::istringstream inputStream(outputStream.str(), std::ios::binary);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * importedGraph = importer.importNamed(inputStream);
+
+    ASSERT_NE(importedGraph, nullptr);
+
+    ASSERT_EQ((std::size_t)3, importedGraph->vertexCount());
+    ASSERT_EQ((std::size_t)2, importedGraph->edgeCount());
+
+    ASSERT_TRUE(importedGraph->isEdgeName("ab"));
+
+    EXPECT_EQ(edgeId, importedGraph->associatedEdgeId("ab"));
+
+    EXPECT_TRUE(importedGraph->isNeighbor("a", "b"));
+    EXPECT_TRUE(importedGraph->isNeighbor("c", "b"));
+
+    std::vector<std::vector<std::string>> hyperedges;
+
+    for (const htd::NamedVertexHyperedge<std::string> & hyperedge : importedGraph->hyperedges())
+    {
+        hyperedges.push_back(hyperedge.elements());
+    }
+
+    EXPECT_EQ(std::vector<std::vector<std::string>>({ { "a", "b" }, { "c", "a", "b" } }), hyperedges);
+
+    delete importedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckTruncatedInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    std::string content = exportGraph(*graph);
+
+    for (std::size_t size = 0; size < content.size(); ++size)
+    {
+        EXPECT_EQ(nullptr, importGraph(importer, content.substr(0, size))) << "Size: " << size;
+    }
+
+    const std::string path("BinFormatImporterTest.bin");
+
+    {
+        std::ofstream stream(path, std::ios::binary);
+
+        stream << content.substr(0, content.size() - 8);
+    }
+
+    EXPECT_FALSE(importer.isValid(path));
+
+    EXPECT_EQ(nullptr, importer.import(path));
+
+    std::remove(path.c_str());
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(BinFormatImporterTest, CheckCorruptInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd_io::BinFormatImporter importer(libraryInstance);
+
+    const std::string content = exportGraph(*graph);
+
+    const std::size_t edgeOffsets = htd_io::BinFormat::HEADER_SIZE;
+
+    const std::size_t elements = edgeOffsets + (graph->edgeCount() + 1) * sizeof(std::uint64_t);
+
+    std::string corruptedContent = content;
+
+    corruptedContent[0] = 'X';
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Magic string";
+
+    corruptedContent = content;
+
+    corruptedContent[8] = static_cast<char>(corruptedContent[8] + 1);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Version";
+
+    corruptedContent = content;
+
+    std::swap(corruptedContent[12], corruptedContent[15]);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Byte order";
+
+    corruptedContent = content;
+
+    setValue(corruptedContent, 16, 4);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Unknown flag";
+
+    corruptedContent = content;
+
+    setValue(corruptedContent, 16, htd_io::BinFormat::VERTEX_NAMES);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Missing name table";
+
+    corruptedContent = content;
+
+    setValue(corruptedContent, 32, (std::uint64_t)-1);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Edge count";
+
+    corruptedContent = content;
+
+    /* The first two hyperedges end at offsets 2 and 5, so an offset of 1 for the second one is decreasing. */
+    setValue(corruptedContent, edgeOffsets + 2 * sizeof(std::uint64_t), 1);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Decreasing edge offset";
+
+    corruptedContent = content;
+
+    setValue(corruptedContent, edgeOffsets + graph->edgeCount() * sizeof(std::uint64_t), 0);
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Last edge offset";
+
+    corruptedContent = content;
+
+    setValue(corruptedContent, elements, graph->vertexCount());
+
+    EXPECT_EQ(nullptr, importGraph(importer, corruptedContent)) << "Element";
+
+    htd::IMultiHypergraph * importedGraph = importGraph(importer, content);
+
+    EXPECT_NE(nullptr, importedGraph);
+
+    delete importedGraph;
+
+    delete graph;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
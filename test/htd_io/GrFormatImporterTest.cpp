@@ -0,0 +1,278 @@
+/*
+ * File:   GrFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class GrFormatImporterTest : public ::testing::Test
+{
+    public:
+        GrFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~GrFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Write the given content to a file without any newline translation.
+ *
+ *  @param[in] path     The path of the file.
+ *  @param[in] content  The content which shall be written.
+ */
+void writeFile(const std::string & path, const std::string & content)
+{
+    std::ofstream stream(path, std::ios::binary);
+
+    stream << content;
+}
+
+/**
+ *  Import the given content once via the memory-mapped file parser and once via the stream parser.
+ *
+ *  @param[in] importer The importer which shall be used.
+ *  @param[in] content  The content in format 'gr'.
+ *
+ *  @return A pair consisting of the graph parsed from a file and the graph parsed from a stream.
+ */
+std::pair<htd::IMultiGraph *, htd::IMultiGraph *> importTwice(const htd_io::GrFormatImporter & importer, const std::string & content)
+{
+    const std::string path("GrFormatImporterTest.gr");
+
+    writeFile(path, content);
+
+    htd::IMultiGraph * fileGraph = importer.import(path);
+
+    std::remove(path.c_str());
+
+    std::istringstream stream(content);
+
+    htd::IMultiGraph * streamGraph = importer.import(stream);
+
+    return std::make_pair(fileGraph, streamGraph);
+}
+
+/**
+ *  Check that two graphs have the same vertices and the same edges in the same order.
+ *
+ *  @param[in] expectedGraph    The expected graph.
+ *  @param[in] actualGraph      The graph which shall be checked.
+ */
+void expectEqualGraphs(const htd::IMultiGraph & expectedGraph, const htd::IMultiGraph & actualGraph)
+{
+    ASSERT_EQ(expectedGraph.vertexCount(), actualGraph.vertexCount());
+    ASSERT_EQ(expectedGraph.edgeCount(), actualGraph.edgeCount());
+
+    for (htd::index_t index = 0; index < expectedGraph.edgeCount(); ++index)
+    {
+        ASSERT_EQ(expectedGraph.hyperedgeAtPosition(index).elements(), actualGraph.hyperedgeAtPosition(index).elements());
+    }
+}
+
+TEST(GrFormatImporterTest, CheckFileAndStreamImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::pair<htd::IMultiGraph *, htd::IMultiGraph *> graphs = importTwice(importer, "c example\np tw 5 4\n1 2\nc comment between edges\n2 3\n3 1\n4 5\n");
+
+    ASSERT_NE(graphs.first, nullptr);
+    ASSERT_NE(graphs.second, nullptr);
+
+    ASSERT_EQ((std::size_t)5, graphs.first->vertexCount());
+    ASSERT_EQ((std::size_t)4, graphs.first->edgeCount());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 1 }), graphs.first->hyperedgeAtPosition(2).elements());
+
+    expectEqualGraphs(*(graphs.second), *(graphs.first));
+
+    delete graphs.first;
+    delete graphs.second;
+
+    delete libraryInstance;
+}
+
+TEST(GrFormatImporterTest, CheckWindowsLineEndings)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::pair<htd::IMultiGraph *, htd::IMultiGraph *> graphs = importTwice(importer, "c example\r\np tw 4 3\r\n1 2\r\nc comment\r\n2 3\r\n3 4");
+
+    ASSERT_NE(graphs.first, nullptr);
+    ASSERT_NE(graphs.second, nullptr);
+
+    ASSERT_EQ((std::size_t)4, graphs.first->vertexCount());
+    ASSERT_EQ((std::size_t)3, graphs.first->edgeCount());
+
+    expectEqualGraphs(*(graphs.second), *(graphs.first));
+
+    delete graphs.first;
+    delete graphs.second;
+
+    delete libraryInstance;
+}
+
+TEST(GrFormatImporterTest, CheckMalformedInput)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    for (const std::string & content : { std::string("p tw 3 2\n1 2\n2 3 1\n"),
+                                         std::string("p tw 3 2\n1 2\n2-3\n"),
+                                         std::string("p tw 3 2\n1 2\n\n2 3\n"),
+                                         std::string("p tw 3 3\n1 2\n2 3\n"),
+                                         std::string("p td 3 2\n1 2\n2 3\n"),
+                                         std::string("c only a comment\n") })
+    {
+        std::pair<htd::IMultiGraph *, htd::IMultiGraph *> graphs = importTwice(importer, content);
+
+        EXPECT_EQ(nullptr, graphs.first) << content;
+        EXPECT_EQ(nullptr, graphs.second) << content;
+
+        delete graphs.first;
+        delete graphs.second;
+    }
+
+    const std::string path("GrFormatImporterTest.gr");
+
+    writeFile(path, "p tw 3 2\n1 2\n2 4\n");
+
+    EXPECT_EQ(nullptr, importer.import(path));
+
+    writeFile(path, "p tw 3 2\n0 2\n2 3\n");
+
+    EXPECT_EQ(nullptr, importer.import(path));
+
+    std::remove(path.c_str());
+
+    delete libraryInstance;
+}
+
+TEST(GrFormatImporterTest, CheckParallelImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::size_t vertexCount = 10000;
+    std::size_t edgeCount = 100000;
+
+    std::ostringstream content;
+
+    content << "c random graph\np tw " << vertexCount << " " << edgeCount << "\r\n";
+
+    std::mt19937 generator(1);
+
+    std::uniform_int_distribution<htd::vertex_t> distribution(1, (htd::vertex_t)vertexCount);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        if (index % 1000 == 0)
+        {
+            content << "c edge " << index << "\n";
+        }
+
+        content << distribution(generator) << " " << distribution(generator) << (index % 2 == 0 ? "\n" : "\r\n");
+    }
+
+    std::pair<htd::IMultiGraph *, htd::IMultiGraph *> graphs = importTwice(importer, content.str());
+
+    ASSERT_NE(graphs.first, nullptr);
+    ASSERT_NE(graphs.second, nullptr);
+
+    expectEqualGraphs(*(graphs.second), *(graphs.first));
+
+    for (std::size_t threadCount : { 2, 3, 7 })
+    {
+        importer.setThreadCount(threadCount);
+
+        ASSERT_EQ(threadCount, importer.threadCount());
+
+        std::pair<htd::IMultiGraph *, htd::IMultiGraph *> parallelGraphs = importTwice(importer, content.str());
+
+        ASSERT_NE(parallelGraphs.first, nullptr);
+        ASSERT_NE(parallelGraphs.second, nullptr);
+
+        expectEqualGraphs(*(graphs.first), *(parallelGraphs.first));
+
+        delete parallelGraphs.first;
+        delete parallelGraphs.second;
+
+        const std::string path("GrFormatImporterTest.gr");
+
+        writeFile(path, content.str() + "1 x\n");
+
+        EXPECT_EQ(nullptr, importer.import(path));
+
+        std::string corruptedContent = content.str();
+
+        corruptedContent.insert(corruptedContent.size() / 2, "\n");
+
+        writeFile(path, corruptedContent);
+
+        EXPECT_EQ(nullptr, importer.import(path));
+
+        std::remove(path.c_str());
+    }
+
+    delete graphs.first;
+    delete graphs.second;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}